@@ -15,12 +15,14 @@
  */
 
 #include "asm_commander.h"
+#include <chrono>
 #include <cstring>
 #include "asm_directive.h"
 #include "file_printer.h"
 #include "file_sources.h"
 #include "intel_hex.h"
 #include "moto_srec.h"
+#include "stats.h"
 #include "stored_printer.h"
 
 namespace libasm {
@@ -28,7 +30,7 @@ namespace cli {
 
 using namespace libasm::driver;
 
-AsmCommander::AsmCommander(std::initializer_list<AsmDirective *> directives)
+AsmCommander::AsmCommander(const std::vector<AsmDirective *> &directives)
     : _driver(directives) {}
 
 char AsmCommander::encoderType(const char *output_name) const {
@@ -54,20 +56,60 @@ int AsmCommander::assemble() {
         fprintf(stderr, "unknown CPU '%s'\n", _cpu);
         return 4;
     }
+    if (!_reassemble)
+        return assembleOnce();
 
+    // Lines encoded by a run are reused by following runs as long as they are unchanged.
+    _driver.setIncremental(true);
+    int errors;
+    do {
+        errors = assembleOnce();
+        // Tell the requester that the output files are complete.
+        printf("%d\n", errors);
+        fflush(stdout);
+    } while (waitRequest());
+    return errors;
+}
+
+bool AsmCommander::waitRequest() {
+    int c;
+    while ((c = getchar()) != EOF) {
+        if (c == '\n')
+            return true;
+    }
+    return false;
+}
+
+int AsmCommander::assembleOnce() {
+    const auto start = std::chrono::steady_clock::now();
+    stats::reset();
     int pass = 0;
     if (_verbose) {
         fprintf(stderr, "libasm assembler (version " LIBASM_VERSION_STRING ")\n");
         fprintf(stderr, "%s: Pass %d\n", _input_name, ++pass);
     }
     _driver.clearSymbols();
+    _driver.setUpperHex(_upper_hex);
+    _driver.setLineNumber(_line_number);
+    _driver.reset();
+    if (_cpu)
+        _driver.setCpu(_cpu);
+    for (const auto &it : _options) {
+        _driver.setOption(it.first.c_str(), it.second.c_str());
+    }
+    _driver.save();
 
+    int passes = 0;
     BinMemory memory, prev;
-    SymbolStoreImpl symbols;
+    // Each pass overwrites the listing, so that the final pass leaves its listing.
     StoredPrinter listout, errorout;
+    FilePrinter discard;
+    auto *stored = _list_name ? &listout : nullptr;
+    TextPrinter &listing = stored ? static_cast<TextPrinter &>(listout) : discard;
+    SourceCache cache;
     bool reportError = false;
     do {
-        FileSources sources;
+        FileSources sources{cache};
         if (sources.open(_input_name)) {
             fprintf(stderr, "Can't open input file %s\n", _input_name);
             return 1;
@@ -75,21 +117,17 @@ int AsmCommander::assemble() {
         if (_verbose)
             fprintf(stderr, "%s: Pass %d\n", _input_name, ++pass);
         prev.swap(memory);
-        symbols.copy(_driver.symbols());
+        _driver.symbols().resetChanges();
         memory.clear();
         listout.clear();
         errorout.clear();
-        _driver.setUpperHex(_upper_hex);
-        _driver.setLineNumber(_line_number);
-        _driver.reset();
-        if (_cpu)
-            _driver.setCpu(_cpu);
-        for (const auto &it : _options) {
-            _driver.setOption(it.first.c_str(), it.second.c_str());
-        }
-        _driver.assemble(sources, memory, listout, errorout, reportError);
+        _driver.restore();
+        ++passes;
+        _driver.assemble(sources, memory, listing, errorout, reportError);
+        if (!reportError && _driver.resolveFixups(sources, memory, stored))
+            break;
         reportError = true;
-    } while (errorout.size() == 0 && (memory != prev || symbols != _driver.symbols()));
+    } while (errorout.size() == 0 && (_driver.symbols().changed() || memory != prev));
 
     int errors = 0;
     for (size_t lineno = 1; lineno <= errorout.size(); lineno++) {
@@ -97,50 +135,96 @@ int AsmCommander::assemble() {
         ++errors;
     }
 
-    if (_list_name) {
-        if (_verbose)
-            fprintf(stderr, "%s: Opened for listing\n", _list_name);
-        FILE *list = fopen(_list_name, "w");
-        if (list == nullptr) {
-            fprintf(stderr, "Can't open list file %s\n", _list_name);
-            ++errors;
-        } else {
-            for (size_t lineno = 1; lineno <= listout.size(); lineno++)
-                fprintf(list, "%s\n", listout.line(lineno));
-            fclose(list);
+    {
+        const stats::Timer timer{stats::OUTPUT_NANOS};
+        if (_list_name) {
+            FilePrinter listfile;
+            if (!listfile.open(_list_name, FilePrinter::BUFFER_SIZE)) {
+                fprintf(stderr, "Can't open list file %s\n", _list_name);
+                ++errors;
+            } else {
+                if (_verbose)
+                    fprintf(stderr, "%s: Opened for listing\n", _list_name);
+                for (size_t lineno = 1; lineno <= listout.size(); lineno++)
+                    listfile.println(listout.line(lineno));
+            }
         }
-    }
 
-    if (_output_name) {
-        FilePrinter output;
-        if (!output.open(_output_name)) {
-            fprintf(stderr, "Can't open output file %s\n", _output_name);
-            ++errors;
-        } else {
-            const auto type = encoderType(_output_name);
-            auto *encoder = &_driver.current()->defaultEncoder();
-            if (type == 'S')
-                encoder = &MotoSrec::encoder();
-            else if (type == 'H')
-                encoder = &IntelHex::encoder();
-            encoder->reset(_record_bytes);
-            encoder->encode(memory, output);
-            if (_verbose) {
-                const auto unit = _driver.current()->config().addressUnit();
-                for (auto block = memory.begin(); block != nullptr; block = block->next()) {
-                    const auto start = block->base() / unit;
-                    const auto size = block->size();
-                    const auto end = (block->base() + size - 1) / unit;
-                    fprintf(stderr, "%s: Write %4u bytes %04x-%04x\n", _output_name, size, start,
-                            end);
+        if (_output_name) {
+            FilePrinter output;
+            if (!output.open(_output_name, FilePrinter::BUFFER_SIZE)) {
+                fprintf(stderr, "Can't open output file %s\n", _output_name);
+                ++errors;
+            } else {
+                const auto type = encoderType(_output_name);
+                auto *encoder = &_driver.current()->defaultEncoder();
+                if (type == 'S')
+                    encoder = &MotoSrec::encoder();
+                else if (type == 'H')
+                    encoder = &IntelHex::encoder();
+                encoder->reset(_record_bytes);
+                encoder->encode(memory, output);
+                if (_verbose) {
+                    const auto unit = _driver.current()->config().addressUnit();
+                    for (auto block = memory.begin(); block != nullptr; block = block->next()) {
+                        const auto start = block->base() / unit;
+                        const auto size = block->size();
+                        const auto end = (block->base() + size - 1) / unit;
+                        fprintf(stderr, "%s: Write %4u bytes %04x-%04x\n", _output_name, size,
+                                start, end);
+                    }
                 }
             }
         }
     }
 
+    if (_stats) {
+        const std::chrono::duration<double, std::milli> elapsed =
+                std::chrono::steady_clock::now() - start;
+        printStats(passes, memory, elapsed.count());
+    }
+
     return errors;
 }
 
+void AsmCommander::printStats(int passes, const BinMemory &memory, double msec) const {
+    size_t bytes = 0;
+    for (auto block = memory.begin(); block != nullptr; block = block->next())
+        bytes += block->size();
+    fprintf(stderr, "%s: passes %d, bytes %zu, time %.1f ms\n", _input_name, passes, bytes, msec);
+    if (_reassemble)
+        fprintf(stderr, "%s: reused %zu lines in the last pass\n", _input_name,
+                _driver.reusedLines());
+    if (!stats::ENABLED) {
+        fprintf(stderr, "%s: build with STATS=1 to count searches and time phases\n",
+                _input_name);
+        return;
+    }
+    const auto perCall = [](stats::Counter entries, stats::Counter calls) {
+        const auto n = stats::value(calls);
+        return n ? static_cast<double>(stats::value(entries)) / n : 0.0;
+    };
+    fprintf(stderr, "%s: searchName   %10llu calls %6.1f entries/call\n", _input_name,
+            static_cast<unsigned long long>(stats::value(stats::SEARCH_NAME)),
+            perCall(stats::NAME_ENTRIES, stats::SEARCH_NAME));
+    fprintf(stderr, "%s: searchOpCode %10llu calls %6.1f entries/call\n", _input_name,
+            static_cast<unsigned long long>(stats::value(stats::SEARCH_OPCODE)),
+            perCall(stats::OPCODE_ENTRIES, stats::SEARCH_OPCODE));
+    fprintf(stderr, "%s: eval         %10llu calls\n", _input_name,
+            static_cast<unsigned long long>(stats::value(stats::VALUE_EVAL)));
+    fprintf(stderr, "%s: lookupSymbol %10llu calls\n", _input_name,
+            static_cast<unsigned long long>(stats::value(stats::SYMBOL_LOOKUP)));
+    fprintf(stderr, "%s: function     %10llu calls\n", _input_name,
+            static_cast<unsigned long long>(stats::value(stats::FUNCTION_EVAL)));
+    fprintf(stderr, "%s: writeByte    %10llu bytes in all passes\n", _input_name,
+            static_cast<unsigned long long>(stats::value(stats::BYTES_WRITTEN)));
+    const auto msecOf = [](stats::Counter nanos) { return stats::value(nanos) / 1e6; };
+    fprintf(stderr,
+            "%s: read %.1f ms, encode %.1f ms, list %.1f ms, fixup %.1f ms, output %.1f ms\n",
+            _input_name, msecOf(stats::READ_NANOS), msecOf(stats::ENCODE_NANOS),
+            msecOf(stats::LIST_NANOS), msecOf(stats::FIXUP_NANOS), msecOf(stats::OUTPUT_NANOS));
+}
+
 bool AsmCommander::defaultDirective() {
     const auto prefix = strstr(_prog_name, PROG_PREFIX);
     if (prefix) {
@@ -184,6 +268,9 @@ usage: %s [-o <output>] [-l <list>] <input>
   -h                : use lower case letter for hexadecimal
   -n                : output line number to list file
   -v                : print progress verbosely
+  --stats           : print passes, bytes, time and instrumentation counters
+  --reassemble      : assemble again whenever a line is read from standard input,
+                    : reusing unchanged lines, and print the number of errors
 )",
             LIBASM_VERSION_STRING, _prog_name, list.c_str());
     bool longOptions = false;
@@ -256,6 +343,8 @@ int AsmCommander::parseArgs(int argc, const char **argv) {
     _upper_hex = true;
     _line_number = false;
     _verbose = false;
+    _stats = false;
+    _reassemble = false;
     for (auto i = 1; i < argc; i++) {
         const auto *opt = argv[i];
         if (*opt == '-') {
@@ -304,7 +393,15 @@ int AsmCommander::parseArgs(int argc, const char **argv) {
                 _verbose = true;
                 break;
             case '-':
-                parseOptionValue(++opt);
+                if (strcmp(++opt, "stats") == 0) {
+                    _stats = true;
+                    break;
+                }
+                if (strcmp(opt, "reassemble") == 0) {
+                    _reassemble = true;
+                    break;
+                }
+                parseOptionValue(opt);
                 break;
             default:
                 fprintf(stderr, "unknown option: %s\n", opt);
@@ -17,9 +17,9 @@
 #ifndef __LIBASM_ASM_COMMANDER_H__
 #define __LIBASM_ASM_COMMANDER_H__
 
-#include <initializer_list>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "asm_driver.h"
 #include "bin_memory.h"
@@ -29,7 +29,7 @@ namespace libasm {
 namespace cli {
 
 struct AsmCommander final {
-    AsmCommander(std::initializer_list<driver::AsmDirective *> directives);
+    AsmCommander(const std::vector<driver::AsmDirective *> &directives);
 
     int parseArgs(int argc, const char **argv);
     int usage();
@@ -49,12 +49,17 @@ private:
 
     bool _line_number;
     bool _verbose;
+    bool _stats;
+    bool _reassemble;
     std::map<std::string, std::string> _options;
 
     static constexpr const char *PROG_PREFIX = "asm";
+    int assembleOnce();
     bool defaultDirective();
     void parseOptionValue(const char *option);
     char encoderType(const char *output_name) const;
+    void printStats(int passes, const driver::BinMemory &memory, double msec) const;
+    static bool waitRequest();
 };
 
 }  // namespace cli
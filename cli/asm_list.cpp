@@ -0,0 +1,192 @@
+/*
+ * Copyright 2026 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "asm_list.h"
+
+#include "asm_cdp1802.h"
+#include "asm_cp1600.h"
+#include "asm_f3850.h"
+#include "asm_h16.h"
+#include "asm_h8300.h"
+#include "asm_h8500.h"
+#include "asm_i8048.h"
+#include "asm_i8051.h"
+#include "asm_i8080.h"
+#include "asm_i8086.h"
+#include "asm_i8096.h"
+#include "asm_ins8060.h"
+#include "asm_ins8070.h"
+#include "asm_mc6800.h"
+#include "asm_mc68000.h"
+#include "asm_mc6805.h"
+#include "asm_mc6809.h"
+#include "asm_mc68hc12.h"
+#include "asm_mc68hc16.h"
+#include "asm_mn1610.h"
+#include "asm_mos6502.h"
+#include "asm_ns32000.h"
+#include "asm_pdp11.h"
+#include "asm_pdp8.h"
+#include "asm_scn2650.h"
+#include "asm_superh.h"
+#include "asm_tlcs90.h"
+#include "asm_tlcs900.h"
+#include "asm_tms320.h"
+#include "asm_tms320f.h"
+#include "asm_tms370.h"
+#include "asm_tms7000.h"
+#include "asm_tms9900.h"
+#include "asm_z280.h"
+#include "asm_z380.h"
+#include "asm_z8.h"
+#include "asm_z80.h"
+#include "asm_z8000.h"
+
+namespace libasm {
+namespace cli {
+
+using namespace libasm::driver;
+
+const std::vector<AsmDirective *> &asmDirectives() {
+    static cdp1802::AsmCdp1802 asm1802;
+    static cp1600::AsmCp1600 asm1600;
+    static f3850::AsmF3850 asm3850;
+    static h16::AsmH16 ash16;
+    static h8300::AsmH8300 asm8300;
+    static h8500::AsmH8500 ash8500;
+    static i8048::AsmI8048 asm8048;
+    static i8051::AsmI8051 asm8051;
+    static i8080::AsmI8080 asm8080;
+    static i8086::AsmI8086 asm8086;
+    static i8096::AsmI8096 asm8096;
+    static ins8060::AsmIns8060 asm8060;
+    static ins8070::AsmIns8070 asm8070;
+    static mc68000::AsmMc68000 asm68000;
+    static mc6800::AsmMc6800 asm6800;
+    static mc6805::AsmMc6805 asm6805;
+    static mc6809::AsmMc6809 asm6809;
+    static mc68hc12::AsmMc68HC12 asm6812;
+    static mc68hc16::AsmMc68HC16 asm6816;
+    static mn1610::AsmMn1610 asm1610;
+    static mos6502::AsmMos6502 asm6502;
+    static ns32000::AsmNs32000 asm32000;
+    static pdp11::AsmPdp11 asmpdp11;
+    static pdp8::AsmPdp8 asmpdp8;
+    static scn2650::AsmScn2650 asm2650;
+    static superh::AsmSuperH asmsuperh;
+    static tlcs90::AsmTlcs90 asm90;
+    static tlcs900::AsmTlcs900 asm900;
+    static tms320::AsmTms320 asm320;
+    static tms320f::AsmTms320f asm320f;
+    static tms370::AsmTms370 asm370;
+    static tms7000::AsmTms7000 asm7000;
+    static tms9900::AsmTms9900 asm9900;
+    static z280::AsmZ280 asmz280;
+    static z380::AsmZ380 asmz380;
+    static z8000::AsmZ8000 asmz8000;
+    static z80::AsmZ80 asmz80;
+    static z8::AsmZ8 asmz8;
+
+    static DecDirective dirpdp11(asmpdp11);
+    static DecDirective dirpdp8(asmpdp8);
+    static FairchildDirective dir3850(asm3850);
+    static IntelDirective dir1610(asm1610);
+    static IntelDirective dir2650(asm2650);
+    static IntelDirective dir320(asm320);
+    static IntelDirective dir320f(asm320f);
+    static IntelDirective dir370(asm370);
+    static IntelDirective dir7000(asm7000);
+    static IntelDirective dir8048(asm8048);
+    static IntelDirective dir8051(asm8051);
+    static IntelDirective dir8080(asm8080);
+    static IntelDirective dir8086(asm8086);
+    static IntelDirective dir8096(asm8096);
+    static IntelDirective dir9900(asm9900);
+    static MostekDirective dir6502(asm6502);
+    static MotorolaDirective dir68000(asm68000);
+    static HitachiDirective dir8300(asm8300);
+    static HitachiDirective dirh16(ash16);
+    static H8500Directive dirh8500(ash8500);
+    static HitachiDirective dirsuperh(asmsuperh);
+    static MotorolaDirective dir6800(asm6800);
+    static MotorolaDirective dir6805(asm6805);
+    static MotorolaDirective dir6809(asm6809);
+    static MotorolaDirective dir6812(asm6812);
+    static MotorolaDirective dir6816(asm6816);
+    static NationalDirective dir32000(asm32000);
+    static NationalDirective dir8060(asm8060);
+    static NationalDirective dir8070(asm8070);
+    static MotorolaDirective dir1600(asm1600);
+    static RcaDirective dir1802(asm1802);
+    static Z8Directive dirz8(asmz8);
+    static ZilogDirective dir90(asm90);
+    static ZilogDirective dir900(asm900);
+    static ZilogDirective dirz280(asmz280);
+    static ZilogDirective dirz380(asmz380);
+    static ZilogDirective dirz8000(asmz8000);
+    static ZilogDirective dirz80(asmz80);
+    static const std::vector<AsmDirective *> list{
+            &dir6800,
+            &dir6805,
+            &dir6809,
+            &dir6812,
+            &dir6816,
+            &dir6502,
+            &dir8048,
+            &dir8051,
+            &dir8080,
+            &dirz80,
+            &dirz280,
+            &dirz380,
+            &dirz8,
+            &dir90,
+            &dir900,
+            &dir8060,
+            &dir8070,
+            &dir1600,
+            &dir1802,
+            &dir2650,
+            &dir3850,
+            &dirpdp8,
+            &dir7000,
+            &dir370,
+            &dir320,
+            &dir320f,
+            &dir8086,
+            &dir8096,
+            &dir68000,
+            &dirh16,
+            &dir8300,
+            &dirh8500,
+            &dirsuperh,
+            &dir9900,
+            &dirz8000,
+            &dir32000,
+            &dir1610,
+            &dirpdp11,
+    };
+    return list;
+}
+
+}  // namespace cli
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -14,129 +14,12 @@
  * limitations under the License.
  */
 
-#include "dis_cdp1802.h"
 #include "dis_commander.h"
-#include "dis_cp1600.h"
-#include "dis_f3850.h"
-#include "dis_h8300.h"
-#include "dis_h8500.h"
-#include "dis_i8048.h"
-#include "dis_i8051.h"
-#include "dis_i8080.h"
-#include "dis_i8086.h"
-#include "dis_i8096.h"
-#include "dis_ins8060.h"
-#include "dis_ins8070.h"
-#include "dis_mc6800.h"
-#include "dis_mc68000.h"
-#include "dis_mc6805.h"
-#include "dis_mc6809.h"
-#include "dis_mc68hc12.h"
-#include "dis_mc68hc16.h"
-#include "dis_mn1610.h"
-#include "dis_mos6502.h"
-#include "dis_ns32000.h"
-#include "dis_pdp11.h"
-#include "dis_pdp8.h"
-#include "dis_scn2650.h"
-#include "dis_superh.h"
-#include "dis_tlcs90.h"
-#include "dis_tlcs900.h"
-#include "dis_tms320.h"
-#include "dis_tms320f.h"
-#include "dis_tms370.h"
-#include "dis_tms7000.h"
-#include "dis_tms9900.h"
-#include "dis_z280.h"
-#include "dis_h16.h"
-#include "dis_z380.h"
-#include "dis_z8.h"
-#include "dis_z80.h"
-#include "dis_z8000.h"
+#include "dis_list.h"
 
-using namespace libasm;
 using namespace libasm::cli;
-using namespace libasm::driver;
 
-cdp1802::DisCdp1802 dis1802;
-cp1600::DisCp1600 dis1600;
-f3850::DisF3850 dis3850;
-h16::DisH16 dish16;
-h8300::DisH8300 dish8300;
-h8500::DisH8500 dish8500;
-i8048::DisI8048 dis8048;
-i8051::DisI8051 dis8051;
-i8080::DisI8080 dis8080;
-i8086::DisI8086 dis8086;
-i8096::DisI8096 dis8096;
-ins8060::DisIns8060 dis8060;
-ins8070::DisIns8070 dis8070;
-mc68000::DisMc68000 dis68000;
-mc6800::DisMc6800 dis6800;
-mc6805::DisMc6805 dis6805;
-mc6809::DisMc6809 dis6809;
-mc68hc12::DisMc68HC12 dis6812;
-mc68hc16::DisMc68HC16 dis6816;
-mn1610::DisMn1610 dis1610;
-mos6502::DisMos6502 dis6502;
-ns32000::DisNs32000 dis32000;
-pdp11::DisPdp11 dispdp11;
-pdp8::DisPdp8 dispdp8;
-scn2650::DisScn2650 dis2650;
-superh::DisSuperH dissuperh;
-tlcs90::DisTlcs90 dis90;
-tlcs900::DisTlcs900 dis900;
-tms320::DisTms320 dis320;
-tms320f::DisTms320f dis320f;
-tms370::DisTms370 dis370;
-tms7000::DisTms7000 dis7000;
-tms9900::DisTms9900 dis9900;
-z280::DisZ280 disz280;
-z380::DisZ380 disz380;
-z8000::DisZ8000 disz8000;
-z80::DisZ80 disz80;
-z8::DisZ8 disz8;
-
-DisCommander commander{
-        &dis6800,
-        &dis6805,
-        &dis6809,
-        &dis6812,
-        &dis6816,
-        &dis6502,
-        &dis8048,
-        &dis8051,
-        &dis8080,
-        &disz80,
-        &disz280,
-        &disz380,
-        &disz8,
-        &dis90,
-        &dis900,
-        &dis8060,
-        &dis8070,
-        &dis1600,
-        &dis1802,
-        &dis2650,
-        &dis3850,
-        &dispdp8,
-        &dis7000,
-        &dis370,
-        &dis320,
-        &dis320f,
-        &dis8086,
-        &dis8096,
-        &dis68000,
-        &dish16,
-        &dish8300,
-        &dish8500,
-        &dissuperh,
-        &dis9900,
-        &disz8000,
-        &dis32000,
-        &dis1610,
-        &dispdp11,
-};
+DisCommander commander{disassemblers()};
 
 int main(int argc, const char **argv) {
     if (commander.parseArgs(argc, argv))
@@ -17,19 +17,22 @@
 #include "dis_commander.h"
 
 #include <algorithm>
+#include <climits>
 #include <cstring>
 #include <string>
+#include <thread>
 
 #include "bin_decoder.h"
 #include "file_printer.h"
-#include "file_reader.h"
+#include "mapped_file.h"
+#include "text_file.h"
 
 namespace libasm {
 namespace cli {
 
 using namespace libasm::driver;
 
-DisCommander::DisCommander(std::initializer_list<Disassembler *> disassemblers)
+DisCommander::DisCommander(const std::vector<Disassembler *> &disassemblers)
     : _driver(disassemblers) {}
 
 int DisCommander::disassemble() {
@@ -44,19 +47,55 @@ int DisCommander::disassemble() {
         return 1;
     }
 
-    FileReader input(_input_name);
-    if (!input.open()) {
+    if (_raw_binary) {
+        const auto &config = _driver.current()->config();
+        const auto unit = config.addressUnit();
+        if (config.checkAddr(_load_address) != OK || _load_address > UINT32_MAX / unit) {
+            fprintf(stderr, "Load address 0x%X is out of range for %s\n", _load_address,
+                    config.cpu_P());
+            return 1;
+        }
+        MappedBinary binary(_input_name, _load_address * unit);
+        if (!binary.open()) {
+            fprintf(stderr, "Can't open input file %s\n", _input_name);
+            return 1;
+        }
+        if (binary.begin() == nullptr) {
+            fprintf(stderr, "Input file %s is empty\n", _input_name);
+            return 1;
+        }
+        if (config.checkAddr(binary.endAddress() / unit) != OK) {
+            fprintf(stderr, "Input file %s exceeds address range of %s\n", _input_name,
+                    config.cpu_P());
+            return 1;
+        }
+        if (_verbose)
+            printBlocks(binary.name(), binary);
+        return disassemble(binary);
+    }
+
+    TextFile file(_input_name);
+    if (!file.open()) {
         fprintf(stderr, "Can't open input file %s\n", _input_name);
         return 1;
     }
     BinMemory memory;
+    TextFileReader input(_input_name, file);
     if (readBinary(memory, input) < 0)
         return 1;
-    input.close();
+    file.close();
+    return disassemble(memory);
+}
 
+template <typename MEMORY>
+int DisCommander::disassemble(MEMORY &memory) {
     const auto unit = _driver.current()->config().addressUnit();
     const auto mem_start = memory.startAddress() / unit;
     const auto mem_end = memory.endAddress() / unit;
+    if (!_entries.empty() && _driver.current()->dataDirective_P() == nullptr) {
+        fprintf(stderr, "-e is not supported for this CPU\n");
+        return 1;
+    }
     if (_dis_start > mem_end || _dis_end < mem_start) {
         fprintf(stderr, "Input file has address range: 0x%04X,0x%04X\n", mem_start, mem_end);
         fprintf(stderr, "-A range has no intersection: 0x%04X,0x%04X\n", _dis_start, _dis_end);
@@ -67,10 +106,16 @@ int DisCommander::disassemble() {
         const auto end = _range_end ? _dis_end * unit : memory.endAddress();
         memory.setRange(start, end);
     }
+    for (const auto entry : _entries) {
+        if (entry > UINT32_MAX / unit || !memory.contains(entry * unit)) {
+            fprintf(stderr, "-e address 0x%X is out of input file\n", entry);
+            return 1;
+        }
+    }
 
     FilePrinter output;
     if (_output_name) {
-        if (!output.open(_output_name)) {
+        if (!output.open(_output_name, FilePrinter::BUFFER_SIZE)) {
             fprintf(stderr, "Can't open output file %s\n", _output_name);
             return 1;
         }
@@ -79,7 +124,7 @@ int DisCommander::disassemble() {
     }
     FilePrinter listout;
     if (_list_name) {
-        if (!listout.open(_list_name)) {
+        if (!listout.open(_list_name, FilePrinter::BUFFER_SIZE)) {
             fprintf(stderr, "Can't open list file %s\n", _list_name);
             return 1;
         }
@@ -89,6 +134,9 @@ int DisCommander::disassemble() {
 
     _driver.setUpperHex(_upper_hex);
     _driver.setUppercase(_uppercase);
+    _driver.setJobs(_jobs);
+    for (const auto entry : _entries)
+        _driver.addEntry(entry);
     for (auto &opt : _options) {
         _driver.setOption(opt.first.c_str(), opt.second.c_str());
     }
@@ -100,23 +148,27 @@ int DisCommander::disassemble() {
 
 int DisCommander::readBinary(BinMemory &memory, TextReader &input) {
     const auto filename = input.name().c_str();
-    const auto unit = static_cast<uint8_t>(_driver.current()->config().addressUnit());
     const auto size = BinDecoder::decode(input, memory);
     if (size < 0) {
         fprintf(stderr, "%s:%d: Unrecognizable binary format\n", filename, input.lineno());
         return size;
     }
-    if (_verbose) {
-        for (auto block = memory.begin(); block != nullptr; block = block->next()) {
-            const auto start = block->base() / unit;
-            const auto size = block->size();
-            const auto end = (block->base() + size - 1) / unit;
-            fprintf(stderr, "%s: Read %4u bytes 0x%04X-0x%04X\n", filename, size, start, end);
-        }
-    }
+    if (_verbose)
+        printBlocks(input.name(), memory);
     return size;
 }
 
+void DisCommander::printBlocks(const std::string &filename, const BinReader &memory) {
+    const auto unit = _driver.current()->config().addressUnit();
+    for (auto block = memory.begin(); block != nullptr; block = block->next()) {
+        const auto start = block->base() / unit;
+        const auto size = block->size();
+        const auto end = (block->base() + size - 1) / unit;
+        fprintf(stderr, "%s: Read %4u bytes 0x%04X-0x%04X\n", filename.c_str(), size, start,
+                end);
+    }
+}
+
 Disassembler *DisCommander::defaultDisassembler() {
     Disassembler *dis = nullptr;
     const auto *prefix = strstr(_prog_name, PROG_PREFIX);
@@ -153,16 +205,19 @@ int DisCommander::usage() {
     }
     fprintf(stderr,
             R"(libasm disassembler (version %s)
-usage: %s%s [-o <output>] [-l <list>] <input>
+usage: %s%s [-o <output>] [-l <list>] [-b <address>] <input>
   -C <CPU>         : target CPU%s
   -o <output>      : output file
   -l <list>        : list file
   <input>          : file can be Motorola S-Record or Intel HEX format
+  -b <address>     : input is raw binary image loaded at address
   -A start[,end]   : disassemble start address and optional end address
   -r               : use program counter relative notation
   -h               : use lower case letter for hexadecimal
   -u               : use upper case letter for output
   -v               : print progress verbosely
+  -j <jobs>        : disassemble with jobs threads, up to number of cores
+  -e <address>     : trace control flow from entry address, can be repeated, not with -j
 )",
             LIBASM_VERSION_STRING, _prog_name, cpuOption, list.c_str());
     bool longOptions = false;
@@ -233,6 +288,9 @@ int DisCommander::parseArgs(int argc, const char **argv) {
     _uppercase = false;
     _verbose = false;
     _range_start = _range_end = false;
+    _raw_binary = false;
+    _load_address = 0;
+    _jobs = 1;
     _dis_start = 0;
     _dis_end = UINT32_MAX;
     for (auto i = 1; i < argc; i++) {
@@ -273,6 +331,49 @@ int DisCommander::parseArgs(int argc, const char **argv) {
             case 'v':
                 _verbose = true;
                 break;
+            case 'b':
+                if (++i >= argc) {
+                    fprintf(stderr, "-b requires load address\n");
+                    return 1;
+                } else {
+                    char *end;
+                    const auto addr = strtoul(argv[i], &end, 0);
+                    if (end == argv[i] || *end || addr > UINT32_MAX) {
+                        fprintf(stderr, "invalid address format for -b: %s\n", argv[i]);
+                        return 1;
+                    }
+                    _load_address = addr;
+                    _raw_binary = true;
+                }
+                break;
+            case 'j':
+                if (++i >= argc) {
+                    fprintf(stderr, "-j requires number of jobs\n");
+                    return 1;
+                } else {
+                    char *end;
+                    const auto jobs = strtoul(argv[i], &end, 0);
+                    if (end == argv[i] || *end || jobs == 0) {
+                        fprintf(stderr, "invalid number of jobs for -j: %s\n", argv[i]);
+                        return 1;
+                    }
+                    _jobs = jobs < UINT_MAX ? jobs : UINT_MAX;
+                }
+                break;
+            case 'e':
+                if (++i >= argc) {
+                    fprintf(stderr, "-e requires entry address\n");
+                    return 1;
+                } else {
+                    char *end;
+                    const auto entry = strtoul(argv[i], &end, 0);
+                    if (end == argv[i] || *end || entry > UINT32_MAX) {
+                        fprintf(stderr, "invalid address format for -e: %s\n", argv[i]);
+                        return 1;
+                    }
+                    _entries.push_back(entry);
+                }
+                break;
             case 'A':
                 if (++i >= argc) {
                     fprintf(stderr, "-A requires start[,end] address\n");
@@ -325,6 +426,14 @@ int DisCommander::parseArgs(int argc, const char **argv) {
         fprintf(stderr, "no input file\n");
         return 1;
     }
+    if (_jobs > 1 && !_entries.empty()) {
+        fprintf(stderr, "-j can't be used with -e, tracing is done by a single thread\n");
+        return 1;
+    }
+    // More threads than cores only adds overhead.
+    const auto cores = std::thread::hardware_concurrency();
+    if (cores && _jobs > cores)
+        _jobs = cores;
     if (_output_name && strcmp(_output_name, _input_name) == 0) {
         fprintf(stderr, "output file overwrite input file\n");
         return 2;
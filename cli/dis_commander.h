@@ -17,9 +17,9 @@
 #ifndef __LIBASM_DIS_COMMANDER_H__
 #define __LIBASM_DIS_COMMANDER_H__
 
-#include <initializer_list>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "bin_memory.h"
 #include "dis_driver.h"
@@ -29,7 +29,7 @@ namespace libasm {
 namespace cli {
 
 struct DisCommander final {
-    DisCommander(std::initializer_list<Disassembler *> disassemblers);
+    DisCommander(const std::vector<Disassembler *> &disassemblers);
 
     int parseArgs(int argc, const char **argv);
     int usage();
@@ -48,13 +48,20 @@ private:
     bool _verbose;
     bool _range_start;
     bool _range_end;
+    bool _raw_binary;
+    uint32_t _load_address;
+    unsigned _jobs;
     uint32_t _dis_start;
     uint32_t _dis_end;
+    std::vector<uint32_t> _entries;
     std::map<std::string, std::string> _options;
 
     static constexpr const char *PROG_PREFIX = "dis";
     Disassembler *defaultDisassembler();
     int readBinary(driver::BinMemory &memory, driver::TextReader &input);
+    void printBlocks(const std::string &filename, const driver::BinReader &memory);
+    template <typename MEMORY>
+    int disassemble(MEMORY &memory);
     void parseOptionValue(const char *option);
 };
 
@@ -0,0 +1,151 @@
+/*
+ * Copyright 2026 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dis_list.h"
+
+#include "dis_cdp1802.h"
+#include "dis_cp1600.h"
+#include "dis_f3850.h"
+#include "dis_h8300.h"
+#include "dis_h8500.h"
+#include "dis_i8048.h"
+#include "dis_i8051.h"
+#include "dis_i8080.h"
+#include "dis_i8086.h"
+#include "dis_i8096.h"
+#include "dis_ins8060.h"
+#include "dis_ins8070.h"
+#include "dis_mc6800.h"
+#include "dis_mc68000.h"
+#include "dis_mc6805.h"
+#include "dis_mc6809.h"
+#include "dis_mc68hc12.h"
+#include "dis_mc68hc16.h"
+#include "dis_mn1610.h"
+#include "dis_mos6502.h"
+#include "dis_ns32000.h"
+#include "dis_pdp11.h"
+#include "dis_pdp8.h"
+#include "dis_scn2650.h"
+#include "dis_superh.h"
+#include "dis_tlcs90.h"
+#include "dis_tlcs900.h"
+#include "dis_tms320.h"
+#include "dis_tms320f.h"
+#include "dis_tms370.h"
+#include "dis_tms7000.h"
+#include "dis_tms9900.h"
+#include "dis_z280.h"
+#include "dis_h16.h"
+#include "dis_z380.h"
+#include "dis_z8.h"
+#include "dis_z80.h"
+#include "dis_z8000.h"
+
+namespace libasm {
+namespace cli {
+
+const std::vector<Disassembler *> &disassemblers() {
+    static cdp1802::DisCdp1802 dis1802;
+    static cp1600::DisCp1600 dis1600;
+    static f3850::DisF3850 dis3850;
+    static h16::DisH16 dish16;
+    static h8300::DisH8300 dish8300;
+    static h8500::DisH8500 dish8500;
+    static i8048::DisI8048 dis8048;
+    static i8051::DisI8051 dis8051;
+    static i8080::DisI8080 dis8080;
+    static i8086::DisI8086 dis8086;
+    static i8096::DisI8096 dis8096;
+    static ins8060::DisIns8060 dis8060;
+    static ins8070::DisIns8070 dis8070;
+    static mc68000::DisMc68000 dis68000;
+    static mc6800::DisMc6800 dis6800;
+    static mc6805::DisMc6805 dis6805;
+    static mc6809::DisMc6809 dis6809;
+    static mc68hc12::DisMc68HC12 dis6812;
+    static mc68hc16::DisMc68HC16 dis6816;
+    static mn1610::DisMn1610 dis1610;
+    static mos6502::DisMos6502 dis6502;
+    static ns32000::DisNs32000 dis32000;
+    static pdp11::DisPdp11 dispdp11;
+    static pdp8::DisPdp8 dispdp8;
+    static scn2650::DisScn2650 dis2650;
+    static superh::DisSuperH dissuperh;
+    static tlcs90::DisTlcs90 dis90;
+    static tlcs900::DisTlcs900 dis900;
+    static tms320::DisTms320 dis320;
+    static tms320f::DisTms320f dis320f;
+    static tms370::DisTms370 dis370;
+    static tms7000::DisTms7000 dis7000;
+    static tms9900::DisTms9900 dis9900;
+    static z280::DisZ280 disz280;
+    static z380::DisZ380 disz380;
+    static z8000::DisZ8000 disz8000;
+    static z80::DisZ80 disz80;
+    static z8::DisZ8 disz8;
+    static const std::vector<Disassembler *> list{
+            &dis6800,
+            &dis6805,
+            &dis6809,
+            &dis6812,
+            &dis6816,
+            &dis6502,
+            &dis8048,
+            &dis8051,
+            &dis8080,
+            &disz80,
+            &disz280,
+            &disz380,
+            &disz8,
+            &dis90,
+            &dis900,
+            &dis8060,
+            &dis8070,
+            &dis1600,
+            &dis1802,
+            &dis2650,
+            &dis3850,
+            &dispdp8,
+            &dis7000,
+            &dis370,
+            &dis320,
+            &dis320f,
+            &dis8086,
+            &dis8096,
+            &dis68000,
+            &dish16,
+            &dish8300,
+            &dish8500,
+            &dissuperh,
+            &dis9900,
+            &disz8000,
+            &dis32000,
+            &dis1610,
+            &dispdp11,
+    };
+    return list;
+}
+
+}  // namespace cli
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
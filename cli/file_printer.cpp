@@ -23,30 +23,38 @@ namespace cli {
 
 FilePrinter FilePrinter::STDERR{"/dev/stderr", stderr};
 
-FilePrinter::FilePrinter() : _name(), _file(nullptr) {}
+FilePrinter::FilePrinter() : _name(), _file(nullptr), _flush(true) {}
 
 FilePrinter::~FilePrinter() {
     if (_file)
         fclose(_file);
 }
 
-bool FilePrinter::open(const std::string &name) {
+bool FilePrinter::open(const std::string &name, size_t bufferSize) {
+    close();
     _file = fopen(name.c_str(), "w");
-    if (_file)
-        _name = name;
-    return _file != nullptr;
+    if (_file == nullptr)
+        return false;
+    _name = name;
+    _flush = bufferSize == 0;
+    if (!_flush)
+        setvbuf(_file, nullptr, _IOFBF, bufferSize);
+    return true;
 }
 
 void FilePrinter::close() {
     if (_file)
         fclose(_file);
+    _file = nullptr;
 }
 
 void FilePrinter::println(const char *text) {
     if (_file == nullptr)
         return;
-    fprintf(_file, "%s\n", text);
-    fflush(_file);
+    fputs(text, _file);
+    fputc('\n', _file);
+    if (_flush)
+        fflush(_file);
 }
 
 void FilePrinter::format(const char *fmt, ...) {
@@ -56,7 +64,8 @@ void FilePrinter::format(const char *fmt, ...) {
     va_start(args, fmt);
     vfprintf(_file, fmt, args);
     va_end(args);
-    fflush(_file);
+    if (_flush)
+        fflush(_file);
 }
 
 }  // namespace cli
@@ -29,18 +29,25 @@ struct FilePrinter : libasm::driver::TextPrinter {
     FilePrinter();
     ~FilePrinter();
     const std::string &name() const { return _name; }
-    bool open(const std::string &name);
+    /**
+     * Open |name| for output. Each line is flushed unless |bufferSize| is given, in which case
+     * output is fully buffered in a user-space buffer of that size until |close|.
+     */
+    bool open(const std::string &name, size_t bufferSize = 0);
     void close();
     void println(const char *text) override;
     void format(const char *fmt, ...) override;
 
     static FilePrinter STDERR;
+    /** Buffer size for output which is only read after it has been closed */
+    static constexpr size_t BUFFER_SIZE = 64 * 1024;
 
 private:
     std::string _name;
     FILE *_file;
+    bool _flush;
 
-    FilePrinter(const char *name, FILE *file) : _name(name), _file(file) {}
+    FilePrinter(const char *name, FILE *file) : _name(name), _file(file), _flush(true) {}
 };
 
 }  // namespace cli
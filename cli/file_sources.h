@@ -17,17 +17,50 @@
 #ifndef __LIBASM_FILE_SOURCES_H__
 #define __LIBASM_FILE_SOURCES_H__
 
+#include <cstdlib>
 #include <list>
+#include <map>
 #include <memory>
 #include <string>
 
 #include "asm_sources.h"
-#include "file_reader.h"
+#include "text_file.h"
 
 namespace libasm {
 namespace cli {
 
+/**
+ * Source files which are read at the first open and shared by all assembler passes.
+ */
+struct SourceCache final {
+    /** Returns lines of |path|, or nullptr if |path| can't be read. */
+    const TextFile *load(const std::string &path) {
+        const auto key = resolve(path);
+        const auto it = _files.find(key);
+        if (it != _files.end())
+            return it->second.get();
+        auto file = std::make_unique<TextFile>(path);
+        if (!file->open())
+            return nullptr;
+        return (_files[key] = std::move(file)).get();
+    }
+
+private:
+    std::map<std::string, std::unique_ptr<TextFile>> _files;
+
+    static std::string resolve(const std::string &path) {
+        auto *real = realpath(path.c_str(), nullptr);
+        if (real == nullptr)
+            return path;
+        const std::string resolved{real};
+        free(real);
+        return resolved;
+    }
+};
+
 struct FileSources final : driver::AsmSources {
+    FileSources(SourceCache &cache) : _cache(cache) {}
+
     Error open(const StrScanner &name) override {
         if (size() >= max_includes)
             return TOO_MANY_INCLUDE;
@@ -40,25 +73,22 @@ struct FileSources final : driver::AsmSources {
             path = std::string(parent->name().substr(0, pos + 1));
             path.append(name.str(), name.size());
         }
-        _sources.push_back(std::make_unique<FileReader>(path));
-        auto reader = _sources.back().get();
-        if (!reader->open()) {
-            _sources.pop_back();
+        const auto *file = _cache.load(path);
+        if (file == nullptr)
             return NO_INCLUDE_FOUND;
-        }
+        _sources.push_back(std::make_unique<TextFileReader>(path, *file));
         return OK;
     }
 
     Error closeCurrent() override {
-        auto reader = _sources.back().get();
-        reader->close();
         _sources.pop_back();
         return OK;
     }
 
 private:
     static constexpr int max_includes = 4;
-    std::list<std::unique_ptr<FileReader>> _sources;
+    SourceCache &_cache;
+    std::list<std::unique_ptr<TextFileReader>> _sources;
 
     int size() const override { return _sources.size(); }
     driver::TextReader *last() override {
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2026 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace libasm {
+namespace cli {
+
+MappedBinary::MappedBinary(const std::string &name, uint32_t base)
+    : _name(name), _loadAddress(base), _map(MAP_FAILED), _mapSize(0) {
+    _block._base = base;
+    _block._size = 0;
+    _block._data = nullptr;
+}
+
+MappedBinary::~MappedBinary() {
+    close();
+}
+
+bool MappedBinary::open() {
+    close();
+    const auto fd = ::open(_name.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+        const auto ok = read(fd);
+        ::close(fd);
+        return ok;
+    }
+    _mapSize = st.st_size;
+    _map = mmap(nullptr, _mapSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (_map == MAP_FAILED) {
+        _mapSize = 0;
+        const auto ok = read(fd);
+        ::close(fd);
+        return ok;
+    }
+    ::close(fd);
+    return setImage(static_cast<const uint8_t *>(_map), _mapSize);
+}
+
+void MappedBinary::close() {
+    if (_map != MAP_FAILED)
+        munmap(_map, _mapSize);
+    _map = MAP_FAILED;
+    _mapSize = 0;
+    _buffer.clear();
+    _block._base = _loadAddress;
+    _block._size = 0;
+    _block._data = nullptr;
+}
+
+bool MappedBinary::read(int fd) {
+    uint8_t buf[4096];
+    ssize_t len;
+    while ((len = ::read(fd, buf, sizeof(buf))) > 0)
+        _buffer.insert(_buffer.end(), buf, buf + len);
+    if (len < 0)
+        return false;
+    return setImage(_buffer.data(), _buffer.size());
+}
+
+bool MappedBinary::setImage(const uint8_t *data, size_t size) {
+    if (size > UINT32_MAX || (size && _loadAddress > UINT32_MAX - (size - 1)))
+        return false;
+    _block._base = _loadAddress;
+    _block._size = size;
+    _block._data = data;
+    return true;
+}
+
+void MappedBinary::setRange(uint32_t start, uint32_t end) {
+    if (end < start || _block._size == 0)
+        return;
+    if (start > endAddress() || end < startAddress()) {
+        _block._size = 0;
+        return;
+    }
+    if (start > _block._base) {
+        const auto skip = start - _block._base;
+        _block._base = start;
+        _block._size -= skip;
+        _block._data += skip;
+    }
+    if (end < endAddress())
+        _block._size = end - _block._base + 1;
+}
+
+}  // namespace cli
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2026 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LIBASM_MAPPED_FILE_H__
+#define __LIBASM_MAPPED_FILE_H__
+
+#include "bin_reader.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace libasm {
+namespace cli {
+
+/**
+ * Raw binary image which is mapped into memory and loaded at |base| address.
+ *
+ * The whole image is presented as a single |BinReader::Block| which points into the read-only
+ * mapping, so that nothing is copied. A file which can't be mapped, such as a pipe, is read into
+ * an owned buffer instead.
+ */
+struct MappedBinary final : driver::BinReader {
+    MappedBinary(const std::string &name, uint32_t base);
+    ~MappedBinary();
+    const std::string &name() const { return _name; }
+    /** Returns false if the file can't be read or doesn't fit in 32-bit address space */
+    bool open();
+    void close();
+
+    uint32_t startAddress() const { return _block._base; }
+    /** Returns the last address of the image, or |startAddress()| when the image is empty */
+    uint32_t endAddress() const { return _block._base + (_block._size ? _block._size - 1 : 0); }
+    /** Restrict the image to |start| and |end| address inclusive. */
+    void setRange(uint32_t start, uint32_t end);
+
+    const BinReader::Block *begin() const override { return _block._size ? &_block : nullptr; }
+
+private:
+    struct Block final : BinReader::Block {
+        uint32_t base() const override { return _base; }
+        uint32_t size() const override { return _size; }
+        const uint8_t *data() const override { return _data; }
+        const BinReader::Block *next() const override { return nullptr; }
+        BinReader::ByteReader reader() const override {
+            return BinReader::ByteReader{_base, _size, _data};
+        }
+
+        uint32_t _base;
+        uint32_t _size;
+        const uint8_t *_data;
+    };
+
+    const std::string _name;
+    const uint32_t _loadAddress;
+    void *_map;
+    size_t _mapSize;
+    std::vector<uint8_t> _buffer;
+    Block _block;
+
+    bool read(int fd);
+    bool setImage(const uint8_t *data, size_t size);
+};
+
+}  // namespace cli
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2026 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "text_file.h"
+#include "file_reader.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+
+namespace libasm {
+namespace cli {
+
+TextFile::TextFile(const std::string &name) : _name(name) {}
+
+bool TextFile::open() {
+    close();
+    const auto fd = ::open(_name.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    const auto regular = fstat(fd, &st) == 0 && S_ISREG(st.st_mode);
+    const auto ok = regular ? read(fd, st.st_size) : read();
+    ::close(fd);
+    if (ok)
+        split();
+    return ok;
+}
+
+void TextFile::close() {
+    _buffer.clear();
+    _lines.clear();
+}
+
+bool TextFile::read(int fd, size_t size) {
+    _buffer.resize(size);
+    size_t pos = 0;
+    while (pos < size) {
+        const auto len = ::read(fd, &_buffer[pos], size - pos);
+        if (len < 0)
+            return false;
+        if (len == 0)
+            break;
+        pos += len;
+    }
+    _buffer.resize(pos);
+    return true;
+}
+
+bool TextFile::read() {
+    FileReader reader{_name};
+    if (!reader.open())
+        return false;
+    StrScanner *line;
+    while ((line = reader.readLine()) != nullptr) {
+        _buffer.append(line->str(), line->size());
+        _buffer.push_back('\n');
+    }
+    return true;
+}
+
+void TextFile::split() {
+    if (!_buffer.empty() && _buffer.back() != '\n')
+        _buffer.push_back('\n');
+    auto *p = &_buffer[0];
+    const auto *end = p + _buffer.size();
+    while (p < end) {
+        auto *eol = static_cast<char *>(memchr(p, '\n', end - p));
+        auto *next = eol + 1;
+        if (eol > p && eol[-1] == '\r')
+            --eol;
+        *eol = 0;
+        _lines.emplace_back(p, eol);
+        p = next;
+    }
+}
+
+}  // namespace cli
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2026 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LIBASM_TEXT_FILE_H__
+#define __LIBASM_TEXT_FILE_H__
+
+#include "text_reader.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace libasm {
+namespace cli {
+
+/**
+ * Text file which is read into memory at once and split into lines.
+ *
+ * Each line is a StrScanner which points into the owned buffer. The end of line, "\n" or "\r\n",
+ * is overwritten by NUL, because Assembler::encode() and error messages treat a line as a
+ * C-string. A file which isn't a regular file, such as a pipe, is read by |FileReader|.
+ */
+struct TextFile final {
+    TextFile(const std::string &name);
+    const std::string &name() const { return _name; }
+    bool open();
+    void close();
+
+    size_t lines() const { return _lines.size(); }
+    const StrScanner &line(size_t index) const { return _lines[index]; }
+
+private:
+    const std::string _name;
+    std::string _buffer;
+    std::vector<StrScanner> _lines;
+
+    bool read(int fd, size_t size);
+    bool read();
+    void split();
+};
+
+/**
+ * TextReader which reads lines of |TextFile|.
+ */
+struct TextFileReader final : driver::TextReader {
+    TextFileReader(const std::string &name, const TextFile &file)
+        : _name(name), _file(file), _lineno(0) {}
+
+    const std::string &name() const override { return _name; }
+    int lineno() const override { return _lineno; }
+    StrScanner *readLine() override {
+        if (static_cast<size_t>(_lineno) >= _file.lines())
+            return nullptr;
+        _line = _file.line(_lineno++);
+        return &_line;
+    }
+
+private:
+    const std::string _name;
+    const TextFile &_file;
+    int _lineno;
+    StrScanner _line;
+};
+
+}  // namespace cli
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -26,7 +26,7 @@
 namespace libasm {
 namespace driver {
 
-AsmDirective::AsmDirective(Assembler &a) : ErrorAt(), _assembler(a) {
+AsmDirective::AsmDirective(Assembler &a) : ErrorAt(), _assembler(&a) {
     registerPseudo(".cpu", &AsmDirective::switchCpu);
     registerPseudo(".include", &AsmDirective::includeFile);
     // TODO: implement listing after "end".
@@ -37,51 +37,60 @@ AsmDirective::AsmDirective(Assembler &a) : ErrorAt(), _assembler(a) {
 }
 
 bool AsmDirective::setCpu(const char *cpu) {
-    return _assembler.setCpu(cpu);
+    return _assembler->setCpu(cpu);
 }
 
 const /*PROGMEM*/ char *AsmDirective::cpu_P() const {
-    return _assembler.config().cpu_P();
+    return _assembler->config().cpu_P();
 }
 
 const /*PROGMEM*/ char *AsmDirective::listCpu_P() const {
-    return _assembler.config().listCpu_P();
+    return _assembler->config().listCpu_P();
 }
 
 void AsmDirective::reset(CpuSwitcher &switcher) {
-    _assembler.reset();
+    _assembler->reset();
     _switcher = &switcher;
 }
 
+void AsmDirective::save() {
+    _saved.reset(_assembler->clone());
+}
+
+void AsmDirective::restore() {
+    _restored.reset(_saved->clone());
+    _assembler = _restored.get();
+}
+
 void AsmDirective::setOption(const char *name, const char *value) {
-    _assembler.setOption(name, value);
+    _assembler->setOption(name, value);
 }
 
 const Options &AsmDirective::commonOptions() const {
-    return _assembler.commonOptions();
+    return _assembler->commonOptions();
 }
 
 const Options &AsmDirective::options() const {
-    return _assembler.options();
+    return _assembler->options();
 }
 
 const ConfigBase &AsmDirective::config() const {
-    return _assembler.config();
+    return _assembler->config();
 }
 
 Radix AsmDirective::listRadix() const {
-    return _assembler.listRadix();
+    return _assembler->listRadix();
 }
 
 uint32_t AsmDirective::currentLocation() const {
-    return _assembler.currentLocation();
+    return _assembler->currentLocation();
 }
 
 Error AsmDirective::encode(StrScanner &scan, Insn &insn, Context &context) {
     setOK();
-    _assembler.setCurrentLocation(insn.address());
+    _assembler->setCurrentLocation(insn.address());
 
-    const auto &parser = _assembler.parser();
+    const auto &parser = _assembler->parser();
     auto p = scan;
     if (parser.commentLine(p))
         return OK;
@@ -112,8 +121,11 @@ Error AsmDirective::encode(StrScanner &scan, Insn &insn, Context &context) {
     if (parser.endOfLine(scan))
         return setOK();  // skip comment
 
-    _assembler.encode(scan.str(), insn, &context.symbols);
+    _assembler->encode(scan.str(), insn, &context.symbols);
     setError(insn);
+    // A line which generates nothing may be a pseudo which changes assembler state.
+    if (insn.length() == 0)
+        context.stateChanged = true;
 
     error = getError();
     const auto allowUndef = !context.reportUndefined && error == UNDEFINED_SYMBOL;
@@ -165,7 +177,7 @@ Error AsmDirective::setVariable(StrScanner &scan, Context &context) {
         return setError(ILLEGAL_LABEL);
     auto p = scan;
     StrScanner symbol;
-    if (_assembler.parser().readSymbol(p, symbol) != OK)
+    if (_assembler->parser().readSymbol(p, symbol) != OK)
         return setError(p, MISSING_LABEL);
     if (!p.skipSpaces().expect(','))
         return setError(p, MISSING_COMMA);
@@ -186,9 +198,9 @@ Error AsmDirective::defineSymbol(
             return setError(symbol, DUPLICATE_LABEL);
     }
 
-    auto parserCtx = _assembler.parserContext(&context.symbols);
+    auto parserCtx = _assembler->parserContext(&context.symbols);
     ErrorAt error;
-    context.value = _assembler.parser().eval(scan, error, parserCtx);
+    context.value = _assembler->parser().eval(scan, error, parserCtx);
     if (error.hasError()) {
         context.value.clear();
         return setError(scan, error);
@@ -197,6 +209,7 @@ Error AsmDirective::defineSymbol(
         return setError(error);
 
     setErrorIf(symbol, context.symbols.internSymbol(context.value, symbol, variable));
+    context.stateChanged = variable;
     return getError();
 }
 
@@ -225,7 +238,7 @@ Error AsmDirective::defineFunction(StrScanner &scan, Context &context) {
     if (name.size() == 0)
         return setError(MISSING_LABEL);
 
-    const auto &parser = _assembler.parser();
+    const auto &parser = _assembler->parser();
     FunctionStore::Parameters params;
     for (;;) {
         auto p = scan.skipSpaces();
@@ -255,6 +268,7 @@ Error AsmDirective::switchCpu(StrScanner &scan, Context &context) {
     std::string cpu(name.str(), name.size());
     if (!_switcher->setCpu(cpu.c_str()))
         return setError(UNSUPPORTED_CPU);
+    context.stateChanged = true;
     return setOK();
 }
 
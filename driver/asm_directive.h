@@ -18,6 +18,7 @@
 #define __LIBASM_ASM_DIRECTIVE_H__
 
 #include <map>
+#include <memory>
 #include <string>
 
 #include "asm_base.h"
@@ -42,11 +43,16 @@ struct AsmDirective : ErrorAt {
     const /*PROGMEM*/ char *cpu_P() const;
     const /*PROGMEM*/ char *listCpu_P() const;
     const ConfigBase &config() const;
+    const Assembler &assembler() const { return *_assembler; }
     const Options &commonOptions() const;
     const Options &options() const;
 
     void reset(CpuSwitcher &switcher);
     void setOption(const char *name, const char *value);
+    /** Save a copy of the assembler as the initial state of a session */
+    void save();
+    /** Replace the assembler with a copy of the one saved by |save| */
+    void restore();
     Radix listRadix() const;
     uint32_t currentLocation() const;
 
@@ -55,13 +61,16 @@ struct AsmDirective : ErrorAt {
             : sources(_sources),
               symbols(_symbols),
               reportDuplicate(!_reportError),
-              reportUndefined(_reportError) {}
+              reportUndefined(_reportError),
+              stateChanged(false) {}
         AsmSources &sources;
         SymbolStore &symbols;
         const bool reportDuplicate;
         const bool reportUndefined;
         StrScanner label;
         Value value;
+        /** true if the line may affect encoding of other lines, other than labels/constants */
+        bool stateChanged;
     };
 
     Error encode(StrScanner &scan, Insn &insn, Context &context);
@@ -69,8 +78,11 @@ struct AsmDirective : ErrorAt {
     virtual BinEncoder &defaultEncoder() const;
 
 protected:
-    Assembler &_assembler;
+    /** The assembler given to the constructor, or a copy of |_saved| after |restore| */
+    Assembler *_assembler;
     CpuSwitcher *_switcher;
+    std::unique_ptr<Assembler> _saved;
+    std::unique_ptr<Assembler> _restored;
 
     using PseudoHandler = Error (AsmDirective::*)(StrScanner &scan, Context &context);
     struct icasecmp {
@@ -20,12 +20,30 @@
 #include "asm_directive.h"
 #include "asm_formatter.h"
 #include "asm_sources.h"
+#include "bin_memory.h"
+#include "stats.h"
+#include "stored_printer.h"
 
 namespace libasm {
 namespace driver {
 
 AsmDriver::AsmDriver(std::initializer_list<AsmDirective *> directives)
-    : _directives(directives), _current(nullptr), _symbols(), _origin(0) {
+    : AsmDriver(std::vector<AsmDirective *>(directives)) {}
+
+AsmDriver::AsmDriver(const std::vector<AsmDirective *> &directives)
+    : _directives(directives.begin(), directives.end()),
+      _current(nullptr),
+      _symbols(),
+      _origin(0),
+      _options(0),
+      _saved(false),
+      _initial(nullptr),
+      _initialOptions(0),
+      _resolvable(false),
+      _incremental(false),
+      _pass(0),
+      _reused(0),
+      _unknown(0) {
     _current = _directives.front();
     setUpperHex(true);
     setLineNumber(false);
@@ -53,8 +71,87 @@ void filter(const char *text, std::list<std::string> &list) {
     }
 }
 
+constexpr uint64_t HASH_SEED = UINT64_C(0xcbf29ce484222325);
+
+/** FNV-1a hash of |size| bytes at |data| following |hash|. */
+uint64_t hashOf(uint64_t hash, const void *data, size_t size) {
+    const auto *p = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; i++)
+        hash = (hash ^ p[i]) * UINT64_C(0x100000001b3);
+    return hash;
+}
+
+uint64_t hashOf(uint64_t hash, const char *text) {
+    // Include the terminating NUL to separate concatenated texts.
+    return hashOf(hash, text, strlen(text) + 1);
+}
+
+template <typename T>
+uint64_t hashOf(uint64_t hash, const T &value) {
+    return hashOf(hash, &value, sizeof(value));
+}
+
 }  // namespace
 
+/** Delegates to |SymbolStoreImpl| and records symbols which a line refers. */
+struct AsmDriver::Recorder final : SymbolStore {
+    Recorder(SymbolStoreImpl &_store) : store(_store), memoizable(true), function(false) {}
+
+    SymbolStoreImpl &store;
+    /** false if the line refers an undefined symbol or a function */
+    mutable bool memoizable;
+    mutable std::vector<std::pair<std::string, Value>> symbols;
+    /** true if the line defines a function */
+    bool function;
+
+    // SymbolTable
+    const char *lookupValue(const Value &value) const override { return store.lookupValue(value); }
+    bool hasSymbol(const StrScanner &name) const override { return store.hasSymbol(name); }
+    const Value *lookupSymbol(const StrScanner &symbol) const override {
+        const auto value = store.lookupSymbol(symbol);
+        if (value == nullptr || value->isUndefined()) {
+            memoizable = false;
+        } else {
+            symbols.emplace_back(std::string(symbol.str(), symbol.size()), *value);
+        }
+        return value;
+    }
+    const Functor *lookupFunction(const StrScanner &name) const override {
+        const auto fn = store.lookupFunction(name);
+        if (fn)
+            memoizable = false;
+        return fn;
+    }
+
+    // SymbolStore
+    bool hasValue(const StrScanner &symbol, bool variable) const override {
+        return store.hasValue(symbol, variable);
+    }
+    Error internSymbol(const Value &value, const StrScanner &symbol, bool variable) override {
+        return store.internSymbol(value, symbol, variable);
+    }
+    bool hasFunction(const StrScanner &name) const override { return store.hasFunction(name); }
+    Error internFunction(const StrScanner &name, const FunctionStore::Parameters &params,
+            const StrScanner &body, const ValueParser &parser) override {
+        function = true;
+        return store.internFunction(name, params, body, parser);
+    }
+};
+
+AsmDriver::Key::Key(const StrScanner &_line, const AsmDirective *_directive, uint32_t _origin,
+        uint64_t _state)
+    : line(_line), directive(_directive), origin(_origin), state(_state) {
+    hash = hashOf(HASH_SEED, line.str(), line.size());
+    hash = hashOf(hash, directive);
+    hash = hashOf(hash, origin);
+    hash = hashOf(hash, state);
+}
+
+bool AsmDriver::Record::matches(const Key &key) const {
+    return origin == key.origin && state == key.state && directive == key.directive &&
+           line.size() == key.line.size() && memcmp(line.data(), key.line.str(), line.size()) == 0;
+}
+
 std::list<std::string> AsmDriver::listCpu() const {
     char buffer[80];
     std::list<std::string> list;
@@ -70,6 +167,9 @@ bool AsmDriver::setCpu(const char *cpu) {
     for (auto dir : _directives) {
         if (dir->setCpu(cpu)) {
             _current = dir;
+            _options = hashOf(_options, cpu);
+            if (_saved && std::find(_used.begin(), _used.end(), dir) == _used.end())
+                _used.push_back(dir);
             return true;
         }
     }
@@ -94,6 +194,9 @@ void AsmDriver::setLineNumber(bool lineNumber) {
 }
 
 void AsmDriver::reset() {
+    _options = HASH_SEED;
+    _saved = false;
+    _current = _directives.front();
     symbols().clearFunctions();
     for (auto dir : _directives) {
         dir->reset(*this);
@@ -101,14 +204,45 @@ void AsmDriver::reset() {
 }
 
 void AsmDriver::setOption(const char *name, const char *value) {
+    _options = hashOf(hashOf(_options, name), value);
     for (auto dir : _directives) {
         dir->setOption(name, value);
     }
 }
 
+void AsmDriver::save() {
+    _saved = true;
+    for (auto dir : _directives)
+        dir->save();
+    _initial = _current;
+    _initialOptions = _options;
+    _used.clear();
+    _used.push_back(_current);
+}
+
+void AsmDriver::restore() {
+    if (!_saved) {
+        reset();
+        return;
+    }
+    symbols().clearFunctions();
+    for (auto dir : _used)
+        dir->restore();
+    _current = _initial;
+    _options = _initialOptions;
+    _used.clear();
+    _used.push_back(_current);
+}
+
 int AsmDriver::assemble(AsmSources &sources, BinMemory &memory, TextPrinter &listout,
         TextPrinter &errorout, bool reportError) {
     _origin = 0;
+    _fixups.clear();
+    // Fixups are meaningful only when all symbols are defined by this pass.
+    _resolvable = !reportError && _symbols.empty();
+    ++_pass;
+    _reused = 0;
+    auto state = _options;
 
     char buffer[256];
     StrBuffer out{buffer, sizeof(buffer)};
@@ -117,42 +251,229 @@ int AsmDriver::assemble(AsmSources &sources, BinMemory &memory, TextPrinter &lis
     formatter.setLineNumber(_lineNumber);
 
     int errors = 0;
+    size_t lines = 0;
+    size_t listLines = 0;
+    const auto readLine = [&sources]() {
+        const stats::Timer timer{stats::READ_NANOS};
+        return sources.readLine();
+    };
     StrScanner *line;
-    while ((line = sources.readLine()) != nullptr) {
+    while ((line = readLine()) != nullptr) {
+        ++lines;
         auto &directive = *current();
         auto &insn = formatter.insn();
-        insn.reset(_origin);
-        AsmDirective::Context context{sources, _symbols, reportError};
-        auto scan = *line;
-        auto error = directive.encode(scan, insn, context);
+        const auto origin = _origin;
+        insn.reset(origin);
+        Recorder recorder{_symbols};
+        auto &store = _incremental ? static_cast<SymbolStore &>(recorder) : _symbols;
+        AsmDirective::Context context{sources, store, reportError};
+        const auto key = _incremental ? Key(*line, &directive, origin, state) : Key();
+        const auto unresolved = _symbols.unresolved();
+        const ErrorAt replayed;
+        const ErrorAt *status = &directive;
+        auto error = OK;
+        {
+            const stats::Timer timer{stats::ENCODE_NANOS};
+            if (_incremental && replay(key, insn, context)) {
+                status = &replayed;
+                ++_reused;
+            } else {
+                auto scan = *line;
+                error = directive.encode(scan, insn, context);
+            }
+        }
 
         const auto &config = directive.config();
         const auto unit = config.addressUnit();  // assembler may be swiched
         const auto base = insn.address() * unit;
-        for (auto offset = 0; offset < insn.length(); offset++) {
-            memory.writeByte(base + offset, insn.bytes()[offset]);
-        }
+        memory.write(base, insn.bytes(), insn.length());
         _origin = insn.address() + insn.length() / unit;
         if (insn.length() == 0)
             _origin = directive.currentLocation();
 
-        formatter.set(*line, directive, config, &context.value);
+        formatter.set(*line, *status, config, &context.value);
         formatter.setListRadix(directive.listRadix());
         if (formatter.hasError())
             ++errors;
-        while (formatter.hasNextLine()) {
-            listout.println(formatter.getLine(out).str());
-            if (formatter.hasError())
-                errorout.println(out.str());
+        if (_resolvable) {
+            if (formatter.hasError()) {
+                _resolvable = false;
+            } else if (_symbols.unresolved() != unresolved) {
+                // A fixup must not affect locations and meanings of other lines.
+                if (insn.length() == 0 || context.stateChanged) {
+                    _resolvable = false;
+                } else {
+                    _fixups.emplace_back(Fixup{&directive, origin, state, insn.address(),
+                            insn.length(), std::string(line->str(), line->size()),
+                            formatter.location(), listLines, 0});
+                }
+            } else if (context.stateChanged && !_fixups.empty()) {
+                // A fixup will be re-encoded with the state at the end of pass.
+                _resolvable = false;
+            }
+        }
+        const auto listLine = listLines;
+        {
+            const stats::Timer timer{stats::LIST_NANOS};
+            while (formatter.hasNextLine()) {
+                listout.println(formatter.getLine(out).str());
+                ++listLines;
+                if (formatter.hasError())
+                    errorout.println(out.str());
+            }
+        }
+        if (_resolvable && !_fixups.empty() && _fixups.back().listLine == listLine)
+            _fixups.back().listLines = listLines - listLine;
+        if (_incremental && status == &directive) {
+            // Only a line which generates nothing may change assembler state. Functions are
+            // defined in the same order by every pass.
+            if (context.stateChanged || recorder.function) {
+                state = nextState(state, key, recorder);
+            } else if (error == OK && insn.length() && recorder.memoizable) {
+                memoize(key, insn, context, recorder);
+            }
         }
         if (error == END_ASSEMBLE)
             break;
     }
     while (sources.nest())
         sources.closeCurrent();
+    if (_incremental)
+        evictRecords(lines);
     return errors;
 }
 
+bool AsmDriver::resolveFixups(AsmSources &sources, BinMemory &memory, StoredPrinter *listout) {
+    const stats::Timer timer{stats::FIXUP_NANOS};
+    if (!_resolvable)
+        return false;
+
+    char buffer[256];
+    StrBuffer out{buffer, sizeof(buffer)};
+    AsmFormatter formatter{sources};
+    formatter.setUpperHex(_upperHex);
+    formatter.setLineNumber(_lineNumber);
+
+    for (auto &fixup : _fixups) {
+        auto &directive = *fixup.directive;
+        auto &insn = formatter.insn();
+        insn.reset(fixup.origin);
+        Recorder recorder{_symbols};
+        auto &store = _incremental ? static_cast<SymbolStore &>(recorder) : _symbols;
+        AsmDirective::Context context{sources, store};
+        StrScanner line{fixup.line.c_str()};
+        const auto key = _incremental ? Key(line, &directive, fixup.origin, fixup.state) : Key();
+        const ErrorAt replayed;
+        const ErrorAt *status = &directive;
+        if (_incremental && replay(key, insn, context)) {
+            status = &replayed;
+        } else {
+            auto scan = line;
+            directive.encode(scan, insn, context);
+        }
+        formatter.set(line, *status, directive.config(), &context.value, &fixup.location);
+        formatter.setListRadix(directive.listRadix());
+        if (formatter.hasError() || insn.address() != fixup.address ||
+                insn.length() != fixup.length)
+            return false;
+        if (_incremental && status == &directive && recorder.memoizable)
+            memoize(key, insn, context, recorder);
+        fixup.bytes.assign(insn.bytes(), insn.bytes() + insn.length());
+        fixup.list.clear();
+        while (formatter.hasNextLine())
+            fixup.list.emplace_back(formatter.getLine(out).str());
+        if (fixup.list.size() != fixup.listLines)
+            return false;
+    }
+
+    for (const auto &fixup : _fixups) {
+        const auto unit = fixup.directive->config().addressUnit();
+        const auto base = fixup.address * unit;
+        memory.write(base, fixup.bytes.data(), fixup.bytes.size());
+        for (size_t i = 0; listout && i < fixup.list.size(); i++)
+            listout->replace(fixup.listLine + i + 1, fixup.list[i]);
+    }
+    _fixups.clear();
+    return true;
+}
+
+void AsmDriver::setIncremental(bool enable) {
+    _incremental = enable;
+    if (!enable)
+        _records.clear();
+}
+
+bool AsmDriver::replay(const Key &key, Insn &insn, AsmDirective::Context &context) {
+    const auto it = _records.find(key.hash);
+    if (it == _records.end() || !it->second.matches(key))
+        return false;
+    auto &record = it->second;
+    const StrScanner label{record.label.c_str()};
+    if (label.size() && context.reportDuplicate && _symbols.hasSymbol(label))
+        return false;
+    // A label is defined at the origin before its line is encoded.
+    Value origin;
+    origin.setUnsigned(key.origin);
+    for (const auto &symbol : record.symbols) {
+        const auto value = symbol.first == record.label
+                                   ? &origin
+                                   : _symbols.findSymbol(StrScanner{symbol.first.c_str()});
+        if (value == nullptr || !(*value == symbol.second))
+            return false;
+    }
+    if (label.size())
+        context.symbols.internSymbol(origin, label);
+    insn.setAddress(record.address);
+    for (const auto data : record.bytes)
+        insn.emitByte(data);
+    record.pass = _pass;
+    return true;
+}
+
+void AsmDriver::memoize(const Key &key, const Insn &insn, const AsmDirective::Context &context,
+        const Recorder &recorder) {
+    auto &record = _records[key.hash];
+    record.line.assign(key.line.str(), key.line.size());
+    record.directive = key.directive;
+    record.origin = key.origin;
+    record.state = key.state;
+    record.address = insn.address();
+    record.bytes.assign(insn.bytes(), insn.bytes() + insn.length());
+    record.label.assign(context.label.str(), context.label.size());
+    record.symbols = std::move(recorder.symbols);
+    record.pass = _pass;
+}
+
+uint64_t AsmDriver::nextState(uint64_t state, const Key &key, const Recorder &recorder) {
+    // The effect of a line which refers an undefined symbol or a function is unknown.
+    if (!recorder.memoizable)
+        return hashOf(state, ++_unknown);
+    // A line may switch CPU, which is encoded by any directive to the same state.
+    state = hashOf(state, key.line.str(), key.line.size());
+    state = hashOf(state, current());
+    state = hashOf(state, key.origin);
+    for (const auto &symbol : recorder.symbols) {
+        const auto &value = symbol.second;
+        if (value.isFloat())
+            return hashOf(state, ++_unknown);
+        state = hashOf(hashOf(state, value.isSigned()), value.getInteger());
+    }
+    return state;
+}
+
+void AsmDriver::evictRecords(size_t lines) {
+    // Records of edited lines are left unused; drop them once the table has grown.
+    if (_records.size() <= 2 * lines)
+        return;
+    for (auto it = _records.begin(); it != _records.end();) {
+        if (it->second.pass + KEEP_PASSES < _pass) {
+            it = _records.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 }  // namespace driver
 }  // namespace libasm
 
@@ -17,10 +17,16 @@
 #ifndef __LIBASM_ASM_DRIVER_H__
 #define __LIBASM_ASM_DRIVER_H__
 
+#include <cstdint>
 #include <initializer_list>
 #include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "asm_directive.h"
+#include "asm_formatter.h"
 #include "error_reporter.h"
 #include "str_scanner.h"
 #include "symbol_store.h"
@@ -31,9 +37,11 @@ namespace driver {
 
 struct AsmSources;
 struct BinMemory;
+struct StoredPrinter;
 
 struct AsmDriver final : CpuSwitcher {
     AsmDriver(std::initializer_list<AsmDirective *> directives);
+    AsmDriver(const std::vector<AsmDirective *> &directives);
 
     bool restrictCpu(const char *cpu);
     bool setCpu(const char *cpu) override;
@@ -42,11 +50,47 @@ struct AsmDriver final : CpuSwitcher {
 
     void setUpperHex(bool upperHex);
     void setLineNumber(bool enable);
+    /** Reset all directives and select the first one */
     void reset();
     void setOption(const char *name, const char *value);
 
+    /**
+     * Save copies of assemblers configured by CPU and options set since |reset| as the initial
+     * state of a session.
+     */
+    void save();
+    /**
+     * Restore the state saved by |save| before assembling another pass or source. Only
+     * directives which have been selected since the last |save| or |restore| are restored.
+     */
+    void restore();
+
+    /**
+     * Assemble |sources| into |memory|. When |reportError| is false and no symbol is defined yet,
+     * lines which refer unresolved symbols are recorded as fixups to be resolved by
+     * |resolveFixups|.
+     */
     int assemble(AsmSources &sources, BinMemory &memory, TextPrinter &listout,
             TextPrinter &errorout, bool reportError = true);
+    /**
+     * Re-encode lines recorded as fixups by the last |assemble| with all symbols defined, and
+     * patch |memory| and |listout| unless it is null. Returns false and patches nothing when
+     * another pass is necessary; a fixup changed its length or has an error, or some line may
+     * change the meaning of fixups.
+     */
+    bool resolveFixups(AsmSources &sources, BinMemory &memory, StoredPrinter *listout = nullptr);
+
+    /**
+     * Enable incremental assembly. Lines which generate bytes are memoized across |assemble|
+     * calls, and a line is re-encoded only when its text, location, preceding assembler state or
+     * values of symbols it refers differ from the memoized one. Disabling discards memoized lines.
+     * Only encoding is saved; every line is still read, keyed and listed, so that a run takes
+     * time proportional to the whole source even for a one line edit. Resuming from the first
+     * changed line would need snapshots of symbols and directive states, which don't exist.
+     */
+    void setIncremental(bool enable);
+    /** Number of lines which the last |assemble| took from memoized ones */
+    size_t reusedLines() const { return _reused; }
 
     auto begin() const { return _directives.cbegin(); }
     auto end() const { return _directives.cend(); }
@@ -62,6 +106,73 @@ private:
     uint32_t _origin;
     bool _upperHex;
     bool _lineNumber;
+    /** Hash of CPU and options set since |reset| */
+    uint64_t _options;
+
+    bool _saved;
+    AsmDirective *_initial;
+    uint64_t _initialOptions;
+    /** Directives which may have changed from the saved state */
+    std::vector<AsmDirective *> _used;
+
+    struct Fixup {
+        AsmDirective *directive;
+        uint32_t origin;
+        uint64_t state;
+        uint32_t address;
+        uint8_t length;
+        std::string line;
+        AsmFormatter::Location location;
+        size_t listLine;
+        size_t listLines;
+        std::vector<uint8_t> bytes;
+        std::vector<std::string> list;
+    };
+    std::list<Fixup> _fixups;
+    bool _resolvable;
+
+    /** A line and the state which the line is assembled with */
+    struct Key {
+        Key() : directive(nullptr), origin(0), state(0), hash(0) {}
+        Key(const StrScanner &line, const AsmDirective *directive, uint32_t origin,
+                uint64_t state);
+        StrScanner line;
+        const AsmDirective *directive;
+        uint32_t origin;
+        /** Hash of lines which may change assembler state so far */
+        uint64_t state;
+        uint64_t hash;
+    };
+    /** Encoded bytes of a line and values of symbols which the encoding depends on */
+    struct Record {
+        std::string line;
+        const AsmDirective *directive;
+        uint32_t origin;
+        uint64_t state;
+        uint32_t address;
+        std::vector<uint8_t> bytes;
+        std::string label;
+        std::vector<std::pair<std::string, Value>> symbols;
+        /** The last pass which used this */
+        uint32_t pass;
+        bool matches(const Key &key) const;
+    };
+    struct Recorder;
+    /** Number of passes which an unused record survives */
+    static constexpr uint32_t KEEP_PASSES = 4;
+    bool _incremental;
+    /** Records keyed by |Key::hash|, a colliding one replaces the other */
+    std::unordered_map<uint64_t, Record> _records;
+    uint32_t _pass;
+    size_t _reused;
+    /** Serial number to make a state which never matches */
+    uint64_t _unknown;
+
+    bool replay(const Key &key, Insn &insn, AsmDirective::Context &context);
+    void memoize(const Key &key, const Insn &insn, const AsmDirective::Context &context,
+            const Recorder &recorder);
+    uint64_t nextState(uint64_t state, const Key &key, const Recorder &recorder);
+    void evictRecords(size_t lines);
 };
 
 }  // namespace driver
@@ -27,7 +27,7 @@ namespace libasm {
 namespace driver {
 
 AsmFormatter::AsmFormatter(AsmSources &sources)
-    : _sources(sources), _formatter(*this), _insn(0), _lineNumber(false) {}
+    : _sources(sources), _formatter(*this), _insn(0), _lineNumber(false), _location(nullptr) {}
 
 void AsmFormatter::setUpperHex(bool upperHex) {
     _formatter.setUpperHex(upperHex);
@@ -41,12 +41,17 @@ void AsmFormatter::setLineNumber(bool enable) {
     _lineNumber = enable;
 }
 
+AsmFormatter::Location AsmFormatter::location() {
+    return Location{name(), lineno(), nest()};
+}
+
 void AsmFormatter::set(const StrScanner &line, const ErrorAt &error, const ConfigBase &config,
-        const Value *value) {
+        const Value *value, const Location *location) {
     _line = line;
     _error.setError(error);
     _value = value;
     _config = &config;
+    _location = location;
     _errorLine = _error.getError();
     _nextLine = -1;
 }
@@ -64,9 +69,8 @@ StrBuffer &AsmFormatter::getLine(StrBuffer &out) {
     if (_errorLine) {
         _errorLine = false;
         // TODO: In file included from...
-        auto reader = _sources.current();
-        out.rtext(reader->name().c_str()).letter(':');
-        _formatter.formatDec(out, reader->lineno());
+        out.rtext(name().c_str()).letter(':');
+        _formatter.formatDec(out, lineno());
         const auto *line = _line.str();
         const auto *line_end = line + _line.size();
         const auto *at = _error.errorAt();
@@ -104,7 +108,7 @@ StrBuffer &AsmFormatter::getLine(StrBuffer &out) {
 void AsmFormatter::formatLineNumber(StrBuffer &out) {
     // Only the first has "(nest) lineno/"
     if (_nextLine <= 0) {
-        const auto include_nest = _sources.nest();
+        const auto include_nest = nest();
         if (include_nest > 1) {
             out.letter('(');
             _formatter.formatDec(out, include_nest - 1);
@@ -113,7 +117,7 @@ void AsmFormatter::formatLineNumber(StrBuffer &out) {
             _formatter.outSpaces(out, 3);
         }
         if (_lineNumber) {
-            _formatter.formatDec(out, _sources.current()->lineno(), 5);
+            _formatter.formatDec(out, lineno(), 5);
             out.letter('/');
         }
     } else {
@@ -121,6 +125,18 @@ void AsmFormatter::formatLineNumber(StrBuffer &out) {
     }
 }
 
+const std::string &AsmFormatter::name() {
+    return _location ? _location->name : _sources.current()->name();
+}
+
+int AsmFormatter::lineno() {
+    return _location ? _location->lineno : _sources.current()->lineno();
+}
+
+int AsmFormatter::nest() {
+    return _location ? _location->nest : _sources.nest();
+}
+
 }  // namespace driver
 }  // namespace libasm
 
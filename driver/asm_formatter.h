@@ -24,11 +24,11 @@
 #include "value.h"
 
 #include <cstdint>
+#include <string>
 
 namespace libasm {
 namespace driver {
 
-struct Assembler;
 struct BinMemory;
 
 struct AsmFormatter final : ListFormatter::Provider {
@@ -38,8 +38,16 @@ struct AsmFormatter final : ListFormatter::Provider {
     void setListRadix(Radix listRadix);
     void setLineNumber(bool enable);
 
+    /** Source location of a line, which can be listed after |AsmSources| has moved on. */
+    struct Location {
+        std::string name;
+        int lineno;
+        int nest;
+    };
+    Location location();
+
     void set(const StrScanner &line, const ErrorAt &error, const ConfigBase &config,
-            const Value *value = nullptr);
+            const Value *value = nullptr, const Location *location = nullptr);
     bool hasError() const;
 
     const ConfigBase &config() const override { return *_config; }
@@ -58,11 +66,15 @@ private:
     ErrorAt _error;
     const Value *_value;
     const ConfigBase *_config;
+    const Location *_location;
 
     bool _errorLine;
     int _nextLine;
 
     void formatLineNumber(StrBuffer &out);
+    const std::string &name();
+    int lineno();
+    int nest();
 
     // ListFormatter
     uint32_t startAddress() const override { return _insn.address(); }
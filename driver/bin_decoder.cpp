@@ -17,8 +17,6 @@
 #include "intel_hex.h"
 #include "moto_srec.h"
 
-#include <cctype>
-
 namespace libasm {
 namespace driver {
 
@@ -50,19 +48,56 @@ int BinDecoder::decode(TextReader &in, BinMemory &memory) {
     return size;
 }
 
-static uint8_t parseHex(char c) {
-    return isdigit(c) ? c - '0' : toupper(c) - 'A' + 10;
+namespace {
+
+/** Value of a hex digit, or |INVALID| for other characters. */
+struct HexTable {
+    static constexpr uint8_t INVALID = 0xFF;
+
+    HexTable() {
+        for (auto &v : value)
+            v = INVALID;
+        for (auto c = 0; c < 10; c++)
+            value['0' + c] = c;
+        for (auto c = 0; c < 6; c++)
+            value['A' + c] = value['a' + c] = 10 + c;
+    }
+
+    uint8_t value[256];
+};
+
+const HexTable HEX;
+
+inline bool hexByte(const char *p, uint8_t &val) {
+    const auto hi = HEX.value[static_cast<uint8_t>(p[0])];
+    const auto lo = HEX.value[static_cast<uint8_t>(p[1])];
+    if ((hi | lo) & 0xF0)
+        return false;
+    val = (hi << 4) | lo;
+    return true;
 }
 
+}  // namespace
+
 bool BinDecoder::parseByte(StrScanner &line, uint8_t &val) {
-    const auto c1 = line.expect(isxdigit);
-    if (c1 == 0)
+    if (line.size() < 2 || !hexByte(line.str(), val))
         return false;
-    val = parseHex(c1) << 4;
-    const auto c2 = line.expect(isxdigit);
-    if (c2 == 0)
+    line += 2;
+    return true;
+}
+
+bool BinDecoder::parseBytes(StrScanner &line, uint8_t *data, size_t len, uint_fast8_t &sum) {
+    if (line.size() < len * 2)
         return false;
-    val |= parseHex(c2);
+    const auto *p = line.str();
+    auto s = sum;
+    for (size_t i = 0; i < len; i++, p += 2) {
+        if (!hexByte(p, data[i]))
+            return false;
+        s += data[i];
+    }
+    sum = s;
+    line += len * 2;
     return true;
 }
 
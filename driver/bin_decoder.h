@@ -21,6 +21,7 @@
 #include "str_scanner.h"
 #include "text_reader.h"
 
+#include <cstddef>
 #include <cstdint>
 
 namespace libasm {
@@ -38,6 +39,11 @@ protected:
     virtual int decode(StrScanner &line, BinMemory &memory) = 0;
 
     static bool parseByte(StrScanner &line, uint8_t &val);
+    /**
+     * Parse |len| bytes of hex digits into |data| and add them to |sum|.
+     * @return false if |line| doesn't have enough hex digits.
+     */
+    static bool parseBytes(StrScanner &line, uint8_t *data, size_t len, uint_fast8_t &sum);
     static bool parseUint16(StrScanner &line, uint16_t &val);
     static bool parseUint24(StrScanner &line, uint32_t &val);
     static bool parseUint32(StrScanner &line, uint32_t &val);
@@ -37,6 +37,26 @@ uint_fast8_t BinEncoder::maxAddressSize(const BinMemory &memory) {
     return max_size;
 }
 
+namespace {
+constexpr char HEX[] = "0123456789ABCDEF";
+}  // namespace
+
+char *BinEncoder::formatHex(char *p, uint32_t val, uint_fast8_t digits) {
+    for (auto i = digits; i > 0; i--) {
+        p[i - 1] = HEX[val & 0xF];
+        val >>= 4;
+    }
+    return p + digits;
+}
+
+char *BinEncoder::formatBytes(char *p, const uint8_t *data, uint_fast8_t size) {
+    for (uint_fast8_t i = 0; i < size; i++) {
+        *p++ = HEX[data[i] >> 4];
+        *p++ = HEX[data[i] & 0xF];
+    }
+    return p;
+}
+
 int BinEncoder::encode(const BinMemory &memory, TextPrinter &out) {
     _address_size = maxAddressSize(memory);
     this->begin(out);
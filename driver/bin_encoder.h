@@ -41,6 +41,10 @@ protected:
 
     static uint_fast8_t addressSize(uint32_t addr);
     static uint_fast8_t maxAddressSize(const BinMemory &memory);
+    /** Format |val| as |digits| upper case hex digits at |p| and return the end. */
+    static char *formatHex(char *p, uint32_t val, uint_fast8_t digits);
+    /** Format |size| bytes of |data| as hex digits at |p| and return the end. */
+    static char *formatBytes(char *p, const uint8_t *data, uint_fast8_t size);
 };
 
 }  // namespace driver
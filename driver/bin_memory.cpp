@@ -16,172 +16,225 @@
 
 #include "bin_memory.h"
 
-#include <cstdlib>
 #include <cstring>
+#include <utility>
+
+#include "stats.h"
 
 namespace libasm {
 namespace driver {
 
-BinMemory::BinMemory() {}
+BinMemory::BinMemory() : _page(nullptr), _pageNo(0), _blocksValid(true) {}
 
-BinMemory::Blocks::iterator BinMemory::find(uint32_t addr) {
-    if (_blocks.empty())
-        return _blocks.end();
-    auto it = _blocks.lower_bound(addr);
-    if (it == _blocks.begin())
-        return addr < it->second.base() ? _blocks.end() : it;
-    if (it == _blocks.end() || addr < it->second.base())
-        --it;
-    return it;
+const BinMemory::Page *BinMemory::findPage(uint32_t addr) const {
+    const auto it = _pages.find(addr >> PAGE_BITS);
+    return it == _pages.end() ? nullptr : it->second.get();
 }
 
-BinMemory::Blocks::const_iterator BinMemory::find(uint32_t addr) const {
-    if (_blocks.empty())
-        return _blocks.cend();
-    auto it = _blocks.lower_bound(addr);
-    if (it == _blocks.cbegin())
-        return addr < it->second.base() ? _blocks.cend() : it;
-    if (it == _blocks.cend() || addr < it->second.base())
-        --it;
-    return it;
+BinMemory::Page &BinMemory::touchPage(uint32_t addr) {
+    const auto pageNo = addr >> PAGE_BITS;
+    if (_page == nullptr || _pageNo != pageNo) {
+        auto &page = _pages[pageNo];
+        if (!page)
+            page.reset(new Page());  // zero initialized
+        _page = page.get();
+        _pageNo = pageNo;
+    }
+    _blocksValid = false;
+    return *_page;
 }
 
 bool BinMemory::hasByte(uint32_t addr) const {
-    auto it = find(addr);
-    return it != _blocks.cend() && it->second.inside(addr);
+    const auto *page = findPage(addr);
+    return page && page->has(addr & PAGE_MASK);
 }
 
 void BinMemory::writeByte(uint32_t addr, uint8_t val) {
-    auto it = find(addr);
-    if (it == _blocks.end()) {
-        createBlock(addr, val);
-        return;
-    }
-    auto &block = it->second;
-    if (block.inside(addr)) {
-        block.write(addr, val);
-    } else if (block.atEnd(addr)) {
-        block.append(val);
-        aggregate(block);
-    } else {
-        createBlock(addr, val);
+    stats::count(stats::BYTES_WRITTEN);
+    auto &page = touchPage(addr);
+    const auto offset = addr & PAGE_MASK;
+    page.data[offset] = val;
+    page.fill(offset, 1);
+}
+
+void BinMemory::write(uint32_t addr, const uint8_t *data, size_t len) {
+    stats::count(stats::BYTES_WRITTEN, len);
+    while (len > 0) {
+        auto &page = touchPage(addr);
+        const auto offset = addr & PAGE_MASK;
+        const auto size = len < PAGE_SIZE - offset ? len : PAGE_SIZE - offset;
+        memcpy(page.data + offset, data, size);
+        page.fill(offset, size);
+        addr += size;
+        data += size;
+        len -= size;
     }
 }
 
 uint8_t BinMemory::readByte(uint32_t addr) const {
-    auto it = find(addr);
-    if (it != _blocks.cend()) {
-        const auto &block = it->second;
-        if (block.inside(addr))
-            return block.read(addr);
-    }
-    return 0;
+    const auto *page = findPage(addr);
+    return page ? page->data[addr & PAGE_MASK] : 0;
 }
 
 bool BinMemory::operator==(const BinMemory &other) const {
-    return _blocks == other._blocks;
+    if (_pages.size() != other._pages.size())
+        return false;
+    // Bytes which are not present are always zero.
+    for (auto a = _pages.cbegin(), b = other._pages.cbegin(); a != _pages.cend(); ++a, ++b) {
+        if (a->first != b->first || memcmp(a->second.get(), b->second.get(), sizeof(Page)) != 0)
+            return false;
+    }
+    return true;
 }
 
 void BinMemory::swap(BinMemory &other) {
+    _pages.swap(other._pages);
+    std::swap(_page, other._page);
+    std::swap(_pageNo, other._pageNo);
     _blocks.swap(other._blocks);
+    std::swap(_blocksValid, other._blocksValid);
 }
 
 const BinReader::Block *BinMemory::begin() const {
-    return _blocks.empty() ? nullptr : &_blocks.begin()->second;
+    if (!_blocksValid)
+        buildBlocks();
+    return _blocks.empty() ? nullptr : &_blocks.front();
 }
 
 void BinMemory::clear() {
+    _pages.clear();
+    _page = nullptr;
     _blocks.clear();
+    _blocksValid = true;
 }
 
 uint32_t BinMemory::startAddress() const {
-    return _blocks.empty() ? 0 : _blocks.begin()->second.base();
+    if (_pages.empty())
+        return 0;
+    const auto it = _pages.cbegin();
+    return (it->first << PAGE_BITS) + it->second->scan(0, true);
 }
 
 uint32_t BinMemory::endAddress() const {
-    if (_blocks.empty())
+    if (_pages.empty())
         return 0;
-    const auto it = _blocks.rbegin();
-    return it->second.base() + it->second.size() - 1;
+    const auto it = _pages.crbegin();
+    return (it->first << PAGE_BITS) + it->second->last();
 }
 
 void BinMemory::setRange(uint32_t start, uint32_t end) {
     if (end < start)
         return;
-    Block *b = nullptr;
-    for (auto it = _blocks.begin(); it != _blocks.end();) {
-        auto &block = it->second;
-        const auto s = block.base();
-        const auto e = block.base() + block.size() - 1;
-        if (e < start || s > end) {
-            // out of range
-            it = _blocks.erase(it);
-            continue;
+    const auto startNo = start >> PAGE_BITS;
+    const auto endNo = end >> PAGE_BITS;
+    for (auto it = _pages.begin(); it != _pages.end();) {
+        const auto pageNo = it->first;
+        auto &page = *it->second;
+        if (pageNo == startNo)
+            page.erase(0, start & PAGE_MASK);
+        if (pageNo == endNo)
+            page.erase((end & PAGE_MASK) + 1, PAGE_MASK - (end & PAGE_MASK));
+        if (pageNo < startNo || pageNo > endNo || page.empty()) {
+            it = _pages.erase(it);
+        } else {
+            ++it;
         }
-        if (s < start && e >= start)
-            block.trimStart(start);
-        if (s < end && e >= end)
-            block.trimEnd(end);
-        b = &block;
-        ++it;
-    }
-    if (b)
-        b->connect(nullptr);
-}
-
-void BinMemory::createBlock(uint32_t addr, uint8_t val) {
-    auto it = _blocks.emplace(addr, addr).first;
-    auto &block = it->second;
-    auto next = it;
-    if (++next != _blocks.end())
-        block.connect(&next->second);
-    if (it != _blocks.begin()) {
-        auto prev = it;
-        --prev;
-        prev->second.connect(&block);
     }
-    block.append(val);
-    aggregate(block);
+    _page = nullptr;
+    _blocksValid = false;
 }
 
-void BinMemory::aggregate(Block &block) {
-    auto it = _blocks.find(block.base());
-    if (it == _blocks.end())
-        return;
-    auto next = it;
-    if (++next != _blocks.end() && it->second.atEnd(next->second.base())) {
-        it->second.aggregate(next->second);
-        _blocks.erase(next);
+void BinMemory::buildBlocks() const {
+    _blocks.clear();
+    for (const auto &it : _pages) {
+        const auto base = it.first << PAGE_BITS;
+        const auto &page = *it.second;
+        auto offset = page.scan(0, true);
+        while (offset < PAGE_SIZE) {
+            const auto end = page.scan(offset, false);
+            const auto size = end - offset;
+            if (!_blocks.empty() && _blocks.back().atEnd(base + offset)) {
+                _blocks.back().append(page.data + offset, size);
+            } else {
+                _blocks.emplace_back(base + offset, size, page.data + offset);
+            }
+            offset = page.scan(end, true);
+        }
+    }
+    for (size_t i = 0; i < _blocks.size(); i++)
+        _blocks[i].finish(i + 1 < _blocks.size() ? &_blocks[i + 1] : nullptr);
+    _blocksValid = true;
+}
+
+void BinMemory::Page::fill(uint32_t offset, uint32_t len) {
+    const auto end = offset + len;
+    while (offset < end) {
+        if (offset % 64 == 0 && end - offset >= 64) {
+            present[offset / 64] = ~UINT64_C(0);
+            offset += 64;
+        } else {
+            present[offset / 64] |= bit(offset);
+            offset++;
+        }
     }
-    if (it != _blocks.begin()) {
-        auto prev = it;
-        --prev;
-        if (prev->second.atEnd(it->second.base())) {
-            prev->second.aggregate(it->second);
-            _blocks.erase(it);
+}
+
+void BinMemory::Page::erase(uint32_t offset, uint32_t len) {
+    memset(data + offset, 0, len);
+    const auto end = offset + len;
+    while (offset < end) {
+        if (offset % 64 == 0 && end - offset >= 64) {
+            present[offset / 64] = 0;
+            offset += 64;
+        } else {
+            present[offset / 64] &= ~bit(offset);
+            offset++;
         }
     }
 }
 
-bool BinMemory::Block::operator==(const Block &other) const {
-    return _base == other._base && _data == other._data;
+bool BinMemory::Page::empty() const {
+    for (const auto word : present) {
+        if (word)
+            return false;
+    }
+    return true;
+}
+
+uint32_t BinMemory::Page::scan(uint32_t offset, bool exist) const {
+    const uint64_t skip = exist ? 0 : ~UINT64_C(0);
+    while (offset < PAGE_SIZE) {
+        if (offset % 64 == 0 && present[offset / 64] == skip) {
+            offset += 64;
+        } else if (has(offset) == exist) {
+            return offset;
+        } else {
+            offset++;
+        }
+    }
+    return PAGE_SIZE;
 }
 
-void BinMemory::Block::aggregate(const Block &other) {
-    _data.reserve(_data.size() + other._data.size());
-    _data.insert(_data.end(), other._data.begin(), other._data.end());
-    _next = other._next;
+uint32_t BinMemory::Page::last() const {
+    auto offset = PAGE_SIZE;
+    while (offset-- > 0) {
+        if (has(offset))
+            return offset;
+    }
+    return 0;
 }
 
-void BinMemory::Block::trimStart(uint32_t start) {
-    auto delta = start - _base;
-    _data.erase(_data.begin(), _data.begin() + delta);
-    _base = start;
+void BinMemory::Block::append(const uint8_t *data, uint32_t size) {
+    if (_copy.empty())
+        _copy.assign(_data, _data + _size);
+    _copy.insert(_copy.end(), data, data + size);
+    _size += size;
 }
 
-void BinMemory::Block::trimEnd(uint32_t end) {
-    auto delta = _base + _data.size() - 1 - end;
-    _data.erase(_data.end() - delta, _data.end());
+void BinMemory::Block::finish(const Block *next) {
+    if (!_copy.empty())
+        _data = _copy.data();
+    _next = next;
 }
 
 }  // namespace driver
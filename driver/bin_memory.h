@@ -17,7 +17,9 @@
 #ifndef __LIBASM_BIN_MEMORY_H__
 #define __LIBASM_BIN_MEMORY_H__
 
+#include <cstddef>
 #include <map>
+#include <memory>
 #include <vector>
 
 #include "bin_reader.h"
@@ -26,12 +28,18 @@
 namespace libasm {
 namespace driver {
 
+/**
+ * Sparse memory which consists of 4 KiB pages with presence bitmap. Contiguous bytes are
+ * presented as |BinReader::Block|s, which are built on demand after writes.
+ */
 struct BinMemory : BinReader {
     BinMemory();
 
     bool hasByte(uint32_t addr) const;
     void writeByte(uint32_t addr, uint8_t val);
     uint8_t readByte(uint32_t addr) const;
+    /** Write |len| bytes of |data| from |addr|. */
+    void write(uint32_t addr, const uint8_t *data, size_t len);
 
     bool operator==(const BinMemory &other) const;
     bool operator!=(const BinMemory &other) const { return !(*this == other); }
@@ -46,45 +54,63 @@ struct BinMemory : BinReader {
     void setRange(uint32_t start, uint32_t end);
 
 private:
+    static constexpr auto PAGE_BITS = 12;
+    static constexpr uint32_t PAGE_SIZE = UINT32_C(1) << PAGE_BITS;
+    static constexpr uint32_t PAGE_MASK = PAGE_SIZE - 1;
+
+    struct Page {
+        uint8_t data[PAGE_SIZE];
+        uint64_t present[PAGE_SIZE / 64];
+
+        bool has(uint32_t offset) const { return present[offset / 64] & bit(offset); }
+        void fill(uint32_t offset, uint32_t len);
+        void erase(uint32_t offset, uint32_t len);
+        bool empty() const;
+        /** Returns offset of the first byte which |has| equals to |exist| at or after |offset|. */
+        uint32_t scan(uint32_t offset, bool exist) const;
+        uint32_t last() const;
+
+    private:
+        static uint64_t bit(uint32_t offset) { return UINT64_C(1) << (offset % 64); }
+    };
+
     struct Block : BinReader::Block {
-        Block(uint32_t addr) : _base(addr), _data(), _next(nullptr) {}
+        Block(uint32_t base, uint32_t size, const uint8_t *data)
+            : _base(base), _size(size), _data(data), _copy(), _next(nullptr) {}
 
         uint32_t base() const override { return _base; }
-        uint32_t size() const override { return _data.size(); }
-        const uint8_t *data() const override { return _data.data(); }
-        const BinReader::Block *next() const override {
-            return reinterpret_cast<const BinReader::Block *>(_next);
-        }
+        uint32_t size() const override { return _size; }
+        const uint8_t *data() const override { return _data; }
+        const BinReader::Block *next() const override { return _next; }
         BinReader::ByteReader reader() const override {
             return BinReader::ByteReader{base(), size(), data()};
         }
 
-        bool operator==(const Block &other) const;
-        bool operator!=(const Block &other) const { return !(*this == other); }
-        bool inside(uint32_t addr) const { return addr >= _base && addr < _base + _data.size(); }
-        bool atEnd(uint32_t addr) const { return addr == _base + _data.size(); }
-        uint8_t read(uint32_t addr) const { return _data[addr - _base]; }
-        void write(uint32_t addr, uint8_t val) { _data[addr - _base] = val; }
-        void append(uint8_t val) { _data.push_back(val); }
-        void aggregate(const Block &other);
-        void connect(const Block *next) { _next = next; }
-        void trimStart(uint32_t start);
-        void trimEnd(uint32_t end);
+        bool atEnd(uint32_t addr) const { return addr == _base + _size; }
+        void append(const uint8_t *data, uint32_t size);
+        void finish(const Block *next);
 
     private:
         uint32_t _base;
-        std::vector<uint8_t> _data;
+        uint32_t _size;
+        const uint8_t *_data;
+        /** Bytes which span multiple pages are copied here. */
+        std::vector<uint8_t> _copy;
         const Block *_next;
     };
 
-    // Memory block map in ascending order of start address.
-    using Blocks = std::map<uint32_t, Block>;
-    Blocks _blocks;
-    Blocks::iterator find(uint32_t addr);
-    Blocks::const_iterator find(uint32_t addr) const;
-
-    void createBlock(uint32_t addr, uint8_t val);
-    void aggregate(Block &block);
+    // Pages in ascending order of page number.
+    using Pages = std::map<uint32_t, std::unique_ptr<Page>>;
+    Pages _pages;
+    // The page which is written last.
+    Page *_page;
+    uint32_t _pageNo;
+    mutable std::vector<Block> _blocks;
+    mutable bool _blocksValid;
+
+    const Page *findPage(uint32_t addr) const;
+    Page &touchPage(uint32_t addr);
+    void buildBlocks() const;
 };
 
 }  // namespace driver
@@ -59,6 +59,15 @@ struct BinReader {
         return blocks;
     }
 
+    /** Returns true when a block has a byte at |address|. */
+    bool contains(uint32_t address) const {
+        for (auto b = begin(); b != nullptr; b = b->next()) {
+            if (address >= b->base() && address - b->base() < b->size())
+                return true;
+        }
+        return false;
+    }
+
     uint32_t size() const {
         uint32_t size = 0;
         for (auto b = begin(); b != nullptr; b = b->next())
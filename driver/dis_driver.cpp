@@ -17,18 +17,27 @@
 #include "dis_driver.h"
 
 #include "dis_formatter.h"
+#include "dis_tracer.h"
+#include "stored_printer.h"
 #include "text_printer.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstring>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 namespace libasm {
 namespace driver {
 
 DisDriver::DisDriver(std::initializer_list<Disassembler *> disassemblers)
-    : _disassemblers(), _current(nullptr) {
+    : DisDriver(std::vector<Disassembler *>(disassemblers)) {}
+
+DisDriver::DisDriver(const std::vector<Disassembler *> &disassemblers)
+    : _disassemblers(), _current(nullptr), _jobs(1) {
     for (auto dis : disassemblers)
         _disassemblers.push_back(dis);
     _current = _disassemblers.front();
@@ -95,6 +104,177 @@ bool DisDriver::setOption(const char *name, const char *value) {
     return current()->setOption(name, value);
 }
 
+static void printInsn(DisFormatter &formatter, StrBuffer &out, TextPrinter &output,
+        TextPrinter &listout, TextPrinter &errorout) {
+    while (formatter.hasNextContent())
+        output.println(formatter.getContent(out).str());
+    while (formatter.hasNextLine()) {
+        listout.println(formatter.getLine(out).str());
+        if (!formatter.insn().isOK())
+            errorout.println(out.str());
+    }
+}
+
+/** Decode an instruction at |address| from |reader| and print it. Returns its length. */
+static uint32_t decodeInsn(Disassembler &disassembler, DisFormatter &formatter,
+        BinReader::ByteReader &reader, uint32_t address, StrBuffer &out, TextPrinter &output,
+        TextPrinter &listout, TextPrinter &errorout, SymbolTable *symtab = nullptr) {
+    formatter.reset();
+    auto &operands = formatter.operands();
+    auto &insn = formatter.insn();
+    insn.reset(address);
+    disassembler.decode(reader, insn, operands.mark(), operands.capacity(), symtab);
+    formatter.set(insn);
+    printInsn(formatter, out, output, listout, errorout);
+    if (insn.hasContinue()) {
+        const auto mark_P = insn.continueMark_P();
+        disassembler.decode(reader, insn, operands.mark(), operands.capacity(), symtab);
+        formatter.set(insn, mark_P);
+        printInsn(formatter, out, output, listout, errorout);
+    }
+    return insn.length();
+}
+
+static BinReader::ByteReader readerAt(const BinReader::Block *block, uint32_t offset) {
+    return BinReader::ByteReader{
+            block->base() + offset, block->size() - offset, block->data() + offset};
+}
+
+static void copyLines(const StoredPrinter &from, size_t begin, size_t end, TextPrinter &to) {
+    for (auto lineno = begin + 1; lineno <= end; lineno++)
+        to.println(from.line(lineno));
+}
+
+/**
+ * Bytes of a block which a thread decodes. Instructions are decoded from |offset| until the
+ * one which crosses |end|.
+ */
+struct DisDriver::Chunk {
+    Chunk(const BinReader::Block *_block, uint32_t _offset, uint32_t _end)
+        : block(_block), offset(_offset), end(_end), decoded(false) {}
+
+    /** Decoded instruction and the number of printed lines after it */
+    struct Step {
+        uint32_t offset;
+        uint32_t length;
+        size_t output;
+        size_t listout;
+        size_t errorout;
+    };
+
+    const BinReader::Block *block;
+    uint32_t offset;
+    uint32_t end;
+    bool decoded;
+    StoredPrinter output;
+    StoredPrinter listout;
+    StoredPrinter errorout;
+    std::vector<Step> steps;
+};
+
+/**
+ * Threads which decode chunks in order ahead of the merge. A thread doesn't start a chunk more
+ * than |_window| chunks ahead of the oldest one which is not released yet, so that lines of at
+ * most |_window| chunks are kept however large the input is.
+ */
+struct DisDriver::ChunkDecoder {
+    ChunkDecoder(const DisDriver &driver, std::vector<Chunk> &chunks, const char *inputName,
+            size_t jobs)
+        : _driver(driver),
+          _chunks(chunks),
+          _inputName(inputName),
+          _window(jobs * 2),
+          _next(0),
+          _released(0) {
+        for (size_t i = 0; i < jobs; i++)
+            _threads.emplace_back(&ChunkDecoder::decode, this);
+    }
+
+    ~ChunkDecoder() {
+        release(_chunks.size());
+        for (auto &thread : _threads)
+            thread.join();
+    }
+
+    /** Returns chunk |index| after a thread has decoded it. */
+    const Chunk &decoded(size_t index) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cond.wait(lock, [&]() { return _chunks[index].decoded; });
+        return _chunks[index];
+    }
+
+    /** Drop lines of chunks before |index|, which have been merged. */
+    void release(size_t index) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (; _released < index; _released++) {
+            if (_released >= _next) {
+                // No thread will start a chunk which has been skipped.
+                _next = _released + 1;
+                continue;
+            }
+            _cond.wait(lock, [&]() { return _chunks[_released].decoded; });
+            auto &chunk = _chunks[_released];
+            chunk.output = StoredPrinter();
+            chunk.listout = StoredPrinter();
+            chunk.errorout = StoredPrinter();
+            chunk.steps = std::vector<Chunk::Step>();
+        }
+        _cond.notify_all();
+    }
+
+private:
+    const DisDriver &_driver;
+    std::vector<Chunk> &_chunks;
+    const char *const _inputName;
+    const size_t _window;
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    /** Index of the chunk which a thread decodes next */
+    size_t _next;
+    /** Number of chunks which have been released */
+    size_t _released;
+    std::vector<std::thread> _threads;
+
+    void decode() {
+        std::unique_ptr<Disassembler> disassembler{_driver._current->clone()};
+        DisFormatter formatter(*disassembler, _inputName);
+        formatter.setUpperHex(_driver._upperHex);
+        formatter.setUppercase(_driver._uppercase);
+        char buffer[256];
+        StrBuffer out{buffer, sizeof(buffer)};
+        const auto unit = disassembler->config().addressUnit();
+        while (true) {
+            size_t i;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cond.wait(lock, [&]() {
+                    return _next >= _chunks.size() || _next < _released + _window;
+                });
+                if (_next >= _chunks.size())
+                    return;
+                i = _next++;
+            }
+            auto &chunk = _chunks[i];
+            auto reader = readerAt(chunk.block, chunk.offset);
+            const auto start = chunk.block->base() / unit;
+            for (auto offset = chunk.offset; offset < chunk.end;) {
+                const auto length = decodeInsn(*disassembler, formatter, reader,
+                        start + offset / unit, out, chunk.output, chunk.listout, chunk.errorout);
+                chunk.steps.push_back(Chunk::Step{offset, length, chunk.output.size(),
+                        chunk.listout.size(), chunk.errorout.size()});
+                if (length == 0)
+                    break;
+                offset += length;
+            }
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                chunk.decoded = true;
+            }
+            _cond.notify_all();
+        }
+    }
+};
+
 void DisDriver::disassemble(BinReader &memory, const char *inputName, TextPrinter &output,
         TextPrinter &listout, TextPrinter &errorout) {
     char buffer[256];
@@ -120,7 +300,36 @@ void DisDriver::disassemble(BinReader &memory, const char *inputName, TextPrinte
         listout.println(formatter.getLine(out).str());
     }
 
+    if (!_entries.empty() && disassembler.dataDirective_P()) {
+        disassembleTraced(memory, formatter, out, output, listout, errorout);
+        return;
+    }
+
     const auto unit = disassembler.config().addressUnit();
+    std::vector<Chunk> chunks;
+    std::unique_ptr<ChunkDecoder> decoder;
+    if (_jobs > 1) {
+        for (auto block = memory.begin(); block != nullptr; block = block->next()) {
+            for (uint32_t offset = 0; offset < block->size(); offset += CHUNK_SIZE) {
+                const auto size = block->size() - offset;
+                const auto end = offset + (size < CHUNK_SIZE ? size : CHUNK_SIZE);
+                chunks.emplace_back(block, offset, end);
+            }
+        }
+        if (chunks.size() > 1) {
+            // A thread more than chunks would have nothing to decode.
+            const auto jobs = _jobs < chunks.size() ? _jobs : chunks.size();
+            decoder.reset(new ChunkDecoder(*this, chunks, inputName, jobs));
+        } else {
+            chunks.clear();
+        }
+    }
+
+    // Instructions decoded by threads are taken when one starts at the offset where the previous
+    // one ends. Otherwise instructions are decoded here until they synchronize again. Lines of a
+    // chunk are released once merged.
+    size_t index = 0;
+    size_t step = 0;
     for (auto block = memory.begin(); block != nullptr; block = block->next()) {
         auto reader = block->reader();
         const auto start = reader.address() / unit;
@@ -130,35 +339,91 @@ void DisDriver::disassemble(BinReader &memory, const char *inputName, TextPrinte
         output.println(formatter.getContent(out).str());
         listout.println(formatter.getLine(out).str());
 
+        auto readerAtOffset = true;
         for (uint32_t mem_offset = 0; mem_offset < mem_size;) {
-            formatter.reset();
-            auto &operands = formatter.operands();
-            auto &insn = formatter.insn();
-            insn.reset(start + mem_offset / unit);
-            disassembler.decode(reader, insn, operands.mark(), operands.capacity());
-            formatter.set(insn);
-            while (formatter.hasNextContent())
-                output.println(formatter.getContent(out).str());
-            while (formatter.hasNextLine()) {
-                listout.println(formatter.getLine(out).str());
-                if (!insn.isOK())
-                    errorout.println(out.str());
+            for (; index < chunks.size(); ++index, step = 0) {
+                if (chunks[index].block == block && chunks[index].end > mem_offset)
+                    break;
+                decoder->release(index + 1);
             }
-            if (insn.hasContinue()) {
-                const auto mark_P = insn.continueMark_P();
-                disassembler.decode(reader, insn, operands.mark(), operands.capacity());
-                formatter.set(insn, mark_P);
-                while (formatter.hasNextContent())
-                    output.println(formatter.getContent(out).str());
-                while (formatter.hasNextLine()) {
-                    listout.println(formatter.getLine(out).str());
-                    if (!insn.isOK())
-                        errorout.println(out.str());
-                }
+            const Chunk *chunk = nullptr;
+            const Chunk::Step *decoded = nullptr;
+            if (index < chunks.size() && chunks[index].block == block) {
+                chunk = &decoder->decoded(index);
+                const auto &steps = chunk->steps;
+                while (step < steps.size() && steps[step].offset < mem_offset)
+                    ++step;
+                if (step < steps.size() && steps[step].offset == mem_offset)
+                    decoded = &steps[step];
             }
-            if (insn.length() == 0)
+            uint32_t length;
+            if (decoded) {
+                const auto *prev = step ? &chunk->steps[step - 1] : nullptr;
+                copyLines(chunk->output, prev ? prev->output : 0, decoded->output, output);
+                copyLines(chunk->listout, prev ? prev->listout : 0, decoded->listout, listout);
+                copyLines(chunk->errorout, prev ? prev->errorout : 0, decoded->errorout, errorout);
+                length = decoded->length;
+                readerAtOffset = false;
+            } else {
+                if (!readerAtOffset)
+                    reader = readerAt(block, mem_offset);
+                readerAtOffset = true;
+                length = decodeInsn(disassembler, formatter, reader, start + mem_offset / unit,
+                        out, output, listout, errorout);
+            }
+            if (length == 0)
                 break;
-            mem_offset += insn.length();
+            mem_offset += length;
+        }
+    }
+}
+
+void DisDriver::disassembleTraced(BinReader &memory, DisFormatter &formatter, StrBuffer &out,
+        TextPrinter &output, TextPrinter &listout, TextPrinter &errorout) const {
+    auto &disassembler = *current();
+    DisTracer tracer(disassembler, memory);
+    for (const auto entry : _entries) {
+        if (!tracer.addEntry(entry))
+            errorout.format("error: Entry address 0x%X is out of memory\n", entry);
+    }
+    tracer.trace();
+
+    const auto unit = disassembler.config().addressUnit();
+    char name[16];
+    for (auto block = memory.begin(); block != nullptr; block = block->next()) {
+        const auto start = block->base() / unit;
+        const auto mem_size = block->size();
+
+        formatter.setOrigin(start);
+        output.println(formatter.getContent(out).str());
+        listout.println(formatter.getLine(out).str());
+
+        for (uint32_t mem_offset = 0; mem_offset < mem_size;) {
+            const auto address = start + mem_offset / unit;
+            const auto label = tracer.label(address, name, sizeof(name));
+            if (label) {
+                formatter.setLabel(address, label);
+                printInsn(formatter, out, output, listout, errorout);
+            }
+            uint32_t length = 0;
+            if (tracer.isCode(address)) {
+                auto reader = readerAt(block, mem_offset);
+                length = decodeInsn(disassembler, formatter, reader, address, out, output,
+                        listout, errorout, &tracer);
+            }
+            if (length == 0) {
+                // Bytes until the next instruction or label.
+                length = unit;
+                while (length < DATA_SIZE && mem_offset + length < mem_size) {
+                    const auto next = start + (mem_offset + length) / unit;
+                    if (tracer.isCode(next) || tracer.isLabel(next))
+                        break;
+                    length += unit;
+                }
+                formatter.setData(address, block->data() + mem_offset, length);
+                printInsn(formatter, out, output, listout, errorout);
+            }
+            mem_offset += length;
         }
     }
 }
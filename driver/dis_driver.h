@@ -23,6 +23,7 @@
 #include <initializer_list>
 #include <list>
 #include <string>
+#include <vector>
 
 namespace libasm {
 namespace driver {
@@ -33,6 +34,7 @@ struct DisFormatter;
 
 struct DisDriver final {
     DisDriver(std::initializer_list<Disassembler *> disassemblers);
+    DisDriver(const std::vector<Disassembler *> &disassemblers);
 
     Disassembler *restrictCpu(const char *cpu);
     Disassembler *setCpu(const char *cpu);
@@ -42,6 +44,22 @@ struct DisDriver final {
     void setUpperHex(bool upperHex);
     void setUppercase(bool uppercase);
     bool setOption(const char *name, const char *value);
+    /**
+     * Disassemble with |jobs| threads. Each thread decodes blocks, or chunks of a large block,
+     * with its own instance of the current disassembler, and the result is merged in address
+     * order. No more threads than chunks are used, and threads stay at most two chunks per
+     * thread ahead of the merge, which writes and frees finished chunks in order. |jobs| is
+     * ignored when an entry is added by |addEntry|.
+     */
+    void setJobs(unsigned jobs) { _jobs = jobs ? jobs : 1; }
+    /**
+     * Trace control flow from entry |address| instead of decoding memory linearly. Traced
+     * addresses are labeled, and bytes which are not reached are defined by a data directive.
+     * Tracing is done by a single thread, and only when the current disassembler has
+     * |Disassembler::dataDirective_P|. An entry which is out of memory is reported to
+     * |errorout| of |disassemble| and ignored.
+     */
+    void addEntry(uint32_t address) { _entries.push_back(address); }
 
     void disassemble(BinReader &memory, const char *inputName, TextPrinter &output,
             TextPrinter &listout, TextPrinter &errorout);
@@ -54,6 +72,17 @@ private:
     Disassembler *_current;
     bool _upperHex;
     bool _uppercase;
+    unsigned _jobs;
+    std::vector<uint32_t> _entries;
+
+    static constexpr uint32_t CHUNK_SIZE = 64 * 1024;
+    struct Chunk;
+    struct ChunkDecoder;
+
+    /** Number of bytes of a line of data directive */
+    static constexpr uint32_t DATA_SIZE = 8;
+    void disassembleTraced(BinReader &memory, DisFormatter &formatter, StrBuffer &out,
+            TextPrinter &output, TextPrinter &listout, TextPrinter &errorout) const;
 };
 
 }  // namespace driver
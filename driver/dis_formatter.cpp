@@ -33,6 +33,7 @@ DisFormatter::DisFormatter(Disassembler &disassembler, const char *inputName)
 }
 
 void DisFormatter::setUpperHex(bool upperHex) {
+    _upperHex = upperHex;
     _formatter.setUpperHex(upperHex);
     _disassembler.setUpperHex(upperHex);
 }
@@ -55,6 +56,7 @@ void DisFormatter::reset() {
     _errorMessage = _errorContent = _errorLine = false;
     _nextContent = _nextLine = -1;
     _continueMark_P = nullptr;
+    _label = nullptr;
 }
 
 void DisFormatter::set(const ErrorAt &error, const /*PROGMEM*/ char *mark_P) {
@@ -96,6 +98,31 @@ Error DisFormatter::setOrigin(uint32_t origin) {
     return OK;
 }
 
+void DisFormatter::setLabel(uint32_t address, const char *label) {
+    reset();
+    _insn.reset(address);
+    _label = label;
+}
+
+void DisFormatter::setData(uint32_t address, const uint8_t *data, uint8_t length) {
+    reset();
+    _insn.reset(address);
+    StrCaseBuffer name{_insn.nameBuffer(), _uppercase};
+    name.text_P(_disassembler.dataDirective_P());
+    StrCaseBuffer opr{_operands, _upperHex};
+    for (uint8_t i = 0; i < length; i++) {
+        if (i)
+            opr.comma();
+        _insn.emitByte(data[i]);
+        if (_disassembler.listRadix() == RADIX_8) {
+            _disassembler.formatter().formatOct(opr, data[i], 8);
+        } else {
+            _disassembler.formatter().formatHex(opr, data[i], 8);
+        }
+    }
+    opr.over(_operands);
+}
+
 bool DisFormatter::hasNextContent() const {
     return _nextContent < bytesSize();
 }
@@ -127,7 +154,10 @@ void DisFormatter::formatLine(StrBuffer &out, int &next) {
     StrBuffer null{buf, sizeof(buf)};
     auto &bytesOut = (_continueMark_P && _insn.continueOffset() == 0) ? null : out;
     const auto formatted = _formatter.formatBytes(bytesOut, next);
-    if (next == 0 && *_insn.name()) {
+    if (next == 0 && _label) {
+        _formatter.formatTab(out, pos + _formatter.bytesColumnWidth() + 1);
+        out.rtext(_label).letter(':');
+    } else if (next == 0 && *_insn.name()) {
         _formatter.formatTab(out, pos + _formatter.bytesColumnWidth() + 1);
         const auto namePos = out.len() + 8;  // label width
         if (_continueMark_P)
@@ -158,7 +188,9 @@ StrBuffer &DisFormatter::getContent(StrBuffer &out) {
     } else {
         if (_nextContent < 0)
             _nextContent = 0;
-        if (*_insn.name()) {
+        if (_label) {
+            out.rtext(_label).letter(':');
+        } else if (*_insn.name()) {
             const auto namePos = out.len() + 6;  // label width
             if (_continueMark_P)
                 out.rtext_P(_continueMark_P);
@@ -38,6 +38,10 @@ struct DisFormatter : ListFormatter::Provider {
     void setCpu(const char *cpu);
     void setOption(const char *name, const char *value);
     Error setOrigin(uint32_t origin);
+    /** Set |label| which is defined at |address|. */
+    void setLabel(uint32_t address, const char *label);
+    /** Set |length| bytes of |data| at |address| which are defined by a data directive. */
+    void setData(uint32_t address, const uint8_t *data, uint8_t length);
 
     Insn &insn() { return _insn; }
     StrBuffer &operands() { return _operands; }
@@ -54,7 +58,9 @@ protected:
     StrBuffer _operands;
     ErrorAt _error;
     const /*PROGMEM*/ char *_continueMark_P;
+    const char *_label;
 
+    bool _upperHex;
     bool _uppercase;
     bool _errorMessage;
     bool _errorContent;
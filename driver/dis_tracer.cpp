@@ -0,0 +1,175 @@
+/*
+ * Copyright 2026 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dis_tracer.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace libasm {
+namespace driver {
+
+DisTracer::Region::Region(const BinReader::Block *_block)
+    : block(_block), start(_block->size()), code(_block->size()), label(_block->size()) {}
+
+DisTracer::DisTracer(Disassembler &disassembler, const BinReader &memory)
+    : _disassembler(disassembler), _unit(disassembler.config().addressUnit()) {
+    for (auto block = memory.begin(); block != nullptr; block = block->next())
+        _regions.emplace_back(block);
+    std::sort(_regions.begin(), _regions.end(), [](const Region &a, const Region &b) {
+        return a.block->base() < b.block->base();
+    });
+}
+
+const DisTracer::Region *DisTracer::find(uint32_t address, uint32_t &offset) const {
+    const auto byte = static_cast<uint64_t>(address) * _unit;
+    auto region = std::upper_bound(_regions.cbegin(), _regions.cend(), byte,
+            [](uint64_t byte, const Region &r) { return byte < r.block->base(); });
+    if (region == _regions.cbegin())
+        return nullptr;
+    --region;
+    if (byte - region->block->base() >= region->block->size())
+        return nullptr;
+    offset = byte - region->block->base();
+    return &*region;
+}
+
+DisTracer::Region *DisTracer::find(uint32_t address, uint32_t &offset) {
+    const auto *self = this;
+    return const_cast<Region *>(self->find(address, offset));
+}
+
+bool DisTracer::addEntry(uint32_t address) {
+    uint32_t offset;
+    auto region = find(address, offset);
+    if (region == nullptr)
+        return false;
+    region->label[offset] = true;
+    _worklist.push_back(address);
+    return true;
+}
+
+void DisTracer::trace() {
+    while (!_worklist.empty()) {
+        const auto address = _worklist.back();
+        _worklist.pop_back();
+        traceFrom(address);
+    }
+    char name[16];
+    for (const auto &region : _regions) {
+        const auto base = region.block->base();
+        for (size_t offset = 0; offset < region.label.size(); offset++) {
+            const auto address = (base + offset) / _unit;
+            if (region.label[offset] && label(address, name, sizeof(name)))
+                _names.emplace(address, name);
+        }
+    }
+}
+
+void DisTracer::traceFrom(uint32_t address) {
+    Insn insn(address);
+    char operands[Disassembler::MAX_OPERANDS];
+    for (;;) {
+        uint32_t offset;
+        auto region = find(address, offset);
+        if (region == nullptr || region->code[offset])
+            return;
+        const auto block = region->block;
+        BinReader::ByteReader reader{
+                block->base() + offset, block->size() - offset, block->data() + offset};
+        _recorder.addresses.clear();
+        insn.reset(address);
+        _disassembler.decode(reader, insn, operands, sizeof(operands), &_recorder);
+        auto flow = insn.flow();
+        auto transfer = flow == FLOW_BRANCH || flow == FLOW_JUMP;
+        auto end = flow == FLOW_JUMP || flow == FLOW_END;
+        if (insn.hasContinue()) {
+            _disassembler.decode(reader, insn, operands, sizeof(operands), &_recorder);
+            flow = insn.flow();
+            transfer |= flow == FLOW_BRANCH || flow == FLOW_JUMP;
+            end |= flow == FLOW_JUMP || flow == FLOW_END;
+        }
+        const auto length = insn.length();
+        if (!insn.isOK() || length == 0)
+            return;
+        for (auto i = offset; i < offset + length; i++) {
+            if (region->code[i])
+                return;  // overlaps with a traced instruction
+        }
+        region->start[offset] = true;
+        for (auto i = offset; i < offset + length; i++)
+            region->code[i] = true;
+
+        for (const auto target : _recorder.addresses) {
+            uint32_t at;
+            auto r = find(target, at);
+            if (r == nullptr)
+                continue;
+            r->label[at] = true;
+            if (transfer && !r->code[at])
+                _worklist.push_back(target);
+        }
+        if (end)
+            return;
+        address += length / _unit;
+    }
+}
+
+bool DisTracer::isCode(uint32_t address) const {
+    uint32_t offset;
+    const auto region = find(address, offset);
+    return region && region->start[offset];
+}
+
+bool DisTracer::isLabel(uint32_t address) const {
+    uint32_t offset;
+    const auto region = find(address, offset);
+    if (region == nullptr || !region->label[offset])
+        return false;
+    // A label can't be defined in the middle of an instruction.
+    return !region->code[offset] || region->start[offset];
+}
+
+const char *DisTracer::label(uint32_t address, char *buffer, size_t size) const {
+    if (!isLabel(address))
+        return nullptr;
+    const auto digits = (_disassembler.config().addressWidth() + 3) / 4;
+    snprintf(buffer, size, "L%0*X", digits, address);
+    return buffer;
+}
+
+const char *DisTracer::lookupAddress(const Value &value) const {
+    if (value.isNegative())
+        return nullptr;
+    const auto it = _names.find(value.getUnsigned());
+    return it == _names.end() ? nullptr : it->second.c_str();
+}
+
+const char *DisTracer::Recorder::lookupAddress(const Value &value) const {
+    if (!value.isNegative())
+        addresses.push_back(value.getUnsigned());
+    return nullptr;
+}
+
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2026 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LIBASM_DIS_TRACER_H__
+#define __LIBASM_DIS_TRACER_H__
+
+#include "bin_reader.h"
+#include "dis_base.h"
+#include "symbol_table.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace libasm {
+namespace driver {
+
+/**
+ * Recursive traversal of code in |BinReader|.
+ *
+ * Instructions are decoded from entry points, and addresses which an instruction decodes are
+ * recorded through |SymbolTable::lookupAddress|. Addresses decoded by a branch, jump or call
+ * instruction are put into a worklist to be traced. An unconditional jump or return ends a trace.
+ * Control flow of an instruction is told by |Insn::flow| of a decoded instruction. Each block has
+ * bitmaps of instruction starts, instruction bytes and labels, so that every byte is traced at
+ * most once.
+ *
+ * After tracing, this resolves a synthesized label of a recorded address, which is either an
+ * instruction start or not in an instruction.
+ */
+struct DisTracer final : SymbolTable {
+    DisTracer(Disassembler &disassembler, const BinReader &memory);
+
+    /** Add an entry point at |address|. Returns false if |address| is out of memory. */
+    bool addEntry(uint32_t address);
+    /** Trace instructions from entry points. */
+    void trace();
+
+    /** Returns true when an instruction starts at |address|. */
+    bool isCode(uint32_t address) const;
+    /** Returns true when a label is at |address|. */
+    bool isLabel(uint32_t address) const;
+    /** Writes the label at |address| into |buffer| of |size| and returns it, or nullptr. */
+    const char *label(uint32_t address, char *buffer, size_t size) const;
+
+    // SymbolTable
+    const char *lookupAddress(const Value &value) const override;
+    bool hasSymbol(const StrScanner &) const override { return false; }
+    const Value *lookupSymbol(const StrScanner &) const override { return nullptr; }
+    const Functor *lookupFunction(const StrScanner &) const override { return nullptr; }
+
+private:
+    Disassembler &_disassembler;
+    const uint8_t _unit;
+
+    struct Region {
+        Region(const BinReader::Block *block);
+        const BinReader::Block *block;
+        std::vector<bool> start;
+        std::vector<bool> code;
+        std::vector<bool> label;
+    };
+    std::vector<Region> _regions;
+    std::vector<uint32_t> _worklist;
+
+    /** Records addresses which are decoded while tracing. */
+    struct Recorder final : SymbolTable {
+        const char *lookupAddress(const Value &value) const override;
+        bool hasSymbol(const StrScanner &) const override { return false; }
+        const Value *lookupSymbol(const StrScanner &) const override { return nullptr; }
+        const Functor *lookupFunction(const StrScanner &) const override { return nullptr; }
+        mutable std::vector<uint32_t> addresses;
+    } _recorder;
+
+    /** Names of labels, which are made after tracing. */
+    std::map<uint32_t, std::string> _names;
+
+    /** Find a region and byte offset of |address|. */
+    Region *find(uint32_t address, uint32_t &offset);
+    const Region *find(uint32_t address, uint32_t &offset) const;
+    void traceFrom(uint32_t address);
+};
+
+}  // namespace driver
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
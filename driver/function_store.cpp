@@ -16,14 +16,20 @@
 
 #include <cctype>
 #include <cstring>
+#include <utility>
 
 #include "function_store.h"
+#include "stats.h"
 
 namespace libasm {
 namespace driver {
 
 FunctionStore::Function::Function(const FunctionStore::Function &other)
-    : body(other.body), paramsAt(other.paramsAt), parser(other.parser), symtab(other.symtab) {}
+    : body(other.body),
+      paramsAt(other.paramsAt),
+      parser(other.parser),
+      symtab(other.symtab),
+      program(paramsAt) {}
 
 bool FunctionStore::Function::operator==(const FunctionStore::Function &other) const {
     return body == other.body && paramsAt == other.paramsAt;
@@ -35,12 +41,6 @@ bool FunctionStore::operator==(const FunctionStore &other) const {
     return _functions == other._functions;
 }
 
-void FunctionStore::copy(const FunctionStore &other) {
-    clear();
-    for (auto it : other._functions)
-        _functions.emplace(it.first, it.second);
-}
-
 void FunctionStore::clear() {
     _functions.clear();
 }
@@ -86,12 +86,21 @@ const Functor *FunctionStore::Binding::lookupFunction(const StrScanner &symbol)
 
 Error FunctionStore::Function::eval(
         ValueStack &stack, ParserContext &parent, uint_fast8_t argc) const {
-    StrScanner body_scan(body.c_str());
+    stats::count(stats::FUNCTION_EVAL);
     ErrorAt error;
     Binding binding{paramsAt, stack, parent.symbolTable};
     ParserContext context{parent};
     context.symbolTable = &binding;
-    const auto val = parser.eval(body_scan, error, context);
+    Value val;
+    if (program.recordedIn(context)) {
+        val = program.run(stack, context, parent.symbolTable, error);
+    } else {
+        StrScanner body_scan(body.c_str());
+        Program recorder{paramsAt, context};
+        val = parser.eval(body_scan, error, context, &recorder);
+        if (error.getError() == OK && recorder.recordable())
+            program.swap(recorder);
+    }
     while (argc) {
         stack.pop();
         argc--;
@@ -100,6 +109,81 @@ Error FunctionStore::Function::eval(
     return error.getError();
 }
 
+void FunctionStore::Program::pushValue(const Value &value) {
+    steps.emplace_back(Step::VALUE);
+    steps.back().value = value;
+}
+
+void FunctionStore::Program::pushSymbol(const StrScanner &symbol) {
+    const std::string name(symbol.str(), symbol.size());
+    const auto it = paramsAt.find(name);
+    if (it != paramsAt.end()) {
+        steps.emplace_back(Step::PARAM, it->second);
+    } else if (symbols.size() < UINT16_MAX) {
+        steps.emplace_back(Step::SYMBOL, symbols.size());
+        symbols.emplace_back(name);
+    } else {
+        valid = false;
+    }
+}
+
+void FunctionStore::Program::pushLocation() {
+    steps.emplace_back(Step::LOCATION);
+}
+
+void FunctionStore::Program::evalOperator(const Operator &opr, int_fast8_t argc) {
+    steps.emplace_back(Step::OPERATOR, argc);
+    steps.back().opr = opr;
+}
+
+void FunctionStore::Program::swap(Program &other) {
+    steps.swap(other.steps);
+    symbols.swap(other.symbols);
+    std::swap(valid, other.valid);
+    std::swap(radix, other.radix);
+    std::swap(delimitor, other.delimitor);
+}
+
+Value FunctionStore::Program::run(const ValueStack &args, ParserContext &context,
+        const SymbolTable *parent, ErrorAt &error) const {
+    ValueStack vstack;
+    for (const auto &step : steps) {
+        switch (step.kind) {
+        case Step::VALUE:
+            vstack.push(step.value);
+            break;
+        case Step::PARAM:
+            vstack.push(args.at(step.index));
+            break;
+        case Step::SYMBOL: {
+            // A symbol which is not a parameter is looked up in |parent| directly.
+            const auto &name = symbols[step.index];
+            const StrScanner symbol{name.c_str(), name.c_str() + name.size()};
+            const auto *value = parent ? parent->lookupSymbol(symbol) : nullptr;
+            if (value) {
+                vstack.push(*value);
+            } else {
+                error.setErrorIf(UNDEFINED_SYMBOL);
+                vstack.push(Value());
+            }
+            break;
+        }
+        case Step::LOCATION:
+            vstack.pushUnsigned(context.currentLocation);
+            break;
+        case Step::OPERATOR: {
+            const auto err = step.opr.eval(vstack, context, step.index);
+            if (err) {
+                error.setErrorIf(err);
+                return Value();
+            }
+            break;
+        }
+        }
+    }
+    return vstack.pop();
+}
+
 }  // namespace driver
 }  // namespace libasm
 
@@ -20,6 +20,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "error_reporter.h"
 #include "str_scanner.h"
@@ -33,8 +34,8 @@ struct FunctionStore final {
 
     bool operator==(const FunctionStore &other) const;
     bool operator!=(const FunctionStore &other) const { return !(*this == other); }
-    void copy(const FunctionStore &other);
     void clear();
+    void swap(FunctionStore &other) { _functions.swap(other._functions); }
 
     bool hasFunction(const StrScanner &name) const;
     const Functor *lookupFunction(const StrScanner &symbol) const;
@@ -46,10 +47,74 @@ struct FunctionStore final {
 private:
     using ParametersAt = std::map<const std::string, int>;
 
+    /**
+     * Evaluation steps of a function body in postfix order. Steps are recorded by the first
+     * successful evaluation of the body, and replayed by the following evaluations without
+     * parsing the body.
+     *
+     * A body is parsed in the context of each call, as it was before steps were recorded, so
+     * that steps can't be recorded when the function is defined. Parsing depends on the
+     * |ValueParser| of the function, which is immutable, and on the default radix and the
+     * delimitor of the calling context. Steps are keyed on both and recorded again when either differs. Symbols and the
+     * current location are looked up when steps are replayed, and functions called in a body
+     * are cleared together with their callers at each pass.
+     */
+    struct Program final : ValueRecorder {
+        Program(const ParametersAt &paramsAt_, const ParserContext &context = ParserContext())
+            : paramsAt(paramsAt_),
+              valid(true),
+              radix(context.defaultRadix),
+              delimitor(context.delimitor) {}
+
+        void pushValue(const Value &value) override;
+        void pushSymbol(const StrScanner &symbol) override;
+        void pushLocation() override;
+        void evalOperator(const Operator &opr, int_fast8_t argc) override;
+        void unrecordable() override { valid = false; }
+
+        /** Returns true if steps have been recorded in the same parsing state as |context|. */
+        bool recordedIn(const ParserContext &context) const {
+            return !steps.empty() && radix == context.defaultRadix &&
+                   delimitor == context.delimitor;
+        }
+        bool recordable() const { return valid; }
+        void swap(Program &other);
+        Value run(const ValueStack &args, ParserContext &context, const SymbolTable *parent,
+                ErrorAt &error) const;
+
+    private:
+        struct Step final {
+            enum Kind : uint8_t {
+                VALUE,
+                PARAM,
+                SYMBOL,
+                LOCATION,
+                OPERATOR,
+            };
+            Step(Kind kind_, uint16_t index_ = 0) : kind(kind_), index(index_) {}
+            Kind kind;
+            /** Index of parameter or symbol, or number of operator arguments */
+            uint16_t index;
+            Value value;
+            Operator opr;
+        };
+
+        const ParametersAt &paramsAt;
+        bool valid;
+        Radix radix;
+        char delimitor;
+        std::vector<Step> steps;
+        std::vector<std::string> symbols;
+    };
+
     struct Function final : Functor {
         Function(const std::string &body_, const ParametersAt &paramsAt_,
                 const ValueParser &parser_, const SymbolTable *symtab_)
-            : body(body_), paramsAt(paramsAt_), parser(parser_), symtab(symtab_) {}
+            : body(body_),
+              paramsAt(paramsAt_),
+              parser(parser_),
+              symtab(symtab_),
+              program(paramsAt) {}
         Function(const Function &other);
 
         bool operator==(const Function &other) const;
@@ -62,6 +127,7 @@ private:
         const ParametersAt paramsAt;
         const ValueParser &parser;
         const SymbolTable *const symtab;
+        mutable Program program;
     };
 
     /**
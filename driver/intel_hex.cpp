@@ -86,12 +86,18 @@ void IntelHex::encodeLine(TextPrinter &out, uint16_t addr, const uint8_t *data,
     addSum16(addr);
     addSum8(type);
     // :LLaaaa00dd....ddSS
-    out.format(":%02X%04X%02X", size, addr, type);
-    for (uint_fast8_t i = 0; i < size; i++) {
+    char line[1 + 2 + 4 + 2 + UINT8_MAX * 2 + 2 + 1];
+    auto p = line;
+    *p++ = ':';
+    p = formatHex(p, size, 2);
+    p = formatHex(p, addr, 4);
+    p = formatHex(p, type, 2);
+    for (uint_fast8_t i = 0; i < size; i++)
         addSum8(data[i]);
-        out.format("%02X", data[i]);
-    }
-    out.format("%02X\n", getSum());
+    p = formatBytes(p, data, size);
+    p = formatHex(p, getSum(), 2);
+    *p = 0;
+    out.println(line);
 }
 
 void IntelHex::end(TextPrinter &out) {
@@ -137,13 +143,10 @@ int IntelHex::decode(StrScanner &line, BinMemory &memory) {
         return 0;  // ignore 01, 03, 05 record
 
     const uint32_t ela_addr = _next_addr | addr;
-    for (uint8_t i = 0; i < len; i++) {
-        uint8_t data = 0;
-        if (!parseByte(line, data))
-            return -1;
-        addSum8(data);
-        memory.writeByte(ela_addr + i, data);
-    }
+    uint8_t data[UINT8_MAX];
+    if (!parseBytes(line, data, len, _check_sum))
+        return -1;
+    memory.write(ela_addr, data, len);
     uint8_t sum = 0;
     if (!parseByte(line, sum))
         return -1;
@@ -43,26 +43,32 @@ void MotoSrec::encode(TextPrinter &out, uint32_t addr, const uint8_t *data, uint
     _last_addr = addr;
     const auto len = _address_size + size + 1;
     addSum8(len);
+    // Snnaa..aadd....ddss
+    char line[2 + 2 + 4 * 2 + UINT8_MAX * 2 + 2 + 1];
+    auto p = line;
+    *p++ = 'S';
     switch (_address_size) {
     case 2:
-        out.format("S1%02X%04X", len, static_cast<uint16_t>(addr));
+        *p++ = '1';
         addSum16(addr);
         break;
     case 3:
-        out.format("S2%02X%02X%04X", len, static_cast<uint8_t>(addr >> 16),
-                static_cast<uint16_t>(addr));
+        *p++ = '2';
         addSum24(addr);
         break;
     default:
-        out.format("S3%02X%08X", len, static_cast<uint32_t>(addr));
+        *p++ = '3';
         addSum32(addr);
         break;
     }
-    for (uint_fast8_t i = 0; i < size; i++) {
-        out.format("%02X", data[i]);
+    p = formatHex(p, len, 2);
+    p = formatHex(p, addr, _address_size * 2);
+    for (uint_fast8_t i = 0; i < size; i++)
         addSum8(data[i]);
-    }
-    out.format("%02X\n", getSum());
+    p = formatBytes(p, data, size);
+    p = formatHex(p, getSum(), 2);
+    *p = 0;
+    out.println(line);
 }
 
 void MotoSrec::end(TextPrinter &out) {
@@ -123,13 +129,10 @@ int MotoSrec::decode(StrScanner &line, BinMemory &memory) {
     if (len < 1)
         return -2;
     const auto size = len - 1;
-    for (uint_fast8_t i = 0; i < size; i++) {
-        uint8_t data = 0;
-        if (!parseByte(line, data))
-            return -1;
-        addSum8(data);
-        memory.writeByte(addr + i, data);
-    }
+    uint8_t data[UINT8_MAX];
+    if (!parseBytes(line, data, size, _check_sum))
+        return -1;
+    memory.write(addr, data, size);
     const auto sum = getSum();
     uint8_t val8 = 0;
     if (!parseByte(line, val8))
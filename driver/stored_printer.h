@@ -19,19 +19,29 @@
 
 #include "text_printer.h"
 
+#include <algorithm>
 #include <cstdarg>
 #include <cstdio>
 #include <cstring>
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace libasm {
 namespace driver {
 
+/**
+ * TextPrinter which stores printed lines. Lines are stored in blocks of an arena, each line is
+ * terminated by NUL. A line returned by |line| stays valid until |clear|.
+ */
 struct StoredPrinter : TextPrinter {
-    StoredPrinter() : _buffer() {}
+    StoredPrinter() : _buffer(), _blocks(), _used(0), _lines() {}
 
     void println(const char *text) override {
+        if (_buffer.empty() && std::strchr(text, '\n') == nullptr) {
+            _lines.push_back(append(text, std::strlen(text)));
+            return;
+        }
         _buffer += text;
         _buffer += '\n';
         split();
@@ -49,19 +59,47 @@ struct StoredPrinter : TextPrinter {
         split();
     }
 
-    void clear() { _lines.clear(); }
+    void clear() {
+        _blocks.clear();
+        _used = 0;
+        _lines.clear();
+    }
     size_t size() const { return _lines.size(); }
-    const char *line(int lineno) const { return _lines[lineno - 1].c_str(); }
+    const char *line(int lineno) const { return _lines[lineno - 1]; }
+    void replace(int lineno, const std::string &text) {
+        _lines[lineno - 1] = append(text.c_str(), text.size());
+    }
 
 private:
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;
+    /** Text which is not terminated by newline yet */
     std::string _buffer;
-    std::vector<std::string> _lines;
+    /** Blocks are never moved, a line longer than |BLOCK_SIZE| has its own block */
+    std::vector<std::unique_ptr<char[]>> _blocks;
+    /** Bytes used in the last block */
+    size_t _used;
+    std::vector<const char *> _lines;
+
+    const char *append(const char *text, size_t len) {
+        if (_blocks.empty() || _used + len + 1 > BLOCK_SIZE) {
+            _blocks.emplace_back(new char[std::max(len + 1, BLOCK_SIZE)]);
+            _used = 0;
+        }
+        auto *p = _blocks.back().get() + _used;
+        std::memcpy(p, text, len);
+        p[len] = 0;
+        _used += len + 1;
+        return p;
+    }
 
     void split() {
-        for (auto pos = _buffer.find('\n'); pos != std::string::npos; pos = _buffer.find('\n')) {
-            _lines.emplace_back(_buffer.c_str(), pos);
-            _buffer = _buffer.substr(pos + 1);
+        size_t start = 0;
+        for (auto pos = _buffer.find('\n'); pos != std::string::npos;
+                pos = _buffer.find('\n', start)) {
+            _lines.push_back(append(_buffer.c_str() + start, pos - start));
+            start = pos + 1;
         }
+        _buffer.erase(0, start);
     }
 };
 
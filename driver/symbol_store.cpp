@@ -16,32 +16,118 @@
 
 #include "symbol_store.h"
 
+#include <cstring>
+
+#include "stats.h"
+
 namespace libasm {
 namespace driver {
 
-SymbolStoreImpl::SymbolStoreImpl() : _functions() {}
+bool SymbolMap::operator==(const SymbolMap &other) const {
+    if (size() != other.size())
+        return false;
+    for (const auto &e : _entries) {
+        const auto *value = other.find(StrScanner(e.name.c_str()));
+        if (value == nullptr || !(*value == e.value))
+            return false;
+    }
+    return true;
+}
+
+void SymbolMap::clear() {
+    _entries.clear();
+    _slots.clear();
+    _mask = 0;
+}
+
+uint32_t SymbolMap::hash(const StrScanner &name) {
+    // FNV-1a
+    uint32_t h = 2166136261U;
+    for (const auto *p = name.str(); p < name.str() + name.size(); p++) {
+        h ^= static_cast<uint8_t>(*p);
+        h *= 16777619U;
+    }
+    return h;
+}
+
+size_t SymbolMap::probe(const StrScanner &name, uint32_t hash) const {
+    const auto len = name.size();
+    for (auto i = hash & _mask;; i = (i + 1) & _mask) {
+        const auto slot = _slots[i];
+        if (slot == 0)
+            return i;
+        const auto &e = _entries[slot - 1];
+        if (e.hash == hash && e.name.size() == len && memcmp(e.name.data(), name.str(), len) == 0)
+            return i;
+    }
+}
+
+const Value *SymbolMap::find(const StrScanner &name) const {
+    if (_entries.empty())
+        return nullptr;
+    const auto slot = _slots[probe(name, hash(name))];
+    return slot ? &_entries[slot - 1].value : nullptr;
+}
+
+std::pair<Value *, bool> SymbolMap::insert(const StrScanner &name, const Value &value) {
+    // Keep the load factor at most 3/4.
+    if ((_entries.size() + 1) * 4 > _slots.size() * 3)
+        grow();
+    const auto h = hash(name);
+    const auto i = probe(name, h);
+    if (_slots[i])
+        return std::make_pair(&_entries[_slots[i] - 1].value, false);
+    _entries.emplace_back(name, h, value);
+    _slots[i] = _entries.size();
+    return std::make_pair(&_entries.back().value, true);
+}
+
+void SymbolMap::grow() {
+    const auto size = _slots.empty() ? 64 : _slots.size() * 2;
+    _slots.assign(size, 0);
+    _mask = size - 1;
+    for (size_t n = 0; n < _entries.size(); n++) {
+        auto i = _entries[n].hash & _mask;
+        while (_slots[i])
+            i = (i + 1) & _mask;
+        _slots[i] = n + 1;
+    }
+}
+
+SymbolStoreImpl::SymbolStoreImpl() : _functions(), _lastFunctions(), _unresolved(0), _changed(false) {}
 
 bool SymbolStoreImpl::operator==(const SymbolStoreImpl &other) const {
     return _symbols == other._symbols && _variables == other._variables &&
            _functions == other._functions;
 }
 
-void SymbolStoreImpl::copy(const SymbolStoreImpl &other) {
-    clear();
-    for (auto &it : other._symbols)
-        _symbols.emplace(it.first, it.second);
-    for (auto &it : other._variables)
-        _variables.emplace(it.first, it.second);
-    _functions.copy(other._functions);
-}
-
 void SymbolStoreImpl::clear() {
     _symbols.clear();
     _variables.clear();
-    clearFunctions();
+    _functions.clear();
+    _lastFunctions.clear();
+    resetChanges();
+}
+
+void SymbolStoreImpl::resetChanges() {
+    _changed = false;
+    _origins.clear();
+}
+
+bool SymbolStoreImpl::changed() const {
+    if (_changed || _functions != _lastFunctions)
+        return true;
+    // A variable may be changed several times and end up with the original value.
+    for (const auto &it : _origins) {
+        if (!(*it.first == it.second))
+            return true;
+    }
+    return false;
 }
 
 void SymbolStoreImpl::clearFunctions() {
+    // Each pass defines functions again, which may differ from the last pass.
+    _lastFunctions.swap(_functions);
     _functions.clear();
 }
 
@@ -49,21 +135,22 @@ bool SymbolStoreImpl::hasSymbol(const StrScanner &symbol) const {
     return hasValue(symbol, false) || hasValue(symbol, true);
 }
 
+const Value *SymbolStoreImpl::findSymbol(const StrScanner &symbol) const {
+    const auto value = _symbols.find(symbol);
+    return value ? value : _variables.find(symbol);
+}
+
 const Value *SymbolStoreImpl::lookupSymbol(const StrScanner &symbol) const {
-    const auto key = std::string(symbol.str(), symbol.size());
-    const auto s = _symbols.find(key);
-    if (s != _symbols.end())
-        return &s->second;
-    const auto v = _variables.find(key);
-    if (v != _variables.end())
-        return &v->second;
-    return nullptr;
+    stats::count(stats::SYMBOL_LOOKUP);
+    const auto value = findSymbol(symbol);
+    if (value == nullptr || value->isUndefined())
+        ++_unresolved;
+    return value;
 }
 
 bool SymbolStoreImpl::hasValue(const StrScanner &symbol, bool variable) const {
     const auto &map = variable ? _variables : _symbols;
-    const auto key = std::string(symbol.str(), symbol.size());
-    return map.find(key) != map.end();
+    return map.find(symbol) != nullptr;
 }
 
 Error SymbolStoreImpl::internSymbol(const Value &value, const StrScanner &symbol, bool variable) {
@@ -72,9 +159,18 @@ Error SymbolStoreImpl::internSymbol(const Value &value, const StrScanner &symbol
     if (value.overflowUint32())
         return OVERFLOW_RANGE;
 
-    const auto key = std::string(symbol.str(), symbol.size());
     auto &map = variable ? _variables : _symbols;
-    map[key] = value;
+    const auto it = map.insert(symbol, value);
+    if (it.second) {
+        _changed = true;
+    } else if (!(*it.first == value)) {
+        if (variable) {
+            _origins.emplace(it.first, *it.first);  // keep the first original value
+        } else {
+            _changed = true;
+        }
+        *it.first = value;
+    }
     return OK;
 }
 
@@ -17,8 +17,12 @@
 #ifndef __LIBASM_SYMBOL_STORE_H__
 #define __LIBASM_SYMBOL_STORE_H__
 
+#include <cstdint>
+#include <deque>
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "error_reporter.h"
 #include "function_store.h"
@@ -38,14 +42,60 @@ struct SymbolStore : SymbolTable {
             const StrScanner &body, const ValueParser &parser) = 0;
 };
 
+/**
+ * Open addressing hash table of values keyed by symbol name.
+ *
+ * Names are owned by the table and are looked up by StrScanner without any allocation. Entries
+ * never move once inserted, so that a pointer to a value stays valid until |clear|.
+ */
+struct SymbolMap final {
+    SymbolMap() : _mask(0) {}
+
+    bool operator==(const SymbolMap &other) const;
+    bool empty() const { return _entries.empty(); }
+    size_t size() const { return _entries.size(); }
+    void clear();
+    const Value *find(const StrScanner &name) const;
+    /** Returns the value of |name| and true if it has been newly inserted */
+    std::pair<Value *, bool> insert(const StrScanner &name, const Value &value);
+
+private:
+    struct Entry {
+        Entry(const StrScanner &name, uint32_t hash, const Value &value)
+            : name(name.str(), name.size()), hash(hash), value(value) {}
+        const std::string name;
+        const uint32_t hash;
+        Value value;
+    };
+    std::deque<Entry> _entries;
+    /** Index of |_entries| plus one, or zero for an empty slot */
+    std::vector<uint32_t> _slots;
+    size_t _mask;
+
+    static uint32_t hash(const StrScanner &name);
+    size_t probe(const StrScanner &name, uint32_t hash) const;
+    void grow();
+};
+
 struct SymbolStoreImpl final : SymbolStore {
     explicit SymbolStoreImpl();
 
     bool operator==(const SymbolStoreImpl &other) const;
     bool operator!=(const SymbolStoreImpl &other) const { return !(*this == other); }
-    void copy(const SymbolStoreImpl &other);
     void clear();
     void clearFunctions();
+    bool empty() const { return _symbols.empty() && _variables.empty(); }
+    /** Number of symbol lookups which found no value so far */
+    uint32_t unresolved() const { return _unresolved; }
+    /** Start tracking changes of symbol values from now */
+    void resetChanges();
+    /**
+     * Returns true if any symbol value differs from the one at the last |resetChanges|, or
+     * functions differ from the ones defined before the last |clearFunctions|.
+     */
+    bool changed() const;
+    /** Returns the value of |symbol| without counting a lookup which found no value */
+    const Value *findSymbol(const StrScanner &symbol) const;
 
     // SymbolTable
     const char *lookupValue(const Value &) const override { return nullptr; }
@@ -62,9 +112,15 @@ struct SymbolStoreImpl final : SymbolStore {
             const StrScanner &body, const ValueParser &parser) override;
 
 private:
-    std::map<std::string, Value> _symbols;
-    std::map<std::string, Value> _variables;
+    SymbolMap _symbols;
+    SymbolMap _variables;
     FunctionStore _functions;
+    /** Functions which were defined before the last |clearFunctions| */
+    FunctionStore _lastFunctions;
+    mutable uint32_t _unresolved;
+    bool _changed;
+    /** Values of variables at the last |resetChanges| which have been changed since then */
+    std::map<const Value *, Value> _origins;
 };
 
 }  // namespace driver
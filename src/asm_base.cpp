@@ -44,7 +44,19 @@ PROGMEM constexpr Pseudos PSEUDO_TABLE{ARRAY_RANGE(PSEUDOS)};
 
 Assembler::Assembler(
         const ValueParser::Plugins &plugins, const Pseudos &pseudos, const OptionBase *option)
-    : _parser(plugins),
+    : Assembler(ValueParser(plugins), pseudos, option) {}
+
+Assembler::Assembler(const Assembler &other, const OptionBase *option)
+    : Assembler(other._parser, *other._pseudos, option) {
+    _inputRadix = other._inputRadix;
+    _listRadix = other._listRadix;
+    _smartBranch = other._smartBranch;
+    _symtab = other._symtab;
+    _currentLocation = other._currentLocation;
+}
+
+Assembler::Assembler(const ValueParser &parser, const Pseudos &pseudos, const OptionBase *option)
+    : _parser(parser),
       _pseudos(&pseudos),
       _commonOptions(&_opt_listRadix),
       _options(option),
@@ -32,6 +32,13 @@ namespace libasm {
 struct Assembler {
     virtual ~Assembler() {}
 
+    /**
+     * Create a new instance of the same assembler which has the same CPU, options and current
+     * location. The caller owns the returned instance. Instances share no mutable state, so that
+     * each thread can encode with its own instance.
+     */
+    virtual Assembler *clone() const = 0;
+
     Error encode(const char *line, Insn &insn, const SymbolTable *symtab = nullptr);
     virtual const ConfigBase &config() const = 0;
     virtual void reset();
@@ -103,6 +110,12 @@ protected:
     Assembler(const ValueParser::Plugins &plugins, const pseudo::Pseudos &pseudos,
             const OptionBase *option = nullptr);
 
+    /**
+     * Copy settings of |other| and construct options of this instance. |option| is the head of
+     * options of a derived class, which must construct its own options likewise.
+     */
+    Assembler(const Assembler &other, const OptionBase *option = nullptr);
+
     Error setInputRadix(Radix radix) {
         _inputRadix = radix;
         return OK;
@@ -114,6 +127,8 @@ protected:
             ErrorAt &error) const;
 
 private:
+    Assembler(const ValueParser &parser, const pseudo::Pseudos &pseudos, const OptionBase *option);
+
     virtual ConfigSetter &configSetter() = 0;
     virtual Error encodeImpl(StrScanner &scan, Insn &insn) const = 0;
 };
@@ -58,6 +58,16 @@ AsmCdp1802::AsmCdp1802(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmCdp1802::AsmCdp1802(const AsmCdp1802 &other)
+    : Assembler(other, &_opt_useReg),
+      Config(other),
+      _opt_useReg(this, &AsmCdp1802::setUseReg, OPT_BOOL_USE_REGISTER, OPT_DESC_USE_REGISTER),
+      _useReg(other._useReg) {}
+
+Assembler *AsmCdp1802::clone() const {
+    return new AsmCdp1802(*this);
+}
+
 void AsmCdp1802::reset() {
     Assembler::reset();
     setUseReg(true);
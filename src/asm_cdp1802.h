@@ -28,6 +28,9 @@ const ValueParser::Plugins &defaultPlugins();
 
 struct AsmCdp1802 final : Assembler, Config {
     AsmCdp1802(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmCdp1802(const AsmCdp1802 &other);
+
+    Assembler *clone() const override;
 
     void reset() override;
 
@@ -96,6 +96,10 @@ AsmCp1600::AsmCp1600(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmCp1600::clone() const {
+    return new AsmCp1600(*this);
+}
+
 void AsmCp1600::reset() {
     Assembler::reset();
     setInputRadix(RADIX_8);
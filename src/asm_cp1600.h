@@ -27,6 +27,8 @@ namespace cp1600 {
 struct AsmCp1600 final : Assembler, Config {
     AsmCp1600(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
     void reset() override;
 
 private:
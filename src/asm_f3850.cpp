@@ -56,6 +56,10 @@ AsmF3850::AsmF3850(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmF3850::clone() const {
+    return new AsmF3850(*this);
+}
+
 Error AsmF3850::parseOperand(StrScanner &scan, Operand &op) const {
     op.setAt(scan.skipSpaces());
     auto p = scan;
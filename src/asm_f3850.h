@@ -27,6 +27,8 @@ namespace f3850 {
 struct AsmF3850 final : Assembler, Config {
     AsmF3850(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseOperand(StrScanner &scan, Operand &op) const;
 
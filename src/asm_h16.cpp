@@ -386,6 +386,10 @@ AsmH16::AsmH16(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmH16::clone() const {
+    return new AsmH16(*this);
+}
+
 Error AsmH16::parseOperand(StrScanner &scan, Operand &op) const {
     auto p = scan.skipSpaces();
     op.setAt(p);
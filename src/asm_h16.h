@@ -27,6 +27,8 @@ namespace h16 {
 struct AsmH16 final : Assembler, Config {
     AsmH16(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseOperand(StrScanner &scan, Operand &op) const;
     Error parseIndirect(StrScanner &scan, Operand &op) const;
@@ -67,6 +67,17 @@ AsmH8300::AsmH8300(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmH8300::AsmH8300(const AsmH8300 &other)
+    : Assembler(other, &_opt_advancedMode),
+      Config(other),
+      _opt_advancedMode(this, &Config::setAdvancedMode,
+              ::libasm::text::h8300::OPT_BOOL_ADVANCED_MODE,
+              ::libasm::text::h8300::OPT_DESC_ADVANCED_MODE) {}
+
+Assembler *AsmH8300::clone() const {
+    return new AsmH8300(*this);
+}
+
 RegName AsmH8300::parseRegOperand(StrScanner &scan) const {
     const auto reg = parseRegName(scan, parser());
     if (reg == REG_SP)
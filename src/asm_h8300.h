@@ -26,6 +26,9 @@ namespace h8300 {
 
 struct AsmH8300 final : Assembler, Config {
     AsmH8300(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmH8300(const AsmH8300 &other);
+
+    Assembler *clone() const override;
 
 private:
     const BoolOption<Config> _opt_advancedMode;
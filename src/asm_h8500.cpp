@@ -107,6 +107,15 @@ AsmH8500::AsmH8500(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmH8500::AsmH8500(const AsmH8500 &other)
+    : Assembler(other, &_opt_maxMode),
+      Config(other),
+      _opt_maxMode(this, &Config::setMaxMode, OPT_BOOL_MAX_MODE, OPT_DESC_MAX_MODE) {}
+
+Assembler *AsmH8500::clone() const {
+    return new AsmH8500(*this);
+}
+
 void AsmH8500::reset() {
     Assembler::reset();
     setMaxMode(false);
@@ -26,6 +26,9 @@ namespace h8500 {
 
 struct AsmH8500 final : Assembler, Config {
     AsmH8500(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmH8500(const AsmH8500 &other);
+
+    Assembler *clone() const override;
 
 private:
     const BoolOption<Config> _opt_maxMode;
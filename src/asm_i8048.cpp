@@ -47,6 +47,10 @@ AsmI8048::AsmI8048(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmI8048::clone() const {
+    return new AsmI8048(*this);
+}
+
 Error AsmI8048::parseOperand(StrScanner &scan, Operand &op) const {
     auto p = scan.skipSpaces();
     op.setAt(p);
@@ -27,6 +27,8 @@ namespace i8048 {
 struct AsmI8048 final : Assembler, Config {
     AsmI8048(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseOperand(StrScanner &scan, Operand &op) const;
 
@@ -47,6 +47,10 @@ AsmI8051::AsmI8051(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmI8051::clone() const {
+    return new AsmI8051(*this);
+}
+
 Error AsmI8051::parseOperand(StrScanner &scan, Operand &op) const {
     auto p = scan.skipSpaces();
     op.setAt(p);
@@ -27,6 +27,8 @@ namespace i8051 {
 struct AsmI8051 final : Assembler, Config {
     AsmI8051(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseOperand(StrScanner &scan, Operand &op) const;
 
@@ -61,6 +61,16 @@ AsmI8080::AsmI8080(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmI8080::AsmI8080(const AsmI8080 &other)
+    : Assembler(other, &_opt_zilog),
+      Config(other),
+      _opt_zilog(this, &AsmI8080::setZilogSyntax, OPT_BOOL_ZILOG_SYNTAX, OPT_DESC_ZILOG_SYNTAX),
+      _zilogSyntax(other._zilogSyntax) {}
+
+Assembler *AsmI8080::clone() const {
+    return new AsmI8080(*this);
+}
+
 void AsmI8080::reset() {
     Assembler::reset();
     setZilogSyntax(false);
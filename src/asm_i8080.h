@@ -26,6 +26,9 @@ namespace i8080 {
 
 struct AsmI8080 final : Assembler, Config {
     AsmI8080(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmI8080(const AsmI8080 &other);
+
+    Assembler *clone() const override;
 
     void reset() override;
 
@@ -99,6 +99,22 @@ AsmI8086::AsmI8086(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmI8086::AsmI8086(const AsmI8086 &other)
+    : Assembler(other, &_opt_fpu),
+      Config(other),
+      _opt_fpu(this, &Config::setFpuName, OPT_TEXT_FPU, OPT_DESC_FPU, &_opt_use16),
+      _opt_use16(this, &Config::setUse16, OPT_BOOL_USE16, OPT_DESC_USE16, &_opt_use32),
+      _opt_use32(this, &Config::setUse32, OPT_BOOL_USE32, OPT_DESC_USE32, &_opt_optimizeSegment),
+      _opt_optimizeSegment(this, &AsmI8086::setOptimizeSegment, OPT_BOOL_OPTIMIZE_SEGMENT,
+              OPT_DESC_OPTIMIZE_SEGMENT, &_opt_gnuAs),
+      _opt_gnuAs(this, &AsmI8086::setGnuAs, OPT_BOOL_GNU_AS, OPT_DESC_GNU_AS),
+      _optimizeSegment(other._optimizeSegment),
+      _gnuAs(other._gnuAs) {}
+
+Assembler *AsmI8086::clone() const {
+    return new AsmI8086(*this);
+}
+
 void AsmI8086::reset() {
     Assembler::reset();
     setFpuType(FPU_NONE);
@@ -27,6 +27,9 @@ namespace i8086 {
 
 struct AsmI8086 final : Assembler, Config {
     AsmI8086(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmI8086(const AsmI8086 &other);
+
+    Assembler *clone() const override;
 
     void reset() override;
 
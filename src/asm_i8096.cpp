@@ -51,6 +51,10 @@ AsmI8096::AsmI8096(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmI8096::clone() const {
+    return new AsmI8096(*this);
+}
+
 Error AsmI8096::parseIndirect(
         StrScanner &scan, Operand &op, const StrScanner &at, bool autoInc) const {
     auto p = scan;
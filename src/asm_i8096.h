@@ -27,6 +27,8 @@ namespace i8096 {
 struct AsmI8096 final : Assembler, Config {
     AsmI8096(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseIndirect(StrScanner &scan, Operand &opr, const StrScanner &at, bool autoInc) const;
     Error parseOperand(StrScanner &scan, Operand &opr) const;
@@ -53,6 +53,10 @@ AsmIns8060::AsmIns8060(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmIns8060::clone() const {
+    return new AsmIns8060(*this);
+}
+
 void AsmIns8060::encodeRel8(AsmInsn &insn, const Operand &op) const {
     Config::ptrdiff_t delta;
     if (op.mode == M_DISP) {
@@ -26,6 +26,8 @@ namespace ins8060 {
 struct AsmIns8060 final : Assembler, Config {
     AsmIns8060(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseOperand(StrScanner &scan, Operand &op) const;
 
@@ -53,6 +53,10 @@ AsmIns8070::AsmIns8070(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmIns8070::clone() const {
+    return new AsmIns8070(*this);
+}
+
 void AsmIns8070::emitAbsolute(AsmInsn &insn, const Operand &op) const {
     // PC will be +1 before fetching instruction.
     const auto target = op.getError() ? 0 : op.val.getUnsigned() - 1;
@@ -27,6 +27,8 @@ namespace ins8070 {
 struct AsmIns8070 final : Assembler, Config {
     AsmIns8070(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseOperand(StrScanner &scan, Operand &op) const;
 
@@ -49,6 +49,10 @@ AsmMc6800::AsmMc6800(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmMc6800::clone() const {
+    return new AsmMc6800(*this);
+}
+
 Error AsmMc6800::parseOperand(StrScanner &scan, Operand &op) const {
     auto p = scan.skipSpaces();
     op.setAt(p);
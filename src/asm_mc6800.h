@@ -27,6 +27,8 @@ namespace mc6800 {
 struct AsmMc6800 final : Assembler, Config {
     AsmMc6800(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseOperand(StrScanner &scan, Operand &op) const;
     void emitRelative(AsmInsn &insn, const Operand &op) const;
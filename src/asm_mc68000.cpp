@@ -90,6 +90,16 @@ AsmMc68000::AsmMc68000(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmMc68000::AsmMc68000(const AsmMc68000 &other)
+    : Assembler(other, &_opt_fpu),
+      Config(other),
+      _opt_fpu(this, &Config::setFpuName, OPT_TEXT_FPU, OPT_DESC_FPU, &_opt_pmmu),
+      _opt_pmmu(this, &Config::setPmmuName, OPT_TEXT_PMMU, OPT_DESC_PMMU) {}
+
+Assembler *AsmMc68000::clone() const {
+    return new AsmMc68000(*this);
+}
+
 void AsmMc68000::reset() {
     Assembler::reset();
     setFpuCid(DEFAULT_FPU_CID);
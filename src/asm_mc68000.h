@@ -26,6 +26,9 @@ namespace mc68000 {
 
 struct AsmMc68000 final : Assembler, Config {
     AsmMc68000(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmMc68000(const AsmMc68000 &other);
+
+    Assembler *clone() const override;
 
     void reset() override;
 
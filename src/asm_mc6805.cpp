@@ -54,6 +54,16 @@ AsmMc6805::AsmMc6805(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmMc6805::AsmMc6805(const AsmMc6805 &other)
+    : Assembler(other, &_opt_pc_bits),
+      Config(other),
+      _opt_pc_bits(this, &AsmMc6805::setPcBits, OPT_INT_PCBITS, OPT_DESC_PCBITS),
+      _pc_bits(other._pc_bits) {}
+
+Assembler *AsmMc6805::clone() const {
+    return new AsmMc6805(*this);
+}
+
 void AsmMc6805::reset() {
     Assembler::reset();
     setPcBits(0);
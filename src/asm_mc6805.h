@@ -26,6 +26,9 @@ namespace mc6805 {
 
 struct AsmMc6805 final : Assembler, Config {
     AsmMc6805(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmMc6805(const AsmMc6805 &other);
+
+    Assembler *clone() const override;
 
     AddressWidth addressWidth() const override;
     void reset() override;
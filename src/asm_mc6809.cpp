@@ -52,6 +52,16 @@ AsmMc6809::AsmMc6809(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmMc6809::AsmMc6809(const AsmMc6809 &other)
+    : Assembler(other),
+      Config(other),
+      _opt_setdp(this, &AsmMc6809::setDirectPage, OPT_INT_SETDP),
+      _direct_page(other._direct_page) {}
+
+Assembler *AsmMc6809::clone() const {
+    return new AsmMc6809(*this);
+}
+
 void AsmMc6809::reset() {
     Assembler::reset();
     setDirectPage(0);
@@ -26,6 +26,9 @@ namespace mc6809 {
 
 struct AsmMc6809 final : Assembler, Config {
     AsmMc6809(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmMc6809(const AsmMc6809 &other);
+
+    Assembler *clone() const override;
 
     void reset() override;
 
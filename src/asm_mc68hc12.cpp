@@ -48,6 +48,10 @@ AsmMc68HC12::AsmMc68HC12(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmMc68HC12::clone() const {
+    return new AsmMc68HC12(*this);
+}
+
 Config::ptrdiff_t AsmMc68HC12::calculateDisplacement(
         AsmInsn &insn, const Operand &op, AddrMode mode) const {
     if (mode == M_RL8) {
@@ -27,6 +27,8 @@ namespace mc68hc12 {
 struct AsmMc68HC12 final : Assembler, Config {
     AsmMc68HC12(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseOperand(StrScanner &scan, Operand &op) const;
 
@@ -48,6 +48,10 @@ AsmMc68HC16::AsmMc68HC16(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmMc68HC16::clone() const {
+    return new AsmMc68HC16(*this);
+}
+
 Config::ptrdiff_t AsmMc68HC16::calculateDisplacement(AsmInsn &insn, const Operand &op) const {
     const auto base = insn.address() + PC_OFFSET;
     const auto target = op.getError() ? base : op.val.getUnsigned();
@@ -27,6 +27,8 @@ namespace mc68hc16 {
 struct AsmMc68HC16 final : Assembler, Config {
     AsmMc68HC16(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseOperand(StrScanner &scan, Operand &op) const;
 
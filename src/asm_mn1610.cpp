@@ -55,6 +55,10 @@ AsmMn1610::AsmMn1610(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmMn1610::clone() const {
+    return new AsmMn1610(*this);
+}
+
 void AsmMn1610::encodeIcRelative(AsmInsn &insn, const Operand &op) const {
     const auto delta = branchDelta(insn.address(), op.val.getUnsigned(), insn, op);
     if (overflowDelta(delta, 8))
@@ -27,6 +27,8 @@ namespace mn1610 {
 struct AsmMn1610 final : Assembler, Config {
     AsmMn1610(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseOperand(StrScanner &scan, Operand &op) const;
 
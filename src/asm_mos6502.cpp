@@ -65,6 +65,18 @@ AsmMos6502::AsmMos6502(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmMos6502::AsmMos6502(const AsmMos6502 &other)
+    : Assembler(other),
+      Config(other),
+      _opt_longa(this, &AsmMos6502::setLongAccumulator, OPT_BOOL_LONGA),
+      _opt_longi(this, &AsmMos6502::setLongIndex, OPT_BOOL_LONGI),
+      _longAccumulator(other._longAccumulator),
+      _longIndex(other._longIndex) {}
+
+Assembler *AsmMos6502::clone() const {
+    return new AsmMos6502(*this);
+}
+
 void AsmMos6502::reset() {
     Assembler::reset();
     setLongAccumulator(false);
@@ -26,6 +26,9 @@ namespace mos6502 {
 
 struct AsmMos6502 final : Assembler, Config {
     AsmMos6502(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmMos6502(const AsmMos6502 &other);
+
+    Assembler *clone() const override;
 
     void reset() override;
 
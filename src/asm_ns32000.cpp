@@ -76,6 +76,16 @@ AsmNs32000::AsmNs32000(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmNs32000::AsmNs32000(const AsmNs32000 &other)
+    : Assembler(other, &_opt_fpu),
+      Config(other),
+      _opt_fpu(this, &Config::setFpuName, OPT_TEXT_FPU, OPT_DESC_FPU, &_opt_pmmu),
+      _opt_pmmu(this, &Config::setPmmuName, OPT_TEXT_PMMU, OPT_DESC_PMMU) {}
+
+Assembler *AsmNs32000::clone() const {
+    return new AsmNs32000(*this);
+}
+
 void AsmNs32000::reset() {
     Assembler::reset();
     setFpuType(FPU_NONE);
@@ -27,6 +27,9 @@ namespace ns32000 {
 
 struct AsmNs32000 final : Assembler, Config {
     AsmNs32000(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmNs32000(const AsmNs32000 &other);
+
+    Assembler *clone() const override;
 
     void reset() override;
 
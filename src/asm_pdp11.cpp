@@ -77,6 +77,17 @@ AsmPdp11::AsmPdp11(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmPdp11::AsmPdp11(const AsmPdp11 &other)
+    : Assembler(other, &_opt_implicitWord),
+      Config(other),
+      _opt_implicitWord(
+              this, &AsmPdp11::setImplicitWord, OPT_BOOL_IMPLICIT_WORD, OPT_DESC_IMPLICIT_WORD),
+      _implicitWord(other._implicitWord) {}
+
+Assembler *AsmPdp11::clone() const {
+    return new AsmPdp11(*this);
+}
+
 void AsmPdp11::reset() {
     Assembler::reset();
     setInputRadix(RADIX_8);
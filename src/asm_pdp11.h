@@ -26,6 +26,9 @@ namespace pdp11 {
 
 struct AsmPdp11 final : Assembler, Config {
     AsmPdp11(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmPdp11(const AsmPdp11 &other);
+
+    Assembler *clone() const override;
 
     void reset() override;
 
@@ -71,6 +71,17 @@ AsmPdp8::AsmPdp8(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmPdp8::AsmPdp8(const AsmPdp8 &other)
+    : Assembler(other, &_opt_implicitWord),
+      Config(other),
+      _opt_implicitWord(
+              this, &AsmPdp8::setImplicitWord, OPT_BOOL_IMPLICIT_WORD, OPT_DESC_IMPLICIT_WORD),
+      _implicitWord(other._implicitWord) {}
+
+Assembler *AsmPdp8::clone() const {
+    return new AsmPdp8(*this);
+}
+
 void AsmPdp8::reset() {
     Assembler::reset();
     setInputRadix(RADIX_8);
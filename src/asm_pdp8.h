@@ -26,6 +26,9 @@ namespace pdp8 {
 
 struct AsmPdp8 final : Assembler, Config {
     AsmPdp8(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmPdp8(const AsmPdp8 &other);
+
+    Assembler *clone() const override;
 
     void reset() override;
 
@@ -60,6 +60,10 @@ AsmScn2650::AsmScn2650(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmScn2650::clone() const {
+    return new AsmScn2650(*this);
+}
+
 Error AsmScn2650::parseOperand(StrScanner &scan, Operand &op) const {
     // Do not skip preceding spaces.
     op.setAt(scan);
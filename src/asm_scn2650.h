@@ -27,6 +27,8 @@ namespace scn2650 {
 struct AsmScn2650 final : Assembler, Config {
     AsmScn2650(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseOperand(StrScanner &scan, Operand &op) const;
 
@@ -75,6 +75,15 @@ AsmSuperH::AsmSuperH(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmSuperH::AsmSuperH(const AsmSuperH &other)
+    : Assembler(other, &_opt_fpu),
+      Config(other),
+      _opt_fpu(this, &Config::setFpuName, OPT_TEXT_FPU, OPT_DESC_FPU) {}
+
+Assembler *AsmSuperH::clone() const {
+    return new AsmSuperH(*this);
+}
+
 void AsmSuperH::reset() {
     Assembler::reset();
     setFpuType(FPU_NONE);  // assembler requires the FPU to be enabled explicitly
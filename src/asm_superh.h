@@ -26,6 +26,9 @@ namespace superh {
 
 struct AsmSuperH final : Assembler, Config {
     AsmSuperH(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmSuperH(const AsmSuperH &other);
+
+    Assembler *clone() const override;
 
     void reset() override;
 
@@ -44,6 +44,10 @@ AsmTlcs90::AsmTlcs90(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmTlcs90::clone() const {
+    return new AsmTlcs90(*this);
+}
+
 const ValueParser::Plugins &AsmTlcs90::defaultPlugins() {
     return ValueParser::Plugins::intel();
 }
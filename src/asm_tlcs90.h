@@ -29,6 +29,8 @@ struct Operand;
 struct AsmTlcs90 final : Assembler, Config {
     AsmTlcs90(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseOperand(StrScanner &scan, Operand &op) const;
     void encodeRelative(AsmInsn &insn, AddrMode mode, const Operand &op) const;
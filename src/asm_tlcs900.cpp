@@ -55,6 +55,15 @@ AsmTlcs900::AsmTlcs900(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmTlcs900::AsmTlcs900(const AsmTlcs900 &other)
+    : Assembler(other, &_opt_maxMode),
+      Config(other),
+      _opt_maxMode(this, &Config::setMaxMode, OPT_BOOL_MAXIMUM_MODE, OPT_DESC_MAXIMUM_MODE) {}
+
+Assembler *AsmTlcs900::clone() const {
+    return new AsmTlcs900(*this);
+}
+
 void AsmTlcs900::reset() {
     Assembler::reset();
     // Reset register mode to the CPU's natural default (handled by setCpuType).
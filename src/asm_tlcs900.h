@@ -30,6 +30,9 @@ struct Operand;
 
 struct AsmTlcs900 final : Assembler, Config {
     AsmTlcs900(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmTlcs900(const AsmTlcs900 &other);
+
+    Assembler *clone() const override;
 
     void reset() override;
 
@@ -58,6 +58,10 @@ AsmTms320::AsmTms320(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmTms320::clone() const {
+    return new AsmTms320(*this);
+}
+
 void AsmTms320::encodeIndirect(AsmInsn &insn, const Operand &op) const {
     static constexpr uint8_t MAR[] PROGMEM = {
             0x80,  // M_ARP: *
@@ -27,6 +27,8 @@ namespace tms320 {
 struct AsmTms320 final : Assembler, Config {
     AsmTms320(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseConditionCode(StrScanner &scan, Operand &op) const;
     Error parseOperand(StrScanner &scan, Operand &op) const;
@@ -66,6 +66,10 @@ AsmTms320f::AsmTms320f(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmTms320f::clone() const {
+    return new AsmTms320f(*this);
+}
+
 Error AsmTms320f::parseOperand(StrScanner &scan, Operand &op) const {
     auto p = scan.skipSpaces();
     op.setAt(p);
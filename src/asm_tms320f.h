@@ -27,6 +27,8 @@ namespace tms320f {
 struct AsmTms320f final : Assembler, Config {
     AsmTms320f(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
     // Cross-instruction state carried on the Insn (per Insn::state<T>).
     // Holds the previous AsmInsn so a parallel continuation can re-search
     // and re-encode the first half against the second. Size exceeds
@@ -57,6 +57,10 @@ AsmTms370::AsmTms370(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmTms370::clone() const {
+    return new AsmTms370(*this);
+}
+
 Error AsmTms370::parseIndex(StrScanner &scan, Operand &op, bool immediate) const {
     auto p = scan;
     if (p.skipSpaces().expect('(')) {
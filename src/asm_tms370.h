@@ -27,6 +27,8 @@ namespace tms370 {
 struct AsmTms370 final : Assembler, Config {
     AsmTms370(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseIndex(StrScanner &scan, Operand &op, bool immediate) const;
     Error parseOperand(StrScanner &scan, Operand &op) const;
@@ -51,6 +51,10 @@ AsmTms7000::AsmTms7000(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmTms7000::clone() const {
+    return new AsmTms7000(*this);
+}
+
 bool AsmTms7000::hasIndexB(StrScanner &scan, ErrorAt &error) const {
     auto p = scan;
     if (p.skipSpaces().expect('(')) {
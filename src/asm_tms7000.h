@@ -27,6 +27,8 @@ namespace tms7000 {
 struct AsmTms7000 final : Assembler, Config {
     AsmTms7000(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     bool hasIndexB(StrScanner &scan, ErrorAt &error) const;
     Error parseOperand(StrScanner &scan, Operand &op) const;
@@ -52,6 +52,10 @@ AsmTms9900::AsmTms9900(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmTms9900::clone() const {
+    return new AsmTms9900(*this);
+}
+
 void AsmTms9900::encodeRelative(AsmInsn &insn, const Operand &op) const {
     const auto base = insn.address() + 2;
     const auto target = op.getError() ? base : op.val.getUnsigned();
@@ -27,6 +27,8 @@ namespace tms9900 {
 struct AsmTms9900 final : Assembler, Config {
     AsmTms9900(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseOperand(StrScanner &scan, Operand &op) const;
 
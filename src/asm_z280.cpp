@@ -58,6 +58,10 @@ AsmZ280::AsmZ280(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmZ280::clone() const {
+    return new AsmZ280(*this);
+}
+
 void AsmZ280::encodeRelative(AsmInsn &insn, const Operand &op, AddrMode mode) const {
     const auto deltaLen = (mode == M_REL8) ? 1 : 2;
     uint32_t base = insn.address() + insn.operandPos() + deltaLen;
@@ -27,6 +27,8 @@ namespace z280 {
 struct AsmZ280 final : Assembler, Config {
     AsmZ280(const ValueParser::Plugins &plugins = defaultPlugins());
 
+    Assembler *clone() const override;
+
 private:
     Error parseOperand(StrScanner &scan, Operand &op) const;
 
@@ -62,6 +62,17 @@ AsmZ380::AsmZ380(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmZ380::AsmZ380(const AsmZ380 &other)
+    : Assembler(other, &_opt_extmode),
+      Config(other),
+      _opt_extmode(
+              this, &AsmZ380::setExtendedMode, OPT_BOOL_EXTMODE, OPT_DESC_EXTMODE, &_opt_lwordmode),
+      _opt_lwordmode(this, &AsmZ380::setLongWordMode, OPT_BOOL_LWORDMODE, OPT_DESC_LWORDMODE) {}
+
+Assembler *AsmZ380::clone() const {
+    return new AsmZ380(*this);
+}
+
 void AsmZ380::reset() {
     Assembler::reset();
     setExtendedMode(false);
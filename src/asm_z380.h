@@ -26,6 +26,9 @@ namespace z380 {
 
 struct AsmZ380 final : Assembler, Config {
     AsmZ380(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmZ380(const AsmZ380 &other);
+
+    Assembler *clone() const override;
 
     void reset() override;
 
@@ -67,6 +67,25 @@ AsmZ8::AsmZ8(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmZ8::AsmZ8(const AsmZ8 &other)
+    : Assembler(other, &_opt_reg_alias),
+      Config(other),
+      _opt_reg_alias(
+              this, &AsmZ8::setRegAlias, OPT_BOOL_ALIAS, OPT_DESC_ALIAS, &_opt_optimize_index),
+      _opt_optimize_index(
+              this, &AsmZ8::setOptimizeIndex, OPT_BOOL_OPTIMIZE_INDEX, OPT_DESC_OPTIMIZE_INDEX),
+      _opt_setrp(this, &AsmZ8::setRegPointer, OPT_INT_SETRP),
+      _opt_setrp0(this, &AsmZ8::setRegPointer0, OPT_INT_SETRP0),
+      _opt_setrp1(this, &AsmZ8::setRegPointer1, OPT_INT_SETRP1),
+      _regAlias(other._regAlias),
+      _regPointer0(other._regPointer0),
+      _regPointer1(other._regPointer1),
+      _optimizeIndex(other._optimizeIndex) {}
+
+Assembler *AsmZ8::clone() const {
+    return new AsmZ8(*this);
+}
+
 void AsmZ8::reset() {
     Assembler::reset();
     setRegAlias(true);
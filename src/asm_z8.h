@@ -26,6 +26,9 @@ namespace z8 {
 
 struct AsmZ8 final : Assembler, Config {
     AsmZ8(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmZ8(const AsmZ8 &other);
+
+    Assembler *clone() const override;
 
     void reset() override;
 
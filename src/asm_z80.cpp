@@ -58,6 +58,10 @@ AsmZ80::AsmZ80(const ValueParser::Plugins &plugins)
     reset();
 }
 
+Assembler *AsmZ80::clone() const {
+    return new AsmZ80(*this);
+}
+
 void AsmZ80::encodeRelative(AsmInsn &insn, const Operand &op) const {
     const auto deltaLen = 1;
     uint32_t base = insn.address() + insn.operandPos() + deltaLen;
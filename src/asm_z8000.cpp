@@ -61,6 +61,17 @@ AsmZ8000::AsmZ8000(const ValueParser::Plugins &plugins)
     reset();
 }
 
+AsmZ8000::AsmZ8000(const AsmZ8000 &other)
+    : Assembler(other, &_opt_shortDirect),
+      Config(other),
+      _opt_shortDirect(
+              this, &AsmZ8000::setShortDirect, OPT_BOOL_SHORT_DIRECT, OPT_DESC_SHORT_DIRECT),
+      _autoShortDirect(other._autoShortDirect) {}
+
+Assembler *AsmZ8000::clone() const {
+    return new AsmZ8000(*this);
+}
+
 void AsmZ8000::reset() {
     Assembler::reset();
     setShortDirect(true);
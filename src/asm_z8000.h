@@ -26,6 +26,9 @@ namespace z8000 {
 
 struct AsmZ8000 final : Assembler, Config {
     AsmZ8000(const ValueParser::Plugins &plugins = defaultPlugins());
+    AsmZ8000(const AsmZ8000 &other);
+
+    Assembler *clone() const override;
 
     void reset() override;
 
@@ -68,6 +68,17 @@ typedef union {
 #define snprintf_P(s, n, f, ...) snprintf((s), (n), (f), __VA_ARGS__)
 
 #endif  // AVR
+
+#if defined(ARDUINO) && !defined(LIBASM_DIS_NOINDEX)
+// Microcontrollers don't have enough RAM for opcode dispatch index.
+#define LIBASM_DIS_NOINDEX
+#endif
+
+#if defined(ARDUINO) && !defined(LIBASM_ASM_NOINDEX)
+// Microcontrollers don't have enough RAM for mnemonic hash index.
+#define LIBASM_ASM_NOINDEX
+#endif
+
 #endif  // __LIBASM_CONFIG_HOST_H__
 
 // Local Variables:
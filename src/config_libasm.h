@@ -29,6 +29,12 @@
 /** Enable debugging functionality of Value class */
 // #define LIBASM_DEBUG_VALUE
 
+/** Disable opcode dispatch index of disassembler instruction table */
+// #define LIBASM_DIS_NOINDEX
+
+/** Disable mnemonic hash index of assembler instruction table */
+// #define LIBASM_ASM_NOINDEX
+
 #endif  // __LIBASM_CONFIG_LIBASM_H__
 
 // Local Variables:
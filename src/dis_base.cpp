@@ -42,7 +42,24 @@ constexpr char OPT_DESC_GNU_AS[] PROGMEM = "GNU assembler compatible";
 }  // namespace
 
 Disassembler::Disassembler(const ValueFormatter::Plugins &plugins, const OptionBase *option)
-    : _formatter(plugins),
+    : Disassembler(ValueFormatter(plugins), option) {}
+
+Disassembler::Disassembler(const Disassembler &other, const OptionBase *option)
+    : Disassembler(other._formatter, option) {
+    _upperHex = other._upperHex;
+    _uppercase = other._uppercase;
+    _listRadix = other._listRadix;
+    _relativeTarget = other._relativeTarget;
+    _cstyle = other._cstyle;
+    _intelStyle = other._intelStyle;
+    _motorolaStyle = other._motorolaStyle;
+    _curSym = other._curSym;
+    _gnuAs = other._gnuAs;
+    _symtab = other._symtab;
+}
+
+Disassembler::Disassembler(const ValueFormatter &formatter, const OptionBase *option)
+    : _formatter(formatter),
       _commonOptions(&_opt_upperHex),
       _options(option),
       _opt_upperHex(this, &Disassembler::setUpperHex, OPT_BOOL_UPPER_HEX, OPT_DESC_UPPER_HEX,
@@ -166,29 +183,102 @@ Error Disassembler::decode(
         return insn.getError();
     StrCaseBuffer out(operands, size, _uppercase);
     insn.nameBuffer().reset();
+    insn.setFlow(FLOW_NEXT);
     decodeImpl(memory, insn, out);
     if (insn.isOK())
         insn.setError(out);
     return insn.getError();
 }
 
-const char *Disassembler::lookup(uint32_t addr, uint8_t addrWidth) const {
+Error Disassembler::instructionLength(DisMemory &memory, Insn &insn) const {
+    readInsn(memory, insn);
+    if (insn.hasContinue()) {
+        // Read the continuation to leave |insn| in the same state as after full decoding.
+        ErrorAt error;
+        error.setError(insn);
+        readInsn(memory, insn);
+        insn.setError(error);
+    }
+    return insn.getError();
+}
+
+Error Disassembler::readInsn(DisMemory &memory, Insn &insn) const {
+    if (insn.setError(config().checkAddr(insn.address())))
+        return insn.getError();
+    insn.nameBuffer().reset();
+    insn.setFlow(FLOW_NEXT);
+    return lengthImpl(memory, insn);
+}
+
+Error Disassembler::lengthImpl(DisMemory &memory, Insn &insn) const {
+    char discard[1];
+    StrBuffer out(discard, sizeof(discard));
+    return decodeImpl(memory, insn, out);
+}
+
+size_t Disassembler::decodeBatch(DisMemory &memory, Insn &insn, DecodedInsn *insns, size_t count,
+        char *text, size_t size, SymbolTable *symtab) {
+    const auto unit = config().addressUnit();
+    size_t used = 0;
+    size_t n = 0;
+    while (n < count) {
+        // A pending continuation re-decodes the bytes of the previous instruction.
+        const auto continued = insn.hasContinue();
+        if (!continued && !memory.hasNext())
+            break;
+        char *operands = nullptr;
+        if (text) {
+            if (size - used < MAX_OPERANDS || used > UINT16_MAX)
+                break;
+            operands = text + used;
+        }
+        const auto start = memory.address();
+        if (!continued)
+            insn.reset(start / unit);
+        if (text) {
+            decode(memory, insn, operands, MAX_OPERANDS, symtab);
+        } else {
+            readInsn(memory, insn);
+        }
+        auto &record = insns[n++];
+        record.address = insn.address();
+        record.length = memory.address() - start;
+        record.error = insn.getError();
+        strcpy(record.name, insn.name());
+        record.operands = 0;
+        record.operandsLength = 0;
+        if (text) {
+            const auto len = strlen(operands);
+            record.operands = used;
+            record.operandsLength = len;
+            used += len + 1;
+        }
+        if (record.length == 0 && !continued)
+            break;
+    }
+    return n;
+}
+
+const char *Disassembler::lookup(uint32_t addr, uint8_t addrWidth, bool address) const {
     const char *symbol = nullptr;
     if (_symtab) {
         Value val;
         val.setUnsigned(addr);
-        symbol = _symtab->lookupValue(val);
+        symbol = address ? _symtab->lookupAddress(val) : _symtab->lookupValue(val);
         if (!symbol) {
             val.setSigned(config().signExtend(addr, addrWidth));
-            symbol = _symtab->lookupValue(val);
+            symbol = address ? _symtab->lookupAddress(val) : _symtab->lookupValue(val);
         }
     }
     return symbol;
 }
 
 StrBuffer &Disassembler::outDec(StrBuffer &out, uint32_t val, int8_t bits) const {
+    // A buffer which has no room only overflows, so that a lookup and a conversion are useless.
+    if (out.size() == 0)
+        return out.rletter('0');
     const auto bw = bits >= 0 ? bits : -bits;
-    const char *label = lookup(val, bw);
+    const char *label = lookup(val, bw, false);
     if (label)
         return out.rtext(label);
     StrCaseBuffer caseOut(out, _upperHex);
@@ -203,8 +293,10 @@ StrBuffer &Disassembler::outDec(StrBuffer &out, uint32_t val, int8_t bits) const
  * in symbol table.
  */
 StrBuffer &Disassembler::outHex(StrBuffer &out, uint32_t val, int8_t bits, bool relax) const {
+    if (out.size() == 0)
+        return out.rletter('0');
     const auto bw = bits >= 0 ? bits : -bits;
-    const char *label = lookup(val, bw);
+    const char *label = lookup(val, bw, false);
     if (label)
         return out.rtext(label);
     StrCaseBuffer caseOut(out, _upperHex);
@@ -225,6 +317,8 @@ StrBuffer &Disassembler::outHex(StrBuffer &out, uint32_t val, int8_t bits, bool
  * symbol label when |val| is in symbol table.
  */
 StrBuffer &Disassembler::outAbsAddr(StrBuffer &out, uint32_t val, uint8_t addrWidth) const {
+    if (out.size() == 0)
+        return out.rletter('0');
     const char *label = lookup(val, addrWidth);
     if (label)
         return out.rtext(label);
@@ -241,6 +335,8 @@ StrBuffer &Disassembler::outAbsAddr(StrBuffer &out, uint32_t val, uint8_t addrWi
  */
 StrBuffer &Disassembler::outRelAddr(
         StrBuffer &out, uint32_t target, uint32_t origin, uint8_t deltaBits) const {
+    if (out.size() == 0)
+        return out.rletter('0');
     if (!_relativeTarget)
         return outAbsAddr(out, target);
     const char *label = lookup(target, config().addressWidth());
@@ -35,11 +35,54 @@
 
 namespace libasm {
 
+/**
+ * Compact record of a decoded instruction which |Disassembler::decodeBatch| fills.
+ */
+struct DecodedInsn {
+    uint32_t address;
+    /** Bytes read from memory, 0 for a continuation which shares the previous bytes. */
+    uint8_t length;
+    Error error;
+    /** Offset and length of operands in the text buffer, both 0 when text is discarded. */
+    uint16_t operands;
+    uint8_t operandsLength;
+    char name[Insn::MAX_NAME + 1];
+};
+
 struct Disassembler {
     virtual ~Disassembler() {}
 
+    /**
+     * Create a new instance of the same disassembler which has the same CPU and options. The
+     * caller owns the returned instance. Instances share no mutable state, so that each thread
+     * can decode with its own instance.
+     */
+    virtual Disassembler *clone() const = 0;
+
     Error decode(DisMemory &memory, Insn &insn, char *operands, size_t size,
             SymbolTable *symtab = nullptr);
+
+    /**
+     * Decode instructions from |memory| into at most |count| records of |insns|, and return the
+     * number of records filled. |insn| carries the state between instructions, so that it should
+     * be passed again to decode the following instructions. Operands are stored into |text| as
+     * NUL terminated strings. When |text| is nullptr, instructions are read as
+     * |instructionLength| does without formatting operands. Decoding stops when |memory| is
+     * exhausted, an instruction reads no byte, or |text| has no room for operands.
+     */
+    size_t decodeBatch(DisMemory &memory, Insn &insn, DecodedInsn *insns, size_t count,
+            char *text = nullptr, size_t size = 0, SymbolTable *symtab = nullptr);
+    /** Room of operands of an instruction in the text buffer of |decodeBatch|. */
+    static constexpr size_t MAX_OPERANDS = 128;
+
+    /**
+     * Read an instruction at the address of |insn| from |memory| without formatting its
+     * operands, so that |insn| has the bytes and the length of the instruction. A continuation
+     * shares the bytes of its instruction and is consumed together. Errors which don't change
+     * the length, such as an illegal operand, may not be reported.
+     */
+    Error instructionLength(DisMemory &memory, Insn &insn) const;
+
     virtual const ConfigBase &config() const = 0;
     virtual void reset();
 
@@ -83,6 +126,12 @@ struct Disassembler {
         return false;
     }
 
+    /**
+     * Directive which defines bytes in the assembler source, or nullptr when the disassembler
+     * can't emit data.
+     */
+    virtual const /*PROGMEM*/ char *dataDirective_P() const { return nullptr; }
+
 private:
     const ValueFormatter _formatter;
 
@@ -112,8 +161,14 @@ protected:
 
     Disassembler(const ValueFormatter::Plugins &plugins, const OptionBase *option = nullptr);
 
-    /** Lookup |addr| value and returns symbol. */
-    const char *lookup(uint32_t addr, uint8_t addrWidth = 0) const;
+    /**
+     * Copy settings of |other| and construct options of this instance. |option| is the head of
+     * options of a derived class, which must construct its own options likewise.
+     */
+    Disassembler(const Disassembler &other, const OptionBase *option = nullptr);
+
+    /** Lookup |addr| value and returns symbol. |address| is false for an integer value. */
+    const char *lookup(uint32_t addr, uint8_t addrWidth = 0, bool address = true) const;
 
     /**
      * Convert |val| as |bits| decimal integer. Treat |val| as signed integer when |bits| is
@@ -134,8 +189,17 @@ protected:
             StrBuffer &out, uint32_t target, uint32_t origin, uint8_t deltaBits) const;
 
 private:
+    Disassembler(const ValueFormatter &formatter, const OptionBase *option);
+
     virtual ConfigSetter &configSetter() = 0;
     virtual Error decodeImpl(DisMemory &memory, Insn &insn, StrBuffer &out) const = 0;
+    /**
+     * Read an instruction into |insn|. The default runs |decodeImpl| with a buffer which has no
+     * room, so that operands are neither looked up nor converted.
+     */
+    virtual Error lengthImpl(DisMemory &memory, Insn &insn) const;
+    /** Read an instruction, but not its continuation, into |insn| by |lengthImpl|. */
+    Error readInsn(DisMemory &memory, Insn &insn) const;
 };
 
 }  // namespace libasm
@@ -50,6 +50,21 @@ DisCdp1802::DisCdp1802(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisCdp1802::DisCdp1802(const DisCdp1802 &other)
+    : Disassembler(other, &_opt_useReg),
+      Config(other),
+      _opt_useReg(
+              this, &DisCdp1802::setUseRegsterName, OPT_BOOL_USE_REGISTER, OPT_DESC_USE_REGISTER),
+      _useReg(other._useReg) {}
+
+Disassembler *DisCdp1802::clone() const {
+    return new DisCdp1802(*this);
+}
+
+const /*PROGMEM*/ char *DisCdp1802::dataDirective_P() const {
+    return PSTR("DC");
+}
+
 void DisCdp1802::reset() {
     Disassembler::reset();
     setUseRegsterName(false);
@@ -26,6 +26,10 @@ namespace cdp1802 {
 
 struct DisCdp1802 final : Disassembler, Config {
     DisCdp1802(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisCdp1802(const DisCdp1802 &other);
+
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
 
     void reset() override;
 
@@ -56,6 +56,19 @@ DisCp1600::DisCp1600(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisCp1600::DisCp1600(const DisCp1600 &other)
+    : Disassembler(other, &_opt_spAlias),
+      Config(other),
+      _opt_spAlias(
+              this, &DisCp1600::setSpAlias, OPT_BOOL_SP_ALIAS, OPT_DESC_SP_ALIAS, &_opt_pcAlias),
+      _opt_pcAlias(this, &DisCp1600::setPcAlias, OPT_BOOL_PC_ALIAS, OPT_DESC_PC_ALIAS),
+      _spAlias(other._spAlias),
+      _pcAlias(other._pcAlias) {}
+
+Disassembler *DisCp1600::clone() const {
+    return new DisCp1600(*this);
+}
+
 void DisCp1600::reset() {
     Disassembler::reset();
     setSpAlias(false);
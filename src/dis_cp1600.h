@@ -26,6 +26,9 @@ namespace cp1600 {
 
 struct DisCp1600 final : Disassembler, Config {
     DisCp1600(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisCp1600(const DisCp1600 &other);
+
+    Disassembler *clone() const override;
 
     void reset() override;
 
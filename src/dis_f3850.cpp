@@ -33,6 +33,14 @@ DisF3850::DisF3850(const ValueFormatter::Plugins& plugins) : Disassembler(plugin
     reset();
 }
 
+Disassembler *DisF3850::clone() const {
+    return new DisF3850(*this);
+}
+
+const /*PROGMEM*/ char *DisF3850::dataDirective_P() const {
+    return PSTR("DC");
+}
+
 void DisF3850::decodeRelative(DisInsn& insn, StrBuffer& out) const {
     const auto delta = static_cast<int8_t>(insn.readByte());
     const auto base = insn.address() + 1;
@@ -27,6 +27,9 @@ namespace f3850 {
 struct DisF3850 final : Disassembler, Config {
     DisF3850(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
+
 private:
     void decodeRelative(DisInsn &insn, StrBuffer &out) const;
     void decodeOperand(DisInsn &insn, StrBuffer &out, AddrMode mode) const;
@@ -33,6 +33,14 @@ DisH16::DisH16(const ValueFormatter::Plugins &plugins) : Disassembler(plugins),
     reset();
 }
 
+Disassembler *DisH16::clone() const {
+    return new DisH16(*this);
+}
+
+const /*PROGMEM*/ char *DisH16::dataDirective_P() const {
+    return PSTR(".DATA.B");
+}
+
 namespace {
 
 // Decode a 4-bit register field within a bank context (default Rn; CRn/PRn via
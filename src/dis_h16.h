@@ -38,6 +38,9 @@ enum EaKind : uint8_t { EA_ANY, EA_DEST, EA_MEM, EA_PERI, EA_BITF };
 struct DisH16 final : Disassembler, Config {
     DisH16(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
+
 private:
     // Decode an EA byte plus any extension bytes implied by the EA code.
     // |bank| selects the register file for Rn fields: REG_R0 = global bank
@@ -39,6 +39,23 @@ DisH8300::DisH8300(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisH8300::DisH8300(const DisH8300 &other)
+    : Disassembler(other, &_opt_advancedMode),
+      Config(other),
+      _opt_advancedMode(this, &Config::setAdvancedMode,
+              ::libasm::text::h8300::OPT_BOOL_ADVANCED_MODE,
+              ::libasm::text::h8300::OPT_DESC_ADVANCED_MODE, &_opt_spAlias),
+      _opt_spAlias(this, &Config::setSpAlias, ::libasm::text::h8300::OPT_BOOL_SP_ALIAS,
+              ::libasm::text::h8300::OPT_DESC_SP_ALIAS) {}
+
+Disassembler *DisH8300::clone() const {
+    return new DisH8300(*this);
+}
+
+const /*PROGMEM*/ char *DisH8300::dataDirective_P() const {
+    return PSTR(".DATA.B");
+}
+
 void DisH8300::decodeRelative(DisInsn &insn, StrBuffer &out) const {
     const auto delta = static_cast<int8_t>(insn.opCode() & UINT8_MAX);
     const auto base = insn.address() + insn.length();
@@ -26,6 +26,10 @@ namespace h8300 {
 
 struct DisH8300 final : Disassembler, Config {
     DisH8300(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisH8300(const DisH8300 &other);
+
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
 
 private:
     const BoolOption<Config> _opt_advancedMode;
@@ -38,6 +38,21 @@ DisH8500::DisH8500(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisH8500::DisH8500(const DisH8500 &other)
+    : Disassembler(other, &_opt_maxMode),
+      Config(other),
+      _opt_maxMode(this, &Config::setMaxMode, OPT_BOOL_MAX_MODE, OPT_DESC_MAX_MODE, &_opt_fpAlias),
+      _opt_fpAlias(this, &Config::setFpAlias, OPT_BOOL_FP_ALIAS, OPT_DESC_FP_ALIAS, &_opt_spAlias),
+      _opt_spAlias(this, &Config::setSpAlias, OPT_BOOL_SP_ALIAS, OPT_DESC_SP_ALIAS) {}
+
+Disassembler *DisH8500::clone() const {
+    return new DisH8500(*this);
+}
+
+const /*PROGMEM*/ char *DisH8500::dataDirective_P() const {
+    return PSTR(".DATA.B");
+}
+
 void DisH8500::reset() {
     Disassembler::reset();
     setMaxMode(false);
@@ -26,6 +26,10 @@ namespace h8500 {
 
 struct DisH8500 final : Disassembler, Config {
     DisH8500(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisH8500(const DisH8500 &other);
+
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
 
     void reset() override;
 
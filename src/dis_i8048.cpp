@@ -31,6 +31,14 @@ DisI8048::DisI8048(const ValueFormatter::Plugins &plugins) : Disassembler(plugin
     reset();
 }
 
+Disassembler *DisI8048::clone() const {
+    return new DisI8048(*this);
+}
+
+const /*PROGMEM*/ char *DisI8048::dataDirective_P() const {
+    return PSTR("DB");
+}
+
 void DisI8048::decodeOperand(DisInsn &insn, StrBuffer &out, AddrMode mode) const {
     const auto opc = insn.opCode();
     switch (mode) {
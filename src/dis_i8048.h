@@ -27,6 +27,9 @@ namespace i8048 {
 struct DisI8048 final : Disassembler, Config {
     DisI8048(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
+
 private:
     void decodeOperand(DisInsn &insn, StrBuffer &out, AddrMode mode) const;
 
@@ -31,6 +31,14 @@ DisI8051::DisI8051(const ValueFormatter::Plugins &plugins) : Disassembler(plugin
     reset();
 }
 
+Disassembler *DisI8051::clone() const {
+    return new DisI8051(*this);
+}
+
+const /*PROGMEM*/ char *DisI8051::dataDirective_P() const {
+    return PSTR("DB");
+}
+
 void DisI8051::decodeRelative(DisInsn &insn, StrBuffer &out) const {
     const auto delta = static_cast<int8_t>(insn.readByte());
     const auto base = insn.address() + insn.length();
@@ -27,6 +27,9 @@ namespace i8051 {
 struct DisI8051 final : Disassembler, Config {
     DisI8051(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
+
 private:
     void decodeRelative(DisInsn &insn, StrBuffer &out) const;
     void decodeBitAddr(DisInsn &insn, StrBuffer &out, AddrMode mode) const;
@@ -35,6 +35,20 @@ DisI8080::DisI8080(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisI8080::DisI8080(const DisI8080 &other)
+    : Disassembler(other, &_opt_zilog),
+      Config(other),
+      _opt_zilog(this, &DisI8080::setZilogSyntax, OPT_BOOL_ZILOG_SYNTAX, OPT_DESC_ZILOG_SYNTAX),
+      _zilogSyntax(other._zilogSyntax) {}
+
+Disassembler *DisI8080::clone() const {
+    return new DisI8080(*this);
+}
+
+const /*PROGMEM*/ char *DisI8080::dataDirective_P() const {
+    return PSTR("DB");
+}
+
 void DisI8080::reset() {
     Disassembler::reset();
     setZilogSyntax(false);
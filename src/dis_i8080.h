@@ -26,6 +26,10 @@ namespace i8080 {
 
 struct DisI8080 final : Disassembler, Config {
     DisI8080(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisI8080(const DisI8080 &other);
+
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
 
     void reset() override;
 
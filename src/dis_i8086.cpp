@@ -63,6 +63,36 @@ DisI8086::DisI8086(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisI8086::DisI8086(const DisI8086 &other)
+    : Disassembler(other, &_opt_fpu),
+      Config(other),
+      _opt_fpu(this, &Config::setFpuName, OPT_TEXT_FPU, OPT_DESC_FPU, &_opt_segInsn),
+      _opt_segInsn(
+              this, &DisI8086::setSegmentInsn, OPT_BOOL_SEG_INSN, OPT_DESC_SEG_INSN, &_opt_repInsn),
+      _opt_repInsn(
+              this, &DisI8086::setRepeatInsn, OPT_BOOL_REP_INSN, OPT_DESC_REP_INSN, &_opt_lockInsn),
+      _opt_lockInsn(
+              this, &DisI8086::setLockInsn, OPT_BOOL_LOCK_INSN, OPT_DESC_LOCK_INSN, &_opt_farInsn),
+      _opt_farInsn(
+              this, &DisI8086::setFarInsn, OPT_BOOL_FAR_INSN, OPT_DESC_FAR_INSN, &_opt_ptrSuffix),
+      _opt_ptrSuffix(
+              this, &DisI8086::setPtrSuffix, OPT_BOOL_PTR_SUFFIX, OPT_DESC_PTR_SUFFIX, &_opt_use16),
+      _opt_use16(this, &Config::setUse16, OPT_BOOL_USE16, OPT_DESC_USE16, &_opt_use32),
+      _opt_use32(this, &Config::setUse32, OPT_BOOL_USE32, OPT_DESC_USE32),
+      _segInsn(other._segInsn),
+      _repInsn(other._repInsn),
+      _lockInsn(other._lockInsn),
+      _farMode(other._farMode),
+      _ptrSuffix(other._ptrSuffix) {}
+
+Disassembler *DisI8086::clone() const {
+    return new DisI8086(*this);
+}
+
+const /*PROGMEM*/ char *DisI8086::dataDirective_P() const {
+    return PSTR("DB");
+}
+
 void DisI8086::reset() {
     Disassembler::reset();
     setFpuType(FPU_NONE);
@@ -828,6 +858,126 @@ Error DisI8086::decodeImpl(DisMemory &memory, Insn &_insn, StrBuffer &out) const
     return _insn.setError(insn);
 }
 
+void DisI8086::skipMemReg(DisInsn &insn, OprPos pos) const {
+    const auto mod = insn.mod();
+    if (pos == P_NONE || mod == 3)
+        return;
+    if (insn.useAddr32()) {
+        if (insn.r_m() == 4) {
+            const auto sib = insn.readByte();
+            if (mod == 0 && (sib & 7) == 5) {
+                insn.readUint32();
+                return;
+            }
+        } else if (mod == 0 && insn.r_m() == 5) {
+            insn.readUint32();
+        }
+        if (mod == 1) {
+            insn.readByte();
+        } else if (mod == 2) {
+            insn.readUint32();
+        }
+        return;
+    }
+    if (mod == 1) {
+        insn.readByte();
+    } else if (mod == 2 || (mod == 0 && insn.r_m() == 6)) {
+        insn.readUint16();
+    }
+}
+
+void DisI8086::skipOperand(DisInsn &insn, AddrMode mode, OprPos pos) const {
+    switch (mode) {
+    case M_BMEM:
+    case M_WMEM:
+    case M_DMEM:
+    case M_FARM:
+    case M_FMEM:
+    case M_MEM:
+    case M_BMOD:
+    case M_WMOD:
+    case M_WMOD16:
+        skipMemReg(insn, pos);
+        break;
+    case M_WIMM:
+        if (insn.size() == SZ_DATA) {
+            if (insn.useData32()) {
+                insn.readUint32();
+            } else {
+                insn.readUint16();
+            }
+        } else if (insn.size() == SZ_WORD) {
+            insn.readUint16();
+        } else if (insn.size() == SZ_DWORD) {
+            insn.readUint32();
+        } else if (insn.size() == SZ_BYTE) {
+            insn.readByte();
+        }
+        break;
+    case M_IOA:
+    case M_BIMM:
+    case M_UI8:
+    case M_BIT:
+    case M_REL8:
+        insn.readByte();
+        break;
+    case M_UI16:
+    case M_OFF:
+        insn.readUint16();
+        break;
+    case M_FAR:
+        if (insn.useData32()) {
+            insn.readUint32();
+        } else {
+            insn.readUint16();
+        }
+        insn.readUint16();
+        break;
+    case M_SEG:
+    case M_REL:
+        if (insn.useData32()) {
+            insn.readUint32();
+        } else {
+            insn.readUint16();
+        }
+        break;
+    case M_BDIR:
+    case M_WDIR:
+        if (insn.useAddr32()) {
+            insn.readUint32();
+        } else {
+            insn.readUint16();
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+Error DisI8086::lengthImpl(DisMemory &memory, Insn &_insn) const {
+    char buffer[1];
+    StrBuffer out{buffer, sizeof(buffer)};
+    DisInsn insn(_insn, memory, out);
+    insn.setFarMode(_farMode);
+
+    if (searchCodes(insn, out))
+        return _insn.setError(insn);
+
+    insn.readModReg();
+    if (_insn.setErrorIf(insn))
+        return _insn.getError();
+    if (!validSegOverride(insn))
+        return _insn.setErrorIf(insn, ILLEGAL_SEGMENT);
+
+    if (!insn.stringInsn()) {
+        skipOperand(insn, insn.dst(), insn.dstPos());
+        if (insn.src() != M_NONE && !imulHasSameDstSrc(insn))
+            skipOperand(insn, insn.src(), insn.srcPos());
+        skipOperand(insn, insn.ext(), insn.extPos());
+    }
+    return _insn.setError(insn);
+}
+
 }  // namespace i8086
 }  // namespace libasm
 
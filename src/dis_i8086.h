@@ -27,6 +27,10 @@ namespace i8086 {
 
 struct DisI8086 final : Disassembler, Config {
     DisI8086(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisI8086(const DisI8086 &other);
+
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
 
     void reset() override;
 
@@ -70,8 +74,11 @@ private:
     void decodeOperand(DisInsn &insn, StrBuffer &out, AddrMode mode, OprPos pos) const;
     void decodeStringInsn(DisInsn &insn, StrBuffer &out) const;
     Error searchCodes(DisInsn &insn, StrBuffer &out) const;
+    void skipMemReg(DisInsn &insn, OprPos pos) const;
+    void skipOperand(DisInsn &insn, AddrMode mode, OprPos pos) const;
 
     Error decodeImpl(DisMemory &memory, Insn &insn, StrBuffer &out) const override;
+    Error lengthImpl(DisMemory &memory, Insn &insn) const override;
     const ConfigBase &config() const override { return *this; }
     ConfigSetter &configSetter() override { return *this; }
     static const ValueFormatter::Plugins &defaultPlugins();
@@ -41,6 +41,20 @@ DisI8096::DisI8096(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisI8096::DisI8096(const DisI8096 &other)
+    : Disassembler(other, &_opt_absolute),
+      Config(other),
+      _opt_absolute(this, &DisI8096::setUseAbsolute, OPT_BOOL_ABSOLUTE, OPT_DESC_ABSOLUTE),
+      _useAbsolute(other._useAbsolute) {}
+
+Disassembler *DisI8096::clone() const {
+    return new DisI8096(*this);
+}
+
+const /*PROGMEM*/ char *DisI8096::dataDirective_P() const {
+    return PSTR("DCB");
+}
+
 void DisI8096::reset() {
     Disassembler::reset();
     setUseAbsolute(false);
@@ -26,6 +26,10 @@ namespace i8096 {
 
 struct DisI8096 final : Disassembler, Config {
     DisI8096(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisI8096(const DisI8096 &other);
+
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
 
     void reset() override;
 
@@ -32,6 +32,14 @@ DisIns8060::DisIns8060(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+Disassembler *DisIns8060::clone() const {
+    return new DisIns8060(*this);
+}
+
+const /*PROGMEM*/ char *DisIns8060::dataDirective_P() const {
+    return PSTR(".BYTE");
+}
+
 void DisIns8060::decodePntr(DisInsn &insn, StrBuffer &out) const {
     outRegName(out, decodePointerReg(insn.opCode()));
 }
@@ -27,6 +27,9 @@ namespace ins8060 {
 struct DisIns8060 final : Disassembler, Config {
     DisIns8060(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
+
 private:
     void decodePntr(DisInsn &insn, StrBuffer &out) const ;
     void decodeImm8(DisInsn &insn, StrBuffer &out) const;
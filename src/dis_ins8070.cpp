@@ -42,6 +42,21 @@ DisIns8070::DisIns8070(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisIns8070::DisIns8070(const DisIns8070 &other)
+    : Disassembler(other, &_opt_useSharp),
+      Config(other),
+      _opt_useSharp(
+              this, &DisIns8070::setUseSharpImmediate, OPT_BOOL_USE_SHARP, OPT_DESC_USE_SHARP),
+      _useSharp(other._useSharp) {}
+
+Disassembler *DisIns8070::clone() const {
+    return new DisIns8070(*this);
+}
+
+const /*PROGMEM*/ char *DisIns8070::dataDirective_P() const {
+    return PSTR(".BYTE");
+}
+
 void DisIns8070::reset() {
     Disassembler::reset();
     setUseSharpImmediate(false);
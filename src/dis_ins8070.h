@@ -26,6 +26,10 @@ namespace ins8070 {
 
 struct DisIns8070 final : Disassembler, Config {
     DisIns8070(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisIns8070(const DisIns8070 &other);
+
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
 
     void reset() override;
 
@@ -32,6 +32,14 @@ DisMc6800::DisMc6800(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+Disassembler *DisMc6800::clone() const {
+    return new DisMc6800(*this);
+}
+
+const /*PROGMEM*/ char *DisMc6800::dataDirective_P() const {
+    return PSTR("FCB");
+}
+
 void DisMc6800::decodeDirectPage(DisInsn &insn, StrBuffer &out) const {
     const uint8_t dir = insn.readByte();
     const auto label = lookup(dir);
@@ -27,6 +27,9 @@ namespace mc6800 {
 struct DisMc6800 final : Disassembler, Config {
     DisMc6800(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
+
 private:
     void decodeDirectPage(DisInsn &insn, StrBuffer &out) const;
     void decodeExtended(DisInsn &insn, StrBuffer &out) const;
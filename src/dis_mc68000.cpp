@@ -38,6 +38,20 @@ DisMc68000::DisMc68000(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisMc68000::DisMc68000(const DisMc68000 &other)
+    : Disassembler(other, &_opt_fpu),
+      Config(other),
+      _opt_fpu(this, &Config::setFpuName, OPT_TEXT_FPU, OPT_DESC_FPU, &_opt_pmmu),
+      _opt_pmmu(this, &Config::setPmmuName, OPT_TEXT_PMMU, OPT_DESC_PMMU) {}
+
+Disassembler *DisMc68000::clone() const {
+    return new DisMc68000(*this);
+}
+
+const /*PROGMEM*/ char *DisMc68000::dataDirective_P() const {
+    return PSTR("DC.B");
+}
+
 void DisMc68000::reset() {
     Disassembler::reset();
 #if defined(LIBASM_MC68000_NOFPU)
@@ -803,6 +817,9 @@ void DisMc68000::decodeOperand(DisInsn &insn, StrBuffer &out, AddrMode type, Opr
     case M_MROOT:
     case M_BITFR:
     case M_BITFW:
+        // Only an absolute or a PC displacement jump has a known target.
+        if (type == M_JADDR && mode != M_AWORD && mode != M_ALONG && mode != M_PCDSP)
+            insn.setIndirect();
         outEffectiveAddr(insn, out, mode, decodeRegNo(m, r), size);
         break;
     case M_IM3:
@@ -1062,6 +1079,142 @@ Error DisMc68000::decodeImpl(DisMemory &memory, Insn &_insn, StrBuffer &out) con
     return _insn.setError(insn);
 }
 
+void DisMc68000::skipImmediateData(DisInsn &insn, OprSize size) const {
+#if !defined(LIBASM_MC68000_NOPMMU)
+    if (size == SZ_PMMU)
+        size = pmmuRegSize(decodePmmuReg(insn.postfix(), _cpuSpec.pmmu), _cpuSpec.pmmu);
+#endif
+    if (size == SZ_BYTE || size == SZ_WORD || insn.src() == M_CCR || insn.dst() == M_CCR) {
+        insn.readUint16();
+    } else if (size == SZ_LONG) {
+        insn.readUint32();
+#if !defined(LIBASM_MC68000_NOPMMU)
+    } else if (size == SZ_QUAD) {
+        insn.readUint64();
+#endif
+#if !defined(LIBASM_MC68000_NOFPU)
+    } else if (_gnuAs) {
+        insn.readUint32();
+        if (size == SZ_DUBL) {
+            insn.readUint32();
+        } else if (size == SZ_XTND || size == SZ_PBCD) {
+            insn.readUint64();
+        }
+    } else if (size == SZ_SNGL) {
+        insn.readUint32();
+    } else if (size == SZ_DUBL) {
+        insn.readUint64();
+    } else if (size == SZ_XTND || size == SZ_PBCD) {
+        insn.readUint32();
+        insn.readUint64();
+#endif
+    }
+}
+
+void DisMc68000::skipEffectiveAddr(DisInsn &insn, AddrMode mode, OprSize size) const {
+    if (mode == M_IMDAT) {
+        skipImmediateData(insn, size);
+    } else if (mode == M_DISP || mode == M_PCDSP || mode == M_AWORD) {
+        insn.readUint16();
+    } else if (mode == M_ALONG) {
+        insn.readUint32();
+    } else if (mode == M_INDX || mode == M_PCIDX) {
+        const auto ext = insn.readUint16();
+        if (!firstGen() && (ext & 0x0100) != 0) {
+            readDisplacement(insn, REG_UNDEF, (ext >> 4) & 3);
+            if ((ext & 7) != 0)
+                readDisplacement(insn, REG_UNDEF, ext & 3);
+        }
+    }
+}
+
+void DisMc68000::skipRelative(DisInsn &insn, AddrMode mode) const {
+    if (mode == M_REL32) {
+        if ((insn.opCode() & 0x40) == 0) {
+            insn.readUint16();
+        } else {
+            insn.readUint32();
+        }
+    } else if (mode == M_REL16) {
+        insn.readUint16();
+    } else {  // M_REL8
+        const auto rel8 = insn.opCode() & 0xFF;
+        if (rel8 == 0x00) {
+            insn.readUint16();
+        } else if (rel8 == 0xFF && hasLongBranch()) {
+            insn.readUint32();
+        }
+    }
+}
+
+void DisMc68000::skipOperand(DisInsn &insn, AddrMode mode, OprPos pos, OprSize size) const {
+    switch (mode) {
+    case M_DISP:
+        insn.readUint16();
+        break;
+    case M_ALONG:
+        insn.readUint32();
+        break;
+    case M_RADDR:
+    case M_WADDR:
+    case M_IADDR:
+    case M_DADDR:
+    case M_RDATA:
+    case M_WDATA:
+    case M_RMEM:
+    case M_WMEM:
+    case M_JADDR:
+    case M_PADDR:
+    case M_MROOT:
+    case M_BITFR:
+    case M_BITFW:
+        skipEffectiveAddr(insn, decodeAddrMode(modeVal(insn, pos), regVal(insn, pos)), size);
+        break;
+    case M_IMBIT:
+        if (insn.src() == M_IMBIT)
+            insn.readUint16();
+        break;
+    case M_IMDAT:
+        skipImmediateData(insn, size);
+        break;
+    case M_MULT:
+        if (insn.src() == M_MULT)
+            insn.readUint16();
+        break;
+    case M_REL8:
+    case M_REL16:
+    case M_REL32:
+        skipRelative(insn, mode);
+        break;
+    case M_DPAIR:
+        if (pos == EX_DCP)
+            insn.post2 = insn.readUint16();
+        break;
+    default:
+        break;
+    }
+}
+
+Error DisMc68000::lengthImpl(DisMemory &memory, Insn &_insn) const {
+    char buffer[1];
+    StrBuffer out{buffer, sizeof(buffer)};
+    DisInsn insn(_insn, memory, out);
+    insn.setOpCode(insn.readUint16());
+    if (searchOpCode(_cpuSpec, insn, out))
+        return _insn.setError(insn);
+
+    const auto osize = decodeSize(insn);
+    const auto dst = insn.dst();
+    if (dst == M_MULT || dst == M_IMDSP)
+        insn.readUint16();
+    skipOperand(insn, insn.src(), insn.srcPos(), osize);
+    if (dst != M_NONE && !isFloatOpOnSameFpreg(insn))
+        skipOperand(insn, dst, insn.dstPos(), osize);
+    skipOperand(insn, insn.ex1(), insn.ex1Pos(), osize);
+    skipOperand(insn, insn.ex2(), insn.ex2Pos(), osize);
+    return _insn.setError(insn);
+}
+
 }  // namespace mc68000
 }  // namespace libasm
 
@@ -26,6 +26,10 @@ namespace mc68000 {
 
 struct DisMc68000 final : Disassembler, Config {
     DisMc68000(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisMc68000(const DisMc68000 &other);
+
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
 
     void reset() override;
 
@@ -57,8 +61,13 @@ private:
             uint16_t opr16 = 0, Error opr16Error = OK) const;
     char decodeInsnSize(const DisInsn &insn, OprSize size) const;
     bool isFloatOpOnSameFpreg(const DisInsn &insn) const;
+    void skipImmediateData(DisInsn &insn, OprSize size) const;
+    void skipEffectiveAddr(DisInsn &insn, AddrMode mode, OprSize size) const;
+    void skipRelative(DisInsn &insn, AddrMode mode) const;
+    void skipOperand(DisInsn &insn, AddrMode mode, OprPos pos, OprSize size) const;
 
     Error decodeImpl(DisMemory &memory, Insn &insn, StrBuffer &out) const override;
+    Error lengthImpl(DisMemory &memory, Insn &insn) const override;
     const ConfigBase &config() const override { return *this; }
     ConfigSetter &configSetter() override { return *this; }
     static const ValueFormatter::Plugins &defaultPlugins();
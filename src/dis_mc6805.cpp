@@ -41,6 +41,20 @@ DisMc6805::DisMc6805(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisMc6805::DisMc6805(const DisMc6805 &other)
+    : Disassembler(other, &_opt_pc_bits),
+      Config(other),
+      _opt_pc_bits(this, &DisMc6805::setPcBits, OPT_INT_PCBITS, OPT_DESC_PCBITS),
+      _pc_bits(other._pc_bits) {}
+
+Disassembler *DisMc6805::clone() const {
+    return new DisMc6805(*this);
+}
+
+const /*PROGMEM*/ char *DisMc6805::dataDirective_P() const {
+    return PSTR("FCB");
+}
+
 AddressWidth DisMc6805::addressWidth() const {
     return AddressWidth(_pc_bits == 0 ? 13 : _pc_bits);
 }
@@ -111,6 +125,7 @@ void DisMc6805::decodeRelative(DisInsn &insn, StrBuffer &out) const {
 
 void DisMc6805::decodeOperand(DisInsn &insn, StrBuffer &out, AddrMode mode) const {
     if (mode == M_GEN1 || mode == M_GEN2 || mode == M_IX10) {
+        // A target of an indexed jump isn't known.
         switch (insn.opCode() & 0xF0) {
         case 0xA0:
             out.letter('#');
@@ -123,14 +138,17 @@ void DisMc6805::decodeOperand(DisInsn &insn, StrBuffer &out, AddrMode mode) cons
             decodeExtended(insn, out);
             break;
         case 0xD0:
+            insn.setIndirect();
             decodeIndexed(insn, out, M_IX2);
             break;
         case 0x60:
         case 0xE0:
+            insn.setIndirect();
             decodeIndexed(insn, out, M_IX1);
             break;
         case 0x70:
         case 0xF0:
+            insn.setIndirect();
             decodeIndexed(insn, out, M_IX0);
             break;
         }
@@ -26,6 +26,10 @@ namespace mc6805 {
 
 struct DisMc6805 final : Disassembler, Config {
     DisMc6805(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisMc6805(const DisMc6805 &other);
+
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
 
     AddressWidth addressWidth() const override;
     void reset() override;
@@ -32,6 +32,14 @@ DisMc6809::DisMc6809(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+Disassembler *DisMc6809::clone() const {
+    return new DisMc6809(*this);
+}
+
+const /*PROGMEM*/ char *DisMc6809::dataDirective_P() const {
+    return PSTR("FCB");
+}
+
 void DisMc6809::decodeDirectPage(DisInsn &insn, StrBuffer &out) const {
     const uint8_t dir = insn.readByte();
     const auto label = lookup(dir);
@@ -61,6 +69,8 @@ void DisMc6809::decodeIndexed(DisInsn &insn, StrBuffer &out) const {
         insn.setErrorIf(out, UNKNOWN_POSTBYTE);
         return;
     }
+    // A target of an indexed or indirect jump isn't known.
+    insn.setIndirect();
     if (spec.indir)
         out.letter('[');
     if (spec.base != REG_UNDEF && spec.size > 2) {  // n,X
@@ -164,6 +174,8 @@ void DisMc6809::decodePushPull(DisInsn &insn, StrBuffer &out) const {
         post &= ~0x02;  // clear REG_A
     const bool userStack = (insn.opCode() & 2) != 0;
     const bool push = (insn.opCode() & 1) == 0;
+    if (!push && (post & 0x80))
+        insn.setFlow(FLOW_END);  // Pulling PC returns.
     for (uint8_t i = 0, n = 0; i < 8; i++) {
         const uint8_t bitPos = push ? 7 - i : i;
         if (post & (1U << bitPos)) {
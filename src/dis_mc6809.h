@@ -27,6 +27,9 @@ namespace mc6809 {
 struct DisMc6809 final : Disassembler, Config {
     DisMc6809(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
+
 private:
     void decodeDirectPage(DisInsn &insn, StrBuffer &out) const;
     void decodeIndexed(DisInsn &insn, StrBuffer &out) const;
@@ -32,6 +32,14 @@ DisMc68HC12::DisMc68HC12(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+Disassembler *DisMc68HC12::clone() const {
+    return new DisMc68HC12(*this);
+}
+
+const /*PROGMEM*/ char *DisMc68HC12::dataDirective_P() const {
+    return PSTR("FCB");
+}
+
 Config::uintptr_t calculatePcRelBase(DisInsn &insn, AddrMode type) {
     auto base = insn.address();
     const auto mode1 = insn.mode1();
@@ -27,6 +27,9 @@ namespace mc68hc12 {
 struct DisMc68HC12 final : Disassembler, Config {
     DisMc68HC12(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
+
 private:
     void decodeIndexed(DisInsn &insn, StrBuffer &out, Config::opcode_t post, AddrMode mode) const;
     void decodeDirectPage(DisInsn &insn, StrBuffer &out) const;
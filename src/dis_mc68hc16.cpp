@@ -32,6 +32,14 @@ DisMc68HC16::DisMc68HC16(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+Disassembler *DisMc68HC16::clone() const {
+    return new DisMc68HC16(*this);
+}
+
+const /*PROGMEM*/ char *DisMc68HC16::dataDirective_P() const {
+    return PSTR("FCB");
+}
+
 void DisMc68HC16::decodeRegisterList(DisInsn &insn, StrBuffer &out) const {
     const auto push = (insn.opCode() == 0x34);  // PSHM
     static constexpr RegName MASK[] PROGMEM = {
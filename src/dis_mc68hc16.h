@@ -27,6 +27,9 @@ namespace mc68hc16 {
 struct DisMc68HC16 final : Disassembler, Config {
     DisMc68HC16(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
+
 private:
     void decodeRegisterList(DisInsn &insn, StrBuffer &out) const;
     void decodeIndexed(DisInsn &insn, StrBuffer &out, AddrMode mode) const;
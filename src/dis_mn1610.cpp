@@ -40,6 +40,10 @@ DisMn1610::DisMn1610(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+Disassembler *DisMn1610::clone() const {
+    return new DisMn1610(*this);
+}
+
 void DisMn1610::outConditionCode(StrBuffer &out, CcName cc) const {
     if (cc != CC_NONE)
         outCcName(out, cc);
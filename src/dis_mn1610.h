@@ -28,6 +28,8 @@ namespace mn1610 {
 struct DisMn1610 final : Disassembler, Config {
     DisMn1610(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+
 private:
     StrBuffer &outRegister(StrBuffer &out, RegName reg, AddrMode mode) const;
     void outConditionCode(StrBuffer &out, CcName cc) const;
@@ -55,6 +55,27 @@ DisMos6502::DisMos6502(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisMos6502::DisMos6502(const DisMos6502 &other)
+    : Disassembler(other, &_opt_longa),
+      Config(other),
+      _opt_longa(
+              this, &DisMos6502::setLongAccumulator, OPT_BOOL_LONGA, OPT_DESC_LONGA, &_opt_longi),
+      _opt_longi(
+              this, &DisMos6502::setLongIndex, OPT_BOOL_LONGI, OPT_DESC_LONGI, &_opt_indirectLong),
+      _opt_indirectLong(this, &DisMos6502::setUseIndirectLong, OPT_BOOL_INDIRECT_LONG,
+              OPT_DESC_INDIRECT_LONG),
+      _longAccumulator(other._longAccumulator),
+      _longIndex(other._longIndex),
+      _useIndirectLong(other._useIndirectLong) {}
+
+Disassembler *DisMos6502::clone() const {
+    return new DisMos6502(*this);
+}
+
+const /*PROGMEM*/ char *DisMos6502::dataDirective_P() const {
+    return PSTR(".BYTE");
+}
+
 void DisMos6502::reset() {
     Disassembler::reset();
     setLongAccumulator(false);
@@ -26,6 +26,10 @@ namespace mos6502 {
 
 struct DisMos6502 final : Disassembler, Config {
     DisMos6502(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisMos6502(const DisMos6502 &other);
+
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
 
     void reset() override;
 
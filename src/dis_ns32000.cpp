@@ -53,6 +53,23 @@ DisNs32000::DisNs32000(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisNs32000::DisNs32000(const DisNs32000 &other)
+    : Disassembler(other, &_opt_fpu),
+      Config(other),
+      _opt_fpu(this, &Config::setFpuName, OPT_TEXT_FPU, OPT_DESC_FPU, &_opt_pmmu),
+      _opt_pmmu(this, &Config::setPmmuName, OPT_TEXT_PMMU, OPT_DESC_PMMU, &_opt_externalParen),
+      _opt_externalParen(this, &DisNs32000::setExternalParen, OPT_BOOL_EXTERNAL_PAREN,
+              OPT_DESC_EXTERNAL_PAREN),
+      _externalParen(other._externalParen) {}
+
+Disassembler *DisNs32000::clone() const {
+    return new DisNs32000(*this);
+}
+
+const /*PROGMEM*/ char *DisNs32000::dataDirective_P() const {
+    return PSTR(".BYTE");
+}
+
 void DisNs32000::reset() {
     Disassembler::reset();
 #if defined(LIBASM_NS32000_NOFPU)
@@ -556,6 +573,107 @@ Error DisNs32000::decodeImpl(DisMemory &memory, Insn &_insn, StrBuffer &out) con
     return _insn.setError(insn);
 }
 
+void DisNs32000::skipImmediate(DisInsn &insn, AddrMode mode) const {
+    const auto size = insn.size();
+    if (mode == M_GENC) {
+        insn.readByte();
+    } else if (mode != M_FENR && mode != M_FENW) {
+        if (size == SZ_BYTE) {
+            insn.readByte();
+        } else if (size == SZ_WORD) {
+            insn.readUint16Be();
+        } else if (size == SZ_QUAD) {
+            insn.readUint32Be();
+        }
+#if !defined(LIBASM_NS32000_NOFPU)
+    } else if (size == SZ_QUAD) {
+        insn.readUint32();
+    } else if (size == SZ_OCTA) {
+        insn.readUint64();
+#endif
+    }
+}
+
+void DisNs32000::skipGeneric(DisInsn &insn, AddrMode mode, OprPos pos) const {
+    const auto base = getOprField(insn, pos);
+    const auto gen = isScaledIndex(base) ? (insn.indexByte(pos) >> 3) : base;
+    Displacement disp;
+    if ((gen >= 0x08 && gen < 0x10) || gen == 0x15 || (gen >= 0x18 && gen < 0x1C)) {
+        readDisplacement(insn, disp);  // M_RREL, M_ABS, M_MEM
+    } else if ((gen >= 0x10 && gen < 0x13) || gen == 0x16) {
+        readDisplacement(insn, disp);  // M_MREL, M_EXT
+        readDisplacement(insn, disp);
+    } else if (gen == 0x14) {
+        skipImmediate(insn, mode);  // M_IMM
+    }
+}
+
+void DisNs32000::skipOperand(DisInsn &insn, AddrMode mode, OprPos pos) const {
+    Displacement disp;
+    switch (mode) {
+    case M_FENW:
+    case M_FENR:
+    case M_GENR:
+    case M_GENW:
+    case M_GENC:
+    case M_GENA:
+        skipGeneric(insn, mode, pos);
+        break;
+    case M_RLST:
+    case M_BFOFF:
+    case M_BFLEN:
+        insn.readByte();
+        break;
+    case M_REL:
+    case M_DISP:
+    case M_LEN32:
+    case M_LEN16:
+        readDisplacement(insn, disp);
+        break;
+    default:
+        break;
+    }
+}
+
+Error DisNs32000::lengthImpl(DisMemory &memory, Insn &_insn) const {
+    char buffer[1];
+    StrBuffer out{buffer, sizeof(buffer)};
+    DisInsn insn(_insn, memory, out);
+    const auto opc = insn.readByte();
+    insn.setOpCode(opc);
+    if (isPrefixCode(_cpuSpec, opc)) {
+        insn.setPrefix(opc);
+        insn.setOpCode(insn.readByte());
+        if (insn.getError())
+            return _insn.setError(insn);
+    }
+    if (searchOpCode(_cpuSpec, insn, out))
+        return _insn.setError(insn);
+
+    readIndexByte(insn, insn.src(), insn.srcPos());
+    readIndexByte(insn, insn.dst(), insn.dstPos());
+    readIndexByte(insn, insn.ex1(), insn.ex1Pos());
+
+    skipOperand(insn, insn.src(), insn.srcPos());
+    const auto dst = insn.dst();
+    if (dst == M_ZERO) {
+        if (getOprField(insn, insn.dstPos()) != 0) {
+            insn.nameBuffer().reset();
+            insn.setError(UNKNOWN_INSTRUCTION);
+        }
+    } else if (dst != M_NONE) {
+        skipOperand(insn, dst, insn.dstPos());
+        const auto ex1 = insn.ex1();
+        if (ex1 != M_NONE) {
+            skipOperand(insn, ex1, insn.ex1Pos());
+            const auto ex2 = insn.ex2();
+            if (ex2 != M_BFLEN)
+                skipOperand(insn, ex2, insn.ex2Pos());
+        }
+    }
+    return _insn.setError(insn);
+}
+
 }  // namespace ns32000
 }  // namespace libasm
 
@@ -26,6 +26,10 @@ namespace ns32000 {
 
 struct DisNs32000 final : Disassembler, Config {
     DisNs32000(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisNs32000(const DisNs32000 &other);
+
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
 
     void reset() override;
 
@@ -63,8 +67,12 @@ private:
             Error idxError) const;
     void decodeOperand(DisInsn &insn, StrBuffer &out, AddrMode mode, OprPos pos, OprSize size,
             Error idxError = OK) const;
+    void skipImmediate(DisInsn &insn, AddrMode mode) const;
+    void skipGeneric(DisInsn &insn, AddrMode mode, OprPos pos) const;
+    void skipOperand(DisInsn &insn, AddrMode mode, OprPos pos) const;
 
     Error decodeImpl(DisMemory &memory, Insn &insn, StrBuffer &out) const override;
+    Error lengthImpl(DisMemory &memory, Insn &insn) const override;
     const ConfigBase &config() const override { return *this; }
     ConfigSetter &configSetter() override { return *this; }
     static const ValueFormatter::Plugins &defaultPlugins();
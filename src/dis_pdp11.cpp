@@ -37,6 +37,14 @@ DisPdp11::DisPdp11(const ValueFormatter::Plugins &plugins) : Disassembler(plugin
     reset();
 }
 
+Disassembler *DisPdp11::clone() const {
+    return new DisPdp11(*this);
+}
+
+const /*PROGMEM*/ char *DisPdp11::dataDirective_P() const {
+    return PSTR(".BYTE");
+}
+
 void DisPdp11::reset() {
     Disassembler::reset();
     setListRadix(RADIX_8);
@@ -127,6 +135,9 @@ void DisPdp11::decodeGeneralMode(DisInsn &insn, StrBuffer &out, AddrMode mode, u
     }
     if (mode == M_GENA && m == 0)  // Rn
         insn.setErrorIf(out, REGISTER_NOT_ALLOWED);
+    // A target of a deferred or register mode jump isn't known.
+    if (mode == M_GENA && !(r == 7 && (m == 3 || m == 6)))
+        insn.setIndirect();
     auto reg = decodeGeneralReg(r);
     if ((mode == M_GENF || mode == M_GENG) && m == 0) {
         if (r < 6) {  // AC0~AC5
@@ -27,6 +27,9 @@ namespace pdp11 {
 struct DisPdp11 final : Disassembler, Config {
     DisPdp11(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
+
     void reset() override;
 
 private:
@@ -34,6 +34,10 @@ DisPdp8::DisPdp8(const ValueFormatter::Plugins &plugins) : Disassembler(plugins)
     reset();
 }
 
+Disassembler *DisPdp8::clone() const {
+    return new DisPdp8(*this);
+}
+
 void DisPdp8::reset() {
     Disassembler::reset();
     setListRadix(RADIX_8);
@@ -27,6 +27,8 @@ namespace pdp8 {
 struct DisPdp8 final : Disassembler, Config {
     DisPdp8(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+
     void reset() override;
 
 private:
@@ -39,6 +39,14 @@ DisScn2650::DisScn2650(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+Disassembler *DisScn2650::clone() const {
+    return new DisScn2650(*this);
+}
+
+const /*PROGMEM*/ char *DisScn2650::dataDirective_P() const {
+    return PSTR("DATA");
+}
+
 namespace {
 
 StrBuffer &appendCcName(DisInsn &insn, StrBuffer &out, CcName name) {
@@ -59,8 +67,10 @@ StrBuffer &appendRegName(DisInsn &insn, StrBuffer &out, RegName name) {
 
 void DisScn2650::decodeAbsolute(DisInsn &insn, StrBuffer &out, AddrMode mode) const {
     const auto opr = insn.readUint16();
-    if (opr & 0x8000)
+    if (opr & 0x8000) {
+        insn.setIndirect();  // A target is a pointer to code.
         out.letter('*');
+    }
     outAbsAddr(out, opr & ~0x8000);
     if (mode == M_IX15) {
         out.comma();
@@ -70,8 +80,10 @@ void DisScn2650::decodeAbsolute(DisInsn &insn, StrBuffer &out, AddrMode mode) co
 
 void DisScn2650::decodeIndexed(DisInsn &insn, StrBuffer &out) const {
     const auto opr = insn.readUint16();
-    if (opr & 0x8000)
+    if (opr & 0x8000) {
+        insn.setIndirect();
         out.letter('*');
+    }
     const auto base = inpage(insn.address(), insn.length());
     const auto target = page(base) | offset(opr);
     outAbsAddr(out, target);
@@ -92,8 +104,10 @@ void DisScn2650::decodeIndexed(DisInsn &insn, StrBuffer &out) const {
 
 void DisScn2650::decodeRelative(DisInsn &insn, StrBuffer &out, AddrMode mode) const {
     const auto opr = insn.readByte();
-    if (opr & 0x80)
+    if (opr & 0x80) {
+        insn.setIndirect();
         out.letter('*');
+    }
     // Sign extends 7-bit number
     const auto delta = signExtend(opr, 7);
     if (mode == M_REL7) {
@@ -116,8 +130,12 @@ void DisScn2650::decodeOperand(DisInsn &insn, StrBuffer &out, const AddrMode mod
             break;
         appendRegName(insn, out, decodeRegName(insn.opCode()));
         break;
-    case M_C012:
     case M_CCVN:
+        // A conditional branch or return continues unless its condition is UN.
+        if (decodeCcName(insn.opCode()) != CC_UN)
+            insn.setConditional();
+        /* Fall-through */
+    case M_C012:
         appendCcName(insn, out, decodeCcName(insn.opCode()));
         break;
     case M_IMM8:
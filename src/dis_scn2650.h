@@ -27,6 +27,9 @@ namespace scn2650 {
 struct DisScn2650 final : Disassembler, Config {
     DisScn2650(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
+
 private:
     void decodeAbsolute(DisInsn &insn, StrBuffer &out, AddrMode mode) const;
     void decodeIndexed(DisInsn &insn, StrBuffer &out) const;
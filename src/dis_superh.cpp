@@ -37,6 +37,15 @@ DisSuperH::DisSuperH(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisSuperH::DisSuperH(const DisSuperH &other)
+    : Disassembler(other, &_opt_fpu),
+      Config(other),
+      _opt_fpu(this, &Config::setFpuName, OPT_TEXT_FPU, OPT_DESC_FPU) {}
+
+Disassembler *DisSuperH::clone() const {
+    return new DisSuperH(*this);
+}
+
 void DisSuperH::reset() {
     Disassembler::reset();
 #if defined(LIBASM_SUPERH_NOFPU)
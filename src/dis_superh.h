@@ -26,6 +26,9 @@ namespace superh {
 
 struct DisSuperH final : Disassembler, Config {
     DisSuperH(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisSuperH(const DisSuperH &other);
+
+    Disassembler *clone() const override;
 
     void reset() override;
 
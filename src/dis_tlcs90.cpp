@@ -32,6 +32,14 @@ DisTlcs90::DisTlcs90(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+Disassembler *DisTlcs90::clone() const {
+    return new DisTlcs90(*this);
+}
+
+const /*PROGMEM*/ char *DisTlcs90::dataDirective_P() const {
+    return PSTR("DB");
+}
+
 Error DisTlcs90::readOperand(DisInsn &insn, AddrMode mode, Operand &op) const {
     const auto opc = insn.opCode();
     op.mode = mode;
@@ -147,6 +155,8 @@ void DisTlcs90::decodeOperand(
             out.letter(')');
         break;
     case M_CC:
+        if (op.cc != CC_T)
+            insn.setConditional();
         outCcName(out, op.cc);
         break;
     case M_STACK:
@@ -180,6 +190,9 @@ Error DisTlcs90::decodeImpl(DisMemory &memory, Insn &_insn, StrBuffer &out) cons
     if (dst != M_NONE) {
         const auto *start = out.mark();
         if (dst == M_DST) {
+            // A target of a register or indexed jump isn't known.
+            if (insn.pre() != M_EXT)
+                insn.setIndirect();
             decodeOperand(insn, out, insn.pre(), prefixOp);
         } else {
             Operand op;
@@ -192,6 +205,8 @@ Error DisTlcs90::decodeImpl(DisMemory &memory, Insn &_insn, StrBuffer &out) cons
             if (out.mark() != start)  // skip CC_T because it's empty.
                 out.comma();
             if (src == M_SRC) {
+                if (insn.pre() != M_EXT)
+                    insn.setIndirect();
                 decodeOperand(insn, out, insn.pre(), prefixOp);
             } else {
                 Operand op;
@@ -29,6 +29,9 @@ struct Operand;
 struct DisTlcs90 final : Disassembler, Config {
     DisTlcs90(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
+
 private:
     Error readOperand(DisInsn &insn, AddrMode mode, Operand &op) const;
     void decodeRelative(DisInsn &insn, StrBuffer &out, AddrMode mode, const Operand &op) const;
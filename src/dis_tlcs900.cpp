@@ -36,6 +36,19 @@ DisTlcs900::DisTlcs900(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisTlcs900::DisTlcs900(const DisTlcs900 &other)
+    : Disassembler(other, &_opt_maxMode),
+      Config(other),
+      _opt_maxMode(this, &Config::setMaxMode, OPT_BOOL_MAXIMUM_MODE, OPT_DESC_MAXIMUM_MODE) {}
+
+Disassembler *DisTlcs900::clone() const {
+    return new DisTlcs900(*this);
+}
+
+const /*PROGMEM*/ char *DisTlcs900::dataDirective_P() const {
+    return PSTR("DB");
+}
+
 // Decode the sub-byte for complex/pre-dec/post-inc addressing (0xF0-0xFF range).
 // Returns the index register and the operand size (0=byte, 1=word, 2=lword).
 // Split a complex sub-byte "r32' zz" into the base register code (low 2 bits
@@ -317,6 +330,10 @@ void DisTlcs900::decodeOperand(
         break;
     case M_DST:
         if (pm == PM_MEMD) {
+            // A target of a register indirect jump isn't known.
+            const auto mode = prefixOp.mode;
+            if (mode != M_ABS8 && mode != M_ABS16 && mode != M_ABS24)
+                insn.setIndirect();
             outMemAddr(out, prefixOp);
         } else {
             switch (pm) {
@@ -422,9 +439,13 @@ void DisTlcs900::decodeOperand(
         else
             outHex(out, insn.readByte() & 7, 4);
         break;
-    case M_CC:
-        outCcName(out, decodeCcName(opc & 0xF));
+    case M_CC: {
+        const auto cc = decodeCcName(opc & 0xF);
+        if (cc != CC_T)
+            insn.setConditional();
+        outCcName(out, cc);
         break;
+    }
     case M_REL8: {
         const auto delta = static_cast<int8_t>(insn.readByte());
         const auto target = static_cast<uint32_t>(insn.address() + insn.length() + delta);
@@ -27,6 +27,10 @@ namespace tlcs900 {
 
 struct DisTlcs900 final : Disassembler, Config {
     DisTlcs900(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisTlcs900(const DisTlcs900 &other);
+
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
 
 private:
     const BoolOption<Config> _opt_maxMode;
@@ -55,6 +55,20 @@ DisTms320::DisTms320(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisTms320::DisTms320(const DisTms320 &other)
+    : Disassembler(other, &_opt_useAuxName),
+      Config(other),
+      _opt_useAuxName(this, &DisTms320::setUseAuxName, OPT_BOOL_USE_REG_NAME, OPT_DESC_USE_REG_NAME,
+              &_opt_usePortName),
+      _opt_usePortName(
+              this, &DisTms320::setUsePortName, OPT_BOOL_USE_PORT_NAME, OPT_DESC_USE_PORT_NAME),
+      _useAuxName(other._useAuxName),
+      _usePortName(other._usePortName) {}
+
+Disassembler *DisTms320::clone() const {
+    return new DisTms320(*this);
+}
+
 void DisTms320::reset() {
     Disassembler::reset();
     setUseAuxName(true);
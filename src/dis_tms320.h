@@ -26,6 +26,9 @@ namespace tms320 {
 
 struct DisTms320 final : Disassembler, Config {
     DisTms320(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisTms320(const DisTms320 &other);
+
+    Disassembler *clone() const override;
 
     void reset() override;
 
@@ -42,6 +42,10 @@ DisTms320f::DisTms320f(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+Disassembler *DisTms320f::clone() const {
+    return new DisTms320f(*this);
+}
+
 void DisTms320f::decodeRelative(DisInsn &insn, StrBuffer &out, AddrMode mode) const {
     if ((insn.opCode() & (UINT32_C(1) << 25)) == 0) {
         const auto reg = decodeRegName(insn.opCode() & UINT16_MAX);
@@ -27,6 +27,8 @@ namespace tms320f {
 struct DisTms320f final : Disassembler, Config {
     DisTms320f(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+
 private:
     // Cross-instruction state carried on the Insn (per Insn::state<T>).
     // hasParaDst: set during the first half of a parallel pair, consumed by
@@ -38,6 +38,14 @@ DisTms370::DisTms370(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+Disassembler *DisTms370::clone() const {
+    return new DisTms370(*this);
+}
+
+const /*PROGMEM*/ char *DisTms370::dataDirective_P() const {
+    return PSTR(".BYTE");
+}
+
 StrBuffer &DisTms370::outPortAddr(StrBuffer &out, uint_fast8_t port) const {
     const auto addr = UINT16_C(0x1000) + port;
     auto label = lookup(addr, addressWidth());
@@ -27,6 +27,9 @@ namespace tms370 {
 struct DisTms370 final : Disassembler, Config {
     DisTms370(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
+
 private:
     StrBuffer &outPortAddr(StrBuffer &out, uint_fast8_t port) const;
     void decodeRegister(DisInsn &insn, StrBuffer &out) const;
@@ -38,6 +38,14 @@ DisTms7000::DisTms7000(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+Disassembler *DisTms7000::clone() const {
+    return new DisTms7000(*this);
+}
+
+const /*PROGMEM*/ char *DisTms7000::dataDirective_P() const {
+    return PSTR("BYTE");
+}
+
 StrBuffer &DisTms7000::outPortAddr(StrBuffer &out, uint_fast8_t port) const {
     const auto addr = UINT16_C(0x0100) + port;
     auto label = lookup(addr, addressWidth());
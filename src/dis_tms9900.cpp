@@ -32,6 +32,14 @@ DisTms9900::DisTms9900(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+Disassembler *DisTms9900::clone() const {
+    return new DisTms9900(*this);
+}
+
+const /*PROGMEM*/ char *DisTms9900::dataDirective_P() const {
+    return PSTR("BYTE");
+}
+
 Error DisTms9900::checkPostWord(DisInsn &insn) const {
     const auto post = insn.postfix();
     const auto src = (post >> 4 & 3);
@@ -27,6 +27,9 @@ namespace tms9900 {
 struct DisTms9900 final : Disassembler, Config {
     DisTms9900(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
+
 private:
     Error checkPostWord(DisInsn &insn) const;
     void decodeRelative(DisInsn &insn, StrBuffer &out) const;
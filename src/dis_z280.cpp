@@ -32,6 +32,14 @@ DisZ280::DisZ280(const ValueFormatter::Plugins &plugins) : Disassembler(plugins)
     reset();
 }
 
+Disassembler *DisZ280::clone() const {
+    return new DisZ280(*this);
+}
+
+const /*PROGMEM*/ char *DisZ280::dataDirective_P() const {
+    return PSTR("DB");
+}
+
 StrBuffer &DisZ280::outIndirectReg(StrBuffer &out, RegName reg) const {
     return outRegName(out.letter('('), reg).letter(')');
 }
@@ -37,6 +37,21 @@ DisZ380::DisZ380(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisZ380::DisZ380(const DisZ380 &other)
+    : Disassembler(other, &_opt_extmode),
+      Config(other),
+      _opt_extmode(
+              this, &DisZ380::setExtendedMode, OPT_BOOL_EXTMODE, OPT_DESC_EXTMODE, &_opt_lwordmode),
+      _opt_lwordmode(this, &DisZ380::setLongWordMode, OPT_BOOL_LWORDMODE, OPT_DESC_LWORDMODE) {}
+
+Disassembler *DisZ380::clone() const {
+    return new DisZ380(*this);
+}
+
+const /*PROGMEM*/ char *DisZ380::dataDirective_P() const {
+    return PSTR("DB");
+}
+
 void DisZ380::reset() {
     Disassembler::reset();
     setExtendedMode(false);
@@ -27,6 +27,10 @@ namespace z380 {
 
 struct DisZ380 final : Disassembler, Config {
     DisZ380(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisZ380(const DisZ380 &other);
+
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
 
     void reset() override;
 
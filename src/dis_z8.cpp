@@ -42,6 +42,21 @@ DisZ8::DisZ8(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisZ8::DisZ8(const DisZ8 &other)
+    : Disassembler(other, &_opt_workRegister),
+      Config(other),
+      _opt_workRegister(
+              this, &DisZ8::setUseWorkRegister, OPT_BOOL_WORK_REGISTER, OPT_DESC_WORK_REGISTER),
+      _useWorkRegister(other._useWorkRegister) {}
+
+Disassembler *DisZ8::clone() const {
+    return new DisZ8(*this);
+}
+
+const /*PROGMEM*/ char *DisZ8::dataDirective_P() const {
+    return PSTR("DB");
+}
+
 void DisZ8::reset() {
     Disassembler::reset();
     setUseWorkRegister(true);
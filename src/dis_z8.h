@@ -26,6 +26,10 @@ namespace z8 {
 
 struct DisZ8 final : Disassembler, Config {
     DisZ8(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisZ8(const DisZ8 &other);
+
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
 
     void reset() override;
 
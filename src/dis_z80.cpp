@@ -32,6 +32,14 @@ DisZ80::DisZ80(const ValueFormatter::Plugins &plugins) : Disassembler(plugins),
     reset();
 }
 
+Disassembler *DisZ80::clone() const {
+    return new DisZ80(*this);
+}
+
+const /*PROGMEM*/ char *DisZ80::dataDirective_P() const {
+    return PSTR("DB");
+}
+
 StrBuffer &DisZ80::outIndirectReg(StrBuffer &out, RegName reg) const {
     return outRegName(out.letter('('), reg).letter(')');
 }
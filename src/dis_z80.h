@@ -28,6 +28,9 @@ namespace z80 {
 struct DisZ80 final : Disassembler, Config {
     DisZ80(const ValueFormatter::Plugins &plugins = defaultPlugins());
 
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
+
 private:
     StrBuffer &outIndirectReg(StrBuffer &out, RegName reg) const;
     StrBuffer &outDataReg(StrBuffer &out, RegName reg) const;
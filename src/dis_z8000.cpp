@@ -50,6 +50,27 @@ DisZ8000::DisZ8000(const ValueFormatter::Plugins &plugins)
     reset();
 }
 
+DisZ8000::DisZ8000(const DisZ8000 &other)
+    : Disassembler(other, &_opt_shortDirect),
+      Config(other),
+      _opt_shortDirect(this, &DisZ8000::setShortDirect, OPT_BOOL_SHORT_DIRECT,
+              OPT_DESC_SHORT_DIRECT, &_opt_segmentedAddr),
+      _opt_segmentedAddr(this, &DisZ8000::setSegmentedAddr, OPT_BOOL_SEGMENTED_ADDR,
+              OPT_DESC_SEGMENTED_ADDR, &_opt_externSymbol),
+      _opt_externSymbol(
+              this, &DisZ8000::setExternSymbol, OPT_BOOL_EXTERN_SYMBOL, OPT_DESC_EXTERN_SYMBOL),
+      _shortDirect(other._shortDirect),
+      _segmentedAddr(other._segmentedAddr),
+      _externSymbol(other._externSymbol) {}
+
+Disassembler *DisZ8000::clone() const {
+    return new DisZ8000(*this);
+}
+
+const /*PROGMEM*/ char *DisZ8000::dataDirective_P() const {
+    return PSTR("BYTE");
+}
+
 void DisZ8000::reset() {
     Disassembler::reset();
     setShortDirect(true);
@@ -181,6 +202,8 @@ void DisZ8000::decodeGenericAddressing(
                 return decodeImmediate(insn, out, M_IM, insn.size());  // M_IM
             }
         }
+        // A target of an indirect jump isn't known.
+        insn.setIndirect();
         return decodeGeneralRegister(insn, out, M_IR, num);  // M_IR
     }
     if (addressing == 2) {
@@ -191,6 +214,8 @@ void DisZ8000::decodeGenericAddressing(
     if (addressing == 1) {  // M_DA/M_X
         decodeDirectAddress(insn, out, num == 0 ? M_DA : mode);
         if (num) {
+            // A target of an indexed jump isn't known.
+            insn.setIndirect();
             out.letter('(');
             decodeGeneralRegister(insn, out, M_WR, num);
             out.letter(')');
@@ -302,9 +327,13 @@ void DisZ8000::decodeOperand(DisInsn &insn, StrBuffer &out, AddrMode mode, OprPo
     case M_BX:
         decodeBaseAddressing(insn, out, mode, num);
         break;
-    case M_CC:
-        outCcName(out, decodeCcNum(num));
+    case M_CC: {
+        const auto cc = decodeCcNum(num);
+        if (cc != CC_T)
+            insn.setConditional();
+        outCcName(out, cc);
         break;
+    }
     case M_CTL:
         decodeControlRegister(insn, out, num, insn.size());
         break;
@@ -454,6 +483,68 @@ Error DisZ8000::decodeImpl(DisMemory &memory, Insn &_insn, StrBuffer &out) const
     return _insn.setError(insn);
 }
 
+void DisZ8000::skipDirectAddress(DisInsn &insn) const {
+    const auto val16 = insn.readUint16();
+    if (cpuType() == Z8001 && (val16 & 0x8000))
+        insn.readUint16();
+}
+
+void DisZ8000::skipOperand(DisInsn &insn, AddrMode mode, OprPos pos) const {
+    switch (mode) {
+    case M_BA:
+    case M_IO:
+    case M_RA:
+    case M_SCNT:
+    case M_NCNT:
+        insn.readUint16();
+        break;
+    case M_DA:
+        skipDirectAddress(insn);
+        break;
+    case M_GENA:
+    case M_GEND:
+    case M_GENI:
+    case M_X: {
+        const auto addressing = insn.opCode() >> 14;
+        if (addressing == 1) {
+            skipDirectAddress(insn);
+        } else if (addressing == 0 && mode == M_GENI && (modePos(insn, pos) & 0xF) == 0) {
+            skipOperand(insn, M_IM, pos);
+        }
+        break;
+    }
+    case M_IM:
+        if (insn.size() == SZ_BYTE || insn.size() == SZ_WORD) {
+            insn.readUint16();
+        } else if (insn.size() == SZ_QUAD) {
+            insn.readUint32();
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+Error DisZ8000::lengthImpl(DisMemory &memory, Insn &_insn) const {
+    char buffer[1];
+    StrBuffer out{buffer, sizeof(buffer)};
+    DisInsn insn(_insn, memory, out);
+    insn.setOpCode(insn.readUint16());
+    if (searchOpCode(cpuType(), insn, out))
+        return _insn.setError(insn);
+
+    skipOperand(insn, insn.dst(), insn.dstPos());
+    if (insn.src() != M_NONE) {
+        skipOperand(insn, insn.src(), insn.srcPos());
+        const auto ex1 = insn.ex1();
+        if (ex1 != M_NONE) {
+            skipOperand(insn, ex1, ex1 == M_CNT ? OP_P0 : OP_P8);
+            skipOperand(insn, insn.ex2(), OP_P0);
+        }
+    }
+    return _insn.setError(insn);
+}
+
 }  // namespace z8000
 }  // namespace libasm
 
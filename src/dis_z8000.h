@@ -26,6 +26,10 @@ namespace z8000 {
 
 struct DisZ8000 final : Disassembler, Config {
     DisZ8000(const ValueFormatter::Plugins &plugins = defaultPlugins());
+    DisZ8000(const DisZ8000 &other);
+
+    Disassembler *clone() const override;
+    const /*PROGMEM*/ char *dataDirective_P() const override;
 
     void reset() override;
 
@@ -53,8 +57,11 @@ private:
     void decodeRelativeAddressing(DisInsn &insn, StrBuffer &out, AddrMode mode) const;
     void decodeOperand(DisInsn &insn, StrBuffer &out, AddrMode mode, OprPos pos) const;
     Error checkRegisterOverlap(DisInsn &insn, StrBuffer &out) const;
+    void skipDirectAddress(DisInsn &insn) const;
+    void skipOperand(DisInsn &insn, AddrMode mode, OprPos pos) const;
 
     Error decodeImpl(DisMemory &memory, Insn &insn, StrBuffer &out) const override;
+    Error lengthImpl(DisMemory &memory, Insn &insn) const override;
     const ConfigBase &config() const override { return *this; }
     ConfigSetter &configSetter() override { return *this; }
     static const ValueFormatter::Plugins &defaultPlugins();
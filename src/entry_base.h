@@ -18,22 +18,37 @@
 #define __LIBASM_ENTRY_BASE_H__
 
 #include "config_host.h"
+#include "insn_base.h"
 
 namespace libasm {
 namespace entry {
 
+/**
+ * Instruction name of a table entry and its control flow.
+ */
+struct Name {
+    constexpr Name(const /* PROGMEM */ char *name_P, ControlFlow flow = FLOW_NEXT)
+        : name_P(name_P), flow(flow) {}
+    const /* PROGMEM */ char *const name_P;
+    const ControlFlow flow;
+};
+
 /**
  * Base for instruction table entry.
  */
 template <typename OPCODE>
 struct Base {
-    constexpr Base(const /* PROGMEM */ char *name_P, OPCODE opCode)
-        : _name_P(name_P), _opCode_P(opCode) {}
+    using opcode_t = OPCODE;
+
+    constexpr Base(Name name, OPCODE opCode)
+        : _name_P(name.name_P), _opCode_P(opCode), _flow_P(name.flow) {}
 
     const /* PROGMEM */ char *name_P() const {
         return reinterpret_cast<const char *>(pgm_read_ptr(&_name_P));
     }
 
+    ControlFlow readFlow() const { return ControlFlow(pgm_read_byte(&_flow_P)); }
+
     OPCODE readOpCode() const {
         if (sizeof(OPCODE) == 1) {
             return pgm_read_byte(&_opCode_P);
@@ -49,9 +64,25 @@ struct Base {
 private:
     const /* PROGMEM */ char *const _name_P;
     const OPCODE _opCode_P;
+    const ControlFlow _flow_P;
 };
 
 }  // namespace entry
+
+/** Instruction |name_P| which transfers to its target or continues, such as a call. */
+constexpr entry::Name flowBranch(const /* PROGMEM */ char *name_P) {
+    return entry::Name(name_P, FLOW_BRANCH);
+}
+
+/** Instruction |name_P| which transfers to its target and never continues. */
+constexpr entry::Name flowJump(const /* PROGMEM */ char *name_P) {
+    return entry::Name(name_P, FLOW_JUMP);
+}
+
+/** Instruction |name_P| which never continues and has no target, such as a return. */
+constexpr entry::Name flowEnd(const /* PROGMEM */ char *name_P) {
+    return entry::Name(name_P, FLOW_END);
+}
 }  // namespace libasm
 
 #endif  // __LIBASM_ENTRY_BASE_H__
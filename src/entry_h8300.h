@@ -138,8 +138,8 @@ struct Entry final : entry::Base<Config::opcode_t> {
         static constexpr uint_fast8_t pos_gm = 0x7;
     };
 
-    constexpr Entry(Config::opcode_t opc, Flags flags, const /* PROGMEM */ char *name_P)
-        : Base(name_P, opc), _flags_P(flags) {}
+    constexpr Entry(Config::opcode_t opc, Flags flags, entry::Name name)
+        : Base(name, opc), _flags_P(flags) {}
 
     Flags readFlags() const {
         return Flags{pgm_read_byte(&_flags_P._src), pgm_read_byte(&_flags_P._dst),
@@ -159,8 +159,8 @@ struct Entry final : entry::Base<uint8_t> {
         static constexpr uint_fast8_t cls_gm = 0x7;
     };
 
-    constexpr Entry(uint8_t opc, Flags flags, const /* PROGMEM */ char *name_P)
-        : Base(name_P, opc), _flags_P(flags) {}
+    constexpr Entry(uint8_t opc, Flags flags, entry::Name name)
+        : Base(name, opc), _flags_P(flags) {}
 
     Flags readFlags() const {
         return Flags{pgm_read_byte(&_flags_P._a), pgm_read_byte(&_flags_P._b),
@@ -98,8 +98,8 @@ struct Entry final : entry::Base<Config::opcode_t> {
         static constexpr uint16_t post_fm = uint16_t(1) << 14;  // has post byte
     };
 
-    constexpr Entry(Config::opcode_t opc, Flags flags, const /* PROGMEM */ char *name_P)
-        : Base(name_P, opc), _flags_P(flags) {}
+    constexpr Entry(Config::opcode_t opc, Flags flags, entry::Name name)
+        : Base(name, opc), _flags_P(flags) {}
 
     Flags readFlags() const { return Flags{pgm_read_word(&_flags_P._attr)}; }
 
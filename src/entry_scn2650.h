@@ -77,8 +77,8 @@ struct Entry final : entry::Base<Config::opcode_t> {
         static constexpr uint8_t cf_gm = 0x1;
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const /* PROGMEM */ char *name_P)
-        : Base(name_P, opCode), _flags_P(flags) {}
+    constexpr Entry(Config::opcode_t opCode, Flags flags, entry::Name name)
+        : Base(name, opCode), _flags_P(flags) {}
 
     Flags readFlags() const { return Flags{pgm_read_byte(&_flags_P._attr)}; }
 
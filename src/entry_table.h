@@ -17,9 +17,11 @@
 #ifndef __LIBASM_ENTRY_TABLE_H__
 #define __LIBASM_ENTRY_TABLE_H__
 
+#include <ctype.h>
 #include <string.h>
 
 #include "str_buffer.h"
+#include "stats.h"
 #include "str_scanner.h"
 #include "table_base.h"
 #include "type_traits.h"
@@ -36,6 +38,9 @@ struct TableBase {
             const /* PROGMEM */ uint8_t *index_P, const /* PROGMEM */ uint8_t *itail_P)
         : _entries(head_P, tail_P, index_P, itail_P) {}
 
+    const ENTRY *readHead() const { return _entries.readHead(); }
+    const ENTRY *readTail() const { return _entries.readTail(); }
+
     template <typename DATA, typename EXTRA>
     using Matcher = bool (*)(DATA &, const ENTRY *, EXTRA);
 
@@ -77,6 +82,228 @@ private:
     const /* PROGMEM */ uint16_t _prefix_P;
 };
 
+#if !defined(LIBASM_DIS_NOINDEX)
+
+/**
+ * Opcode dispatch index of instruction pages.
+ *
+ * Entries of each page are distributed into buckets keyed by the most significant byte of the
+ * first opcode unit, keeping table order. A bucket holds only entries whose opcode may match the
+ * key, so that |CpuBase::searchOpCode| calls |matchCode| on plausible entries only. |opCodeMask|
+ * must return a superset of opcode bits which |matchCode| ignores.
+ */
+template <typename ENTRY_PAGE, typename ENTRY>
+struct OpCodeIndex {
+    using opcode_t = typename ENTRY::opcode_t;
+    using OpCodeMask = opcode_t (*)(const ENTRY *, const ENTRY_PAGE *);
+
+    OpCodeIndex() : _head(nullptr), _offsets(nullptr), _entries(nullptr) {}
+    ~OpCodeIndex() {
+        delete[] _offsets;
+        delete[] _entries;
+    }
+
+    static uint_fast8_t key(opcode_t opCode) { return opCode >> SHIFT; }
+
+    void build(const ENTRY_PAGE *head, const ENTRY_PAGE *tail, OpCodeMask opCodeMask) {
+        _head = head;
+        const auto buckets = (tail - head) * BUCKETS;
+        _offsets = new uint32_t[buckets + 1];
+        for (auto pass = 0; pass < 2; pass++) {
+            uint32_t n = 0;
+            for (auto page = head; page < tail; page++) {
+                for (auto key = 0; key < BUCKETS; key++) {
+                    _offsets[(page - head) * BUCKETS + key] = n;
+                    const auto *end = page->readTail();
+                    for (auto *entry = page->readHead(); entry < end; entry++) {
+                        if (mayMatch(key, entry, opCodeMask(entry, page))) {
+                            if (_entries)
+                                _entries[n] = entry;
+                            n++;
+                        }
+                    }
+                }
+            }
+            _offsets[buckets] = n;
+            if (_entries == nullptr)
+                _entries = new const ENTRY *[n];
+        }
+    }
+
+    const ENTRY *const *begin(const ENTRY_PAGE *page, uint_fast8_t key) const {
+        return _entries + _offsets[(page - _head) * BUCKETS + key];
+    }
+
+    const ENTRY *const *end(const ENTRY_PAGE *page, uint_fast8_t key) const {
+        return _entries + _offsets[(page - _head) * BUCKETS + key + 1];
+    }
+
+private:
+    static constexpr auto BUCKETS = 256;
+    static constexpr auto SHIFT = (sizeof(opcode_t) - 1) * 8;
+    const ENTRY_PAGE *_head;
+    uint32_t *_offsets;
+    const ENTRY **_entries;
+
+    static bool mayMatch(uint_fast8_t key, const ENTRY *entry, opcode_t mask) {
+        const auto fixed = static_cast<uint8_t>(~mask >> SHIFT);
+        return ((key ^ (entry->readOpCode() >> SHIFT)) & fixed) == 0;
+    }
+};
+
+/**
+ * Opcode dispatch indexes of all CPUs in a CPU table, which are built at once.
+ */
+template <typename CPU_T, typename ENTRY_PAGE, typename ENTRY>
+struct OpCodeIndexes {
+    using Index = OpCodeIndex<ENTRY_PAGE, ENTRY>;
+
+    OpCodeIndexes(const CPU_T *head, const CPU_T *tail, typename Index::OpCodeMask opCodeMask)
+        : _head(head), _indexes(new Index[tail - head]) {
+        for (auto cpu = head; cpu < tail; cpu++)
+            _indexes[cpu - head].build(cpu->pagesBegin(), cpu->pagesEnd(), opCodeMask);
+    }
+    ~OpCodeIndexes() { delete[] _indexes; }
+
+    const Index &operator[](const CPU_T *cpu) const { return _indexes[cpu - _head]; }
+
+private:
+    const CPU_T *const _head;
+    Index *const _indexes;
+};
+
+#endif
+
+#if !defined(LIBASM_ASM_NOINDEX)
+
+/**
+ * Mnemonic hash index of instruction pages.
+ *
+ * Each distinct mnemonic of all pages is hashed case-insensitively into an open addressing table.
+ * A slot holds candidate entries having the mnemonic in the order which |CpuBase::searchName|
+ * tries them; page order, then name index order within a page.
+ */
+template <typename ENTRY_PAGE, typename ENTRY>
+struct NameIndex {
+    struct Candidate {
+        const ENTRY_PAGE *page;
+        const ENTRY *entry;
+    };
+
+    struct Slot {
+        Slot() : name_P(nullptr), begin(0), end(0) {}
+        const /* PROGMEM */ char *name_P;
+        uint32_t begin;
+        uint32_t end;
+    };
+
+    NameIndex() : _mask(0), _slots(nullptr), _candidates(nullptr) {}
+    ~NameIndex() {
+        delete[] _slots;
+        delete[] _candidates;
+    }
+
+    void build(const ENTRY_PAGE *head, const ENTRY_PAGE *tail) {
+        uint32_t entries = 0;
+        for (auto page = head; page < tail; page++)
+            entries += page->readTail() - page->readHead();
+        uint32_t size = 8;
+        while (size < entries * 2)
+            size *= 2;
+        _mask = size - 1;
+        _slots = new Slot[size];
+        _candidates = new Candidate[entries];
+        Collector collector{nullptr, nullptr, _candidates, 0, entries};
+        for (auto page = head; page < tail; page++) {
+            const auto *end = page->readTail();
+            for (auto *entry = page->readHead(); entry < end; entry++) {
+                collector.name_P = entry->name_P();
+                auto &slot = probe(collector.name_P);
+                if (slot.name_P)
+                    continue;
+                slot.name_P = collector.name_P;
+                slot.begin = collector.size;
+                for (collector.page = head; collector.page < tail; collector.page++)
+                    collector.page->binarySearch(collector, compare, collect);
+                slot.end = collector.size;
+            }
+        }
+    }
+
+    /** Returns a slot of |name|, or nullptr if no entry has |name|. */
+    const Slot *find(const char *name) const {
+        const auto &slot = probe(name);
+        return slot.name_P ? &slot : nullptr;
+    }
+
+    const Candidate *begin(const Slot *slot) const { return _candidates + slot->begin; }
+    const Candidate *end(const Slot *slot) const { return _candidates + slot->end; }
+
+private:
+    uint32_t _mask;
+    Slot *_slots;
+    Candidate *_candidates;
+
+    struct Collector {
+        const /* PROGMEM */ char *name_P;
+        const ENTRY_PAGE *page;
+        Candidate *candidates;
+        uint32_t size;
+        uint32_t capacity;
+    };
+
+    static int compare(Collector &collector, const ENTRY *entry_P) {
+        return strcasecmp_P(collector.name_P, entry_P->name_P());
+    }
+
+    static bool collect(Collector &collector, const ENTRY *entry_P) {
+        if (collector.size < collector.capacity)
+            collector.candidates[collector.size++] = Candidate{collector.page, entry_P};
+        return false;
+    }
+
+    static uint32_t hash(const /* PROGMEM */ char *name_P) {
+        uint32_t h = 2166136261U;  // FNV-1a
+        for (;;) {
+            const auto c = pgm_read_byte(name_P++);
+            if (c == 0)
+                return h;
+            h = (h ^ toupper(static_cast<unsigned char>(c))) * 16777619U;
+        }
+    }
+
+    Slot &probe(const char *name) const {
+        for (auto i = hash(name);; i++) {
+            auto &slot = _slots[i & _mask];
+            if (slot.name_P == nullptr || strcasecmp_P(name, slot.name_P) == 0)
+                return slot;
+        }
+    }
+};
+
+/**
+ * Mnemonic hash indexes of all CPUs in a CPU table, which are built at once.
+ */
+template <typename CPU_T, typename ENTRY_PAGE, typename ENTRY>
+struct NameIndexes {
+    using Index = NameIndex<ENTRY_PAGE, ENTRY>;
+
+    NameIndexes(const CPU_T *head, const CPU_T *tail)
+        : _head(head), _indexes(new Index[tail - head]) {
+        for (auto cpu = head; cpu < tail; cpu++)
+            _indexes[cpu - head].build(cpu->pagesBegin(), cpu->pagesEnd());
+    }
+    ~NameIndexes() { delete[] _indexes; }
+
+    const Index &operator[](const CPU_T *cpu) const { return _indexes[cpu - _head]; }
+
+private:
+    const CPU_T *const _head;
+    Index *const _indexes;
+};
+
+#endif
+
 /**
  * Base for CPU entry.
  */
@@ -168,6 +395,7 @@ struct CpuBase {
     const ENTRY *searchName(INSN &insn, bool (*acceptOperands)(INSN &, const ENTRY *),
             void (*pageSetup)(INSN &, const ENTRY_PAGE *) = defaultPageSetup,
             void (*readCode)(INSN &, const ENTRY *, const ENTRY_PAGE *) = defaultReadCode) const {
+        stats::count(stats::SEARCH_NAME);
         insn.setOK();
         auto found = false;
         const auto *tail = _pages.readTail();
@@ -185,6 +413,41 @@ struct CpuBase {
         return nullptr;
     }
 
+#if !defined(LIBASM_ASM_NOINDEX)
+    /**
+     * Same as above |searchName| but only tries candidate entries of |index| which have
+     * |insn.name()|. |pageSetup| is called before trying candidates of each page.
+     */
+    template <typename INSN, typename ENTRY>
+    const ENTRY *searchName(INSN &insn, const NameIndex<ENTRY_PAGE, ENTRY> &index,
+            bool (*acceptOperands)(INSN &, const ENTRY *),
+            void (*pageSetup)(INSN &, const ENTRY_PAGE *) = defaultPageSetup,
+            void (*readCode)(INSN &, const ENTRY *, const ENTRY_PAGE *) = defaultReadCode) const {
+        stats::count(stats::SEARCH_NAME);
+        insn.setOK();
+        const auto *slot = index.find(insn.name());
+        if (slot == nullptr) {
+            insn.setErrorIf(UNKNOWN_INSTRUCTION);
+            return nullptr;
+        }
+        const ENTRY_PAGE *page = nullptr;
+        const auto *end = index.end(slot);
+        for (auto it = index.begin(slot); it < end; it++) {
+            if (it->page != page) {
+                page = it->page;
+                pageSetup(insn, page);
+            }
+            stats::count(stats::NAME_ENTRIES);
+            if (acceptOperands(insn, it->entry)) {
+                readCode(insn, it->entry, page);
+                return it->entry;
+            }
+        }
+        insn.setErrorIf(OPERAND_NOT_ALLOWED);
+        return nullptr;
+    }
+#endif
+
     template <typename INSN, typename ENTRY>
     static void defaultReadName(
             INSN &insn, const ENTRY *entry_P, StrBuffer &out, const ENTRY_PAGE * = nullptr) {
@@ -217,7 +480,8 @@ struct CpuBase {
 
     /**
      * Lookup instruction |_pages| table to find an entry which satisfis |matchCode|, then call
-     * |readName| to read the table entry into |insn|. Also updates |insn| error code if any.
+     * |readName| to read the table entry into |insn|. Also sets the control flow of the entry and
+     * updates |insn| error code if any.
      */
     template <typename INSN, typename ENTRY>
     const ENTRY *searchOpCode(INSN &insn, StrBuffer &out,
@@ -225,12 +489,16 @@ struct CpuBase {
             bool (*pageMatcher)(INSN &, const ENTRY_PAGE *) = defaultPageMatcher,
             void (*readName)(INSN &, const ENTRY *, StrBuffer &,
                     const ENTRY_PAGE *) = defaultReadName) const {
+        stats::count(stats::SEARCH_OPCODE);
         insn.setOK();
         const auto *tail = _pages.readTail();
         for (const ENTRY_PAGE *page = _pages.readHead(); page < tail; page++) {
             if (pageMatcher(insn, page)) {
                 const auto *entry = page->linearSearch(insn, matchCode, page);
+                stats::count(stats::OPCODE_ENTRIES,
+                        (entry ? entry + 1 : page->readTail()) - page->readHead());
                 if (entry) {
+                    insn.setFlow(entry->readFlow());
                     readName(insn, entry, out, page);
                     return entry;
                 }
@@ -240,6 +508,41 @@ struct CpuBase {
         return nullptr;
     }
 
+#if !defined(LIBASM_DIS_NOINDEX)
+    /**
+     * Same as above |searchOpCode| but only tries entries in the bucket of |index| which may
+     * match |insn.opCode()|.
+     */
+    template <typename INSN, typename ENTRY>
+    const ENTRY *searchOpCode(INSN &insn, StrBuffer &out,
+            const OpCodeIndex<ENTRY_PAGE, ENTRY> &index,
+            bool (*matchCode)(INSN &, const ENTRY *, const ENTRY_PAGE *) = defaultMatchOpCode,
+            bool (*pageMatcher)(INSN &, const ENTRY_PAGE *) = defaultPageMatcher,
+            void (*readName)(INSN &, const ENTRY *, StrBuffer &,
+                    const ENTRY_PAGE *) = defaultReadName) const {
+        stats::count(stats::SEARCH_OPCODE);
+        insn.setOK();
+        const auto key = index.key(insn.opCode());
+        const auto *tail = _pages.readTail();
+        for (const ENTRY_PAGE *page = _pages.readHead(); page < tail; page++) {
+            if (pageMatcher(insn, page)) {
+                const auto *end = index.end(page, key);
+                for (auto it = index.begin(page, key); it < end; it++) {
+                    const auto *entry = *it;
+                    stats::count(stats::OPCODE_ENTRIES);
+                    if (matchCode(insn, entry, page)) {
+                        insn.setFlow(entry->readFlow());
+                        readName(insn, entry, out, page);
+                        return entry;
+                    }
+                }
+            }
+        }
+        insn.setErrorIf(UNKNOWN_INSTRUCTION);
+        return nullptr;
+    }
+#endif
+
 protected:
     const table::Table<ENTRY_PAGE> _pages;
     CPUTYPE _cpuType_P;
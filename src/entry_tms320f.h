@@ -182,8 +182,8 @@ struct Entry final : private entry::Base<uint16_t> {
         static constexpr uint_fast8_t lf_gm = 0x03;
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const /* PROGMEM */ char *name_P)
-        : Base(name_P, opCode), _flags_P(flags) {}
+    constexpr Entry(Config::opcode_t opCode, Flags flags, entry::Name name)
+        : Base(name, opCode), _flags_P(flags) {}
 
     Flags readFlags() const {
         return Flags{pgm_read_word(&_flags_P._modes), pgm_read_word(&_flags_P._pos),
@@ -191,6 +191,7 @@ struct Entry final : private entry::Base<uint16_t> {
     }
 
     const /* PROGMEM */ char *name_P() const { return Base::name_P(); }
+    ControlFlow readFlow() const { return Base::readFlow(); }
 
     Config::opcode_t readOpCode() const {
         Config::opcode_t opc = Base::readOpCode();
@@ -21,7 +21,12 @@
 namespace libasm {
 
 Insn::Insn(uint32_t addr)
-    : ErrorAt(), _address(addr), _length(0), _continueOffset(0), _continueMark_P(nullptr) {
+    : ErrorAt(),
+      _address(addr),
+      _length(0),
+      _continueOffset(0),
+      _flow(FLOW_NEXT),
+      _continueMark_P(nullptr) {
     memset(_bytes, 0, sizeof(_bytes));
 }
 
@@ -33,6 +38,7 @@ void Insn::reset(uint32_t addr, uint8_t length) {
         length = sizeof(_bytes);
     _length = length;
     _continueOffset = 0;
+    _flow = FLOW_NEXT;
     memset(_bytes + length, 0, sizeof(_bytes) - length);
     _buffer.reset();
 }
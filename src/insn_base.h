@@ -28,6 +28,16 @@
 
 namespace libasm {
 
+/**
+ * Control flow of a decoded instruction.
+ */
+enum ControlFlow : uint8_t {
+    FLOW_NEXT = 0,    // Continues to the next instruction
+    FLOW_BRANCH = 1,  // Transfers to its target address or continues, such as a call
+    FLOW_JUMP = 2,    // Transfers to its target address and never continues
+    FLOW_END = 3,     // Never continues and has no target address, such as a return
+};
+
 /**
  * General instruction code interface for Assembler and Disassembler.
  */
@@ -50,6 +60,9 @@ struct Insn final : ErrorAt {
     // re-displays the same bytes/address (e.g. a TMS320 parallel pair).
     uint8_t continueOffset() const { return _continueOffset; }
     void setContinueOffset(uint8_t offset) { _continueOffset = offset; }
+    /** Control flow of a decoded instruction (Disassembler). */
+    ControlFlow flow() const { return _flow; }
+    void setFlow(ControlFlow flow) { _flow = flow; }
 
     /** No copy constructor. */
     Insn(Insn const &) = delete;
@@ -185,6 +198,7 @@ private:
     uint32_t _address;
     uint8_t _length;
     uint8_t _continueOffset;
+    ControlFlow _flow;
     const /*PROGMEM*/ char *_continueMark_P;
 
     char _name[MAX_NAME + 1];
@@ -314,6 +328,18 @@ struct DisInsnBase : ErrorAt {
     StrBuffer &nameBuffer() { return _insn.nameBuffer(); }
     Insn &insnBase() { return _insn; }
     void appendName(StrBuffer &out, char c);
+    ControlFlow flow() const { return _insn.flow(); }
+    void setFlow(ControlFlow flow) { _insn.setFlow(flow); }
+    /** Make the target of a transfer unknown, such as an indirect jump. */
+    void setIndirect() {
+        const auto flow = _insn.flow();
+        _insn.setFlow(flow == FLOW_JUMP ? FLOW_END : (flow == FLOW_BRANCH ? FLOW_NEXT : flow));
+    }
+    /** Make a jump or a return conditional, so that it may continue. */
+    void setConditional() {
+        const auto flow = _insn.flow();
+        _insn.setFlow(flow == FLOW_JUMP ? FLOW_BRANCH : (flow == FLOW_END ? FLOW_NEXT : flow));
+    }
 
     void resetLength(uint8_t length = 0);
 
@@ -53,6 +53,13 @@ protected:
     static Error parseTextOption(StrScanner &scan, StrScanner &value);
 
 private:
+    /**
+     * An option points to its owner and the next option which are members of the same object,
+     * so that a copy of the object must construct its own options.
+     */
+    OptionBase(const OptionBase &) = delete;
+    OptionBase &operator=(const OptionBase &) = delete;
+
     const /*PROGMEM*/ char *const _name_P;
     const /*PROGMEM*/ char *const _desc_P;
     const OptionSpec _spec;
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2026 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LIBASM_STATS_H__
+#define __LIBASM_STATS_H__
+
+#include "config_host.h"
+
+#if defined(LIBASM_STATS)
+#include <atomic>
+#include <chrono>
+#endif
+
+namespace libasm {
+namespace stats {
+
+/**
+ * Instrumentation counters of hot paths and elapsed times of assembler phases. Counting is
+ * compiled in only when LIBASM_STATS is defined, otherwise |count| is an empty inline function
+ * and |Timer| an empty object, and they cost nothing.
+ */
+enum Counter : uint8_t {
+    SEARCH_NAME = 0,     // Calls of CpuBase::searchName
+    NAME_ENTRIES = 1,    // Entries tested by CpuBase::searchName
+    SEARCH_OPCODE = 2,   // Calls of CpuBase::searchOpCode
+    OPCODE_ENTRIES = 3,  // Entries tested by CpuBase::searchOpCode
+    VALUE_EVAL = 4,      // Calls of ValueParser::eval
+    SYMBOL_LOOKUP = 5,   // Calls of SymbolStore::lookupSymbol
+    FUNCTION_EVAL = 6,   // Calls of FunctionStore::Function::eval
+    BYTES_WRITTEN = 7,   // Bytes written to BinMemory
+    READ_NANOS = 8,      // Nanoseconds to read source lines
+    ENCODE_NANOS = 9,    // Nanoseconds to parse and encode lines by AsmDirective::encode
+    LIST_NANOS = 10,     // Nanoseconds to format listing and error lines
+    FIXUP_NANOS = 11,    // Nanoseconds to resolve fixups by AsmDriver::resolveFixups
+    OUTPUT_NANOS = 12,   // Nanoseconds to write listing and object files
+    COUNTERS = 13,
+};
+
+#if defined(LIBASM_STATS)
+
+constexpr bool ENABLED = true;
+
+/**
+ * Counters shared by all translation units. Disassembler workers of "dis -j" count
+ * concurrently, so that the counters are atomic. Only the totals are read, so that relaxed
+ * ordering is enough.
+ */
+inline std::atomic<uint64_t> *counters() {
+    static std::atomic<uint64_t> COUNTS[COUNTERS];
+    return COUNTS;
+}
+
+inline void count(Counter counter, uint64_t n = 1) {
+    counters()[counter].fetch_add(n, std::memory_order_relaxed);
+}
+
+inline uint64_t value(Counter counter) {
+    return counters()[counter].load(std::memory_order_relaxed);
+}
+
+inline void reset() {
+    for (auto i = 0; i < COUNTERS; i++)
+        counters()[i].store(0, std::memory_order_relaxed);
+}
+
+/** Add the lifetime of this object in nanoseconds to |counter|. */
+struct Timer {
+    Timer(Counter counter) : _counter(counter), _start(std::chrono::steady_clock::now()) {}
+    ~Timer() {
+        const auto elapsed = std::chrono::steady_clock::now() - _start;
+        count(_counter,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+private:
+    const Counter _counter;
+    const std::chrono::steady_clock::time_point _start;
+};
+
+#else
+
+constexpr bool ENABLED = false;
+
+inline void count(Counter, uint64_t = 1) {}
+inline uint64_t value(Counter) {
+    return 0;
+}
+inline void reset() {}
+
+struct Timer {
+    Timer(Counter) {}
+};
+
+#endif
+
+}  // namespace stats
+}  // namespace libasm
+
+#endif  // __LIBASM_STATS_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -27,6 +27,8 @@ struct Value;
 
 struct SymbolTable {
     virtual const char *lookupValue(const Value &) const { return nullptr; }
+    /** Lookup a value which a disassembler decodes as an address. */
+    virtual const char *lookupAddress(const Value &value) const { return lookupValue(value); }
     virtual bool hasSymbol(const StrScanner &symbol) const = 0;
     virtual const Value *lookupSymbol(const StrScanner &symbol) const = 0;
     virtual const Functor *lookupFunction(const StrScanner &symbol) const = 0;
@@ -19,6 +19,7 @@
 
 #include "config_host.h"
 #include "error_reporter.h"
+#include "stats.h"
 
 namespace libasm {
 namespace table {
@@ -162,6 +163,8 @@ struct IndexedTable {
             // |head| may point an item which doesn't satisfies |comparator|
             if (comparator(data, item) != 0)
                 break;
+            // Only instruction tables are searched by |matcher2|.
+            stats::count(stats::NAME_ENTRIES);
             if (matcher2(data, item)) {
                 found = item;
                 break;
@@ -33,34 +33,34 @@ constexpr Entry TABLE_CDP1802[] PROGMEM = {
     E1(0x00, CF_0F, TEXT_LDN,  M_REG1),
     E1(0x10, CF_0F, TEXT_INC,  M_REGN),
     E1(0x20, CF_0F, TEXT_DEC,  M_REGN),
-    E1(0x30, CF_00, TEXT_BR,   M_SHRT),
-    E1(0x31, CF_00, TEXT_BQ,   M_SHRT),
-    E1(0x32, CF_00, TEXT_BZ,   M_SHRT),
-    E1(0x33, CF_00, TEXT_BDF,  M_SHRT),
-    E1(0x33, CF_00, TEXT_BPZ,  M_SHRT),
-    E1(0x33, CF_00, TEXT_BGE,  M_SHRT),
-    E1(0x34, CF_00, TEXT_B1,   M_PAGE),
-    E1(0x35, CF_00, TEXT_B2,   M_PAGE),
-    E1(0x36, CF_00, TEXT_B3,   M_PAGE),
-    E1(0x37, CF_00, TEXT_B4,   M_PAGE),
+    E1(0x30, CF_00, flowJump(TEXT_BR),    M_SHRT),
+    E1(0x31, CF_00, flowBranch(TEXT_BQ),  M_SHRT),
+    E1(0x32, CF_00, flowBranch(TEXT_BZ),  M_SHRT),
+    E1(0x33, CF_00, flowBranch(TEXT_BDF), M_SHRT),
+    E1(0x33, CF_00, flowBranch(TEXT_BPZ), M_SHRT),
+    E1(0x33, CF_00, flowBranch(TEXT_BGE), M_SHRT),
+    E1(0x34, CF_00, flowBranch(TEXT_B1),  M_PAGE),
+    E1(0x35, CF_00, flowBranch(TEXT_B2),  M_PAGE),
+    E1(0x36, CF_00, flowBranch(TEXT_B3),  M_PAGE),
+    E1(0x37, CF_00, flowBranch(TEXT_B4),  M_PAGE),
     E0(0x38, CF_00, TEXT_SKP),
     E1(0x38, CF_00, TEXT_NBR,  M_PAGE),
-    E1(0x39, CF_00, TEXT_BNQ,  M_SHRT),
-    E1(0x3A, CF_00, TEXT_BNZ,  M_SHRT),
-    E1(0x3B, CF_00, TEXT_BNF,  M_SHRT),
-    E1(0x3B, CF_00, TEXT_BM,   M_SHRT),
-    E1(0x3B, CF_00, TEXT_BL,   M_SHRT),
-    E1(0x3C, CF_00, TEXT_BN1,  M_PAGE),
-    E1(0x3D, CF_00, TEXT_BN2,  M_PAGE),
-    E1(0x3E, CF_00, TEXT_BN3,  M_PAGE),
-    E1(0x3F, CF_00, TEXT_BN4,  M_PAGE),
+    E1(0x39, CF_00, flowBranch(TEXT_BNQ), M_SHRT),
+    E1(0x3A, CF_00, flowBranch(TEXT_BNZ), M_SHRT),
+    E1(0x3B, CF_00, flowBranch(TEXT_BNF), M_SHRT),
+    E1(0x3B, CF_00, flowBranch(TEXT_BM),  M_SHRT),
+    E1(0x3B, CF_00, flowBranch(TEXT_BL),  M_SHRT),
+    E1(0x3C, CF_00, flowBranch(TEXT_BN1), M_PAGE),
+    E1(0x3D, CF_00, flowBranch(TEXT_BN2), M_PAGE),
+    E1(0x3E, CF_00, flowBranch(TEXT_BN3), M_PAGE),
+    E1(0x3F, CF_00, flowBranch(TEXT_BN4), M_PAGE),
     E1(0x40, CF_0F, TEXT_LDA,  M_REGN),
     E1(0x50, CF_0F, TEXT_STR,  M_REGN),
     E0(0x60, CF_00, TEXT_IRX),
     E1(0x60, CF_07, TEXT_OUT,  M_IOAD),
     E1(0x68, CF_07, TEXT_INP,  M_IOAD),
-    E0(0x70, CF_00, TEXT_RET),
-    E0(0x71, CF_00, TEXT_DIS),
+    E0(0x70, CF_00, flowEnd(TEXT_RET)),
+    E0(0x71, CF_00, flowEnd(TEXT_DIS)),
     E0(0x72, CF_00, TEXT_LDXA),
     E0(0x73, CF_00, TEXT_STXD),
     E0(0x74, CF_00, TEXT_ADC),
@@ -81,23 +81,23 @@ constexpr Entry TABLE_CDP1802[] PROGMEM = {
     E1(0x90, CF_0F, TEXT_GHI,  M_REGN),
     E1(0xA0, CF_0F, TEXT_PLO,  M_REGN),
     E1(0xB0, CF_0F, TEXT_PHI,  M_REGN),
-    E1(0xC0, CF_00, TEXT_LBR,  M_LONG),
-    E1(0xC1, CF_00, TEXT_LBQ,  M_LONG),
-    E1(0xC2, CF_00, TEXT_LBZ,  M_LONG),
-    E1(0xC3, CF_00, TEXT_LBDF, M_LONG),
-    E1(0xC3, CF_00, TEXT_LBPZ, M_LONG),
-    E1(0xC3, CF_00, TEXT_LBGE, M_LONG),
+    E1(0xC0, CF_00, flowJump(TEXT_LBR),    M_LONG),
+    E1(0xC1, CF_00, flowBranch(TEXT_LBQ),  M_LONG),
+    E1(0xC2, CF_00, flowBranch(TEXT_LBZ),  M_LONG),
+    E1(0xC3, CF_00, flowBranch(TEXT_LBDF), M_LONG),
+    E1(0xC3, CF_00, flowBranch(TEXT_LBPZ), M_LONG),
+    E1(0xC3, CF_00, flowBranch(TEXT_LBGE), M_LONG),
     E0(0xC4, CF_00, TEXT_NOP),
     E0(0xC5, CF_00, TEXT_LSNQ),
     E0(0xC6, CF_00, TEXT_LSNZ),
     E0(0xC7, CF_00, TEXT_LSNF),
     E0(0xC8, CF_00, TEXT_LSKP),
     E1(0xC8, CF_00, TEXT_NLBR, M_ADDR),
-    E1(0xC9, CF_00, TEXT_LBNQ, M_LONG),
-    E1(0xCA, CF_00, TEXT_LBNZ, M_LONG),
-    E1(0xCB, CF_00, TEXT_LBNF, M_LONG),
-    E1(0xCB, CF_00, TEXT_LBM,  M_LONG),
-    E1(0xCB, CF_00, TEXT_LBL,  M_LONG),
+    E1(0xC9, CF_00, flowBranch(TEXT_LBNQ), M_LONG),
+    E1(0xCA, CF_00, flowBranch(TEXT_LBNZ), M_LONG),
+    E1(0xCB, CF_00, flowBranch(TEXT_LBNF), M_LONG),
+    E1(0xCB, CF_00, flowBranch(TEXT_LBM),  M_LONG),
+    E1(0xCB, CF_00, flowBranch(TEXT_LBL),  M_LONG),
     E0(0xCC, CF_00, TEXT_LSIE),
     E0(0xCD, CF_00, TEXT_LSQ),
     E0(0xCE, CF_00, TEXT_LSZ),
@@ -231,11 +231,11 @@ constexpr Entry TABLE_CDP1804[] PROGMEM = {
     E0(0x0B, CF_00, TEXT_XID),
     E0(0x0C, CF_00, TEXT_CIE),
     E0(0x0D, CF_00, TEXT_CID),
-    E1(0x3E, CF_00, TEXT_BCI,  M_PAGE),
-    E1(0x3F, CF_00, TEXT_BXI,  M_PAGE),
+    E1(0x3E, CF_00, flowBranch(TEXT_BCI), M_PAGE),
+    E1(0x3F, CF_00, flowBranch(TEXT_BXI), M_PAGE),
     E1(0x60, CF_0F, TEXT_RLXA, M_REGN),
-    E1(0x80, CF_0F, TEXT_SCAL, M_REGN_ADDR),
-    E1(0x90, CF_0F, TEXT_SRET, M_REGN),
+    E1(0x80, CF_0F, flowBranch(TEXT_SCAL), M_REGN_ADDR),
+    E1(0x90, CF_0F, flowEnd(TEXT_SRET),    M_REGN),
     E1(0xA0, CF_0F, TEXT_RSXD, M_REGN),
     E1(0xB0, CF_0F, TEXT_RNX,  M_REGN),
     E1(0xC0, CF_0F, TEXT_RLDI, M_REGN_ADDR),
@@ -267,7 +267,7 @@ constexpr uint8_t INDEX_CDP1804[] PROGMEM = {
 };
 
 constexpr Entry TABLE_CDP1804A[] PROGMEM = {
-    E1(0x20, CF_0F, TEXT_DBNZ, M_REGN_ADDR),
+    E1(0x20, CF_0F, flowBranch(TEXT_DBNZ), M_REGN_ADDR),
     E0(0x74, CF_00, TEXT_DADC),
     E0(0x76, CF_00, TEXT_DSAV),
     E0(0x77, CF_00, TEXT_DSMB),
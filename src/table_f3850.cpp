@@ -59,7 +59,7 @@ constexpr Entry TABLE_3850[] PROGMEM = {
     E0(0x19, CF_00, TEXT_LNK),
     E0(0x1A, CF_00, TEXT_DI),
     E0(0x1B, CF_00, TEXT_EI),
-    E0(0x1C, CF_00, TEXT_POP),
+    E0(0x1C, CF_00, flowEnd(TEXT_POP)),
     E2(0x1D, CF_00, TEXT_LR,  M_W,   M_J),
     E2(0x1E, CF_00, TEXT_LR,  M_J,   M_W),
     E0(0x1F, CF_00, TEXT_INC),
@@ -71,8 +71,8 @@ constexpr Entry TABLE_3850[] PROGMEM = {
     E1(0x25, CF_00, TEXT_CI,  M_IM8),
     E1(0x26, CF_00, TEXT_IN,  M_IOA),
     E1(0x27, CF_00, TEXT_OUT, M_IOA),
-    E1(0x28, CF_00, TEXT_PI,  M_ADDR),
-    E1(0x29, CF_00, TEXT_JMP, M_ADDR),
+    E1(0x28, CF_00, flowBranch(TEXT_PI), M_ADDR),
+    E1(0x29, CF_00, flowJump(TEXT_JMP),  M_ADDR),
     E1(0x2A, CF_00, TEXT_DCI, M_ADDR),
     E0(0x2B, CF_00, TEXT_NOP),
     E0(0x2C, CF_00, TEXT_XDC),
@@ -83,9 +83,9 @@ constexpr Entry TABLE_3850[] PROGMEM = {
     E1(0x68, CF_07, TEXT_LISL, M_IM3),
     E0(0x70, CF_00, TEXT_CLR),
     E1(0x70, CF_0F, TEXT_LIS,  M_IM4),
-    E1(0x81, CF_00, TEXT_BP,   M_REL),
-    E1(0x82, CF_00, TEXT_BC,   M_REL),
-    E1(0x84, CF_00, TEXT_BZ,   M_REL),
+    E1(0x81, CF_00, flowBranch(TEXT_BP), M_REL),
+    E1(0x82, CF_00, flowBranch(TEXT_BC), M_REL),
+    E1(0x84, CF_00, flowBranch(TEXT_BZ), M_REL),
     E0(0x88, CF_00, TEXT_AM),
     E0(0x89, CF_00, TEXT_AMD),
     E0(0x8A, CF_00, TEXT_NM),
@@ -93,14 +93,14 @@ constexpr Entry TABLE_3850[] PROGMEM = {
     E0(0x8C, CF_00, TEXT_XM),
     E0(0x8D, CF_00, TEXT_CM),
     E0(0x8E, CF_00, TEXT_ADC),
-    E1(0x8F, CF_00, TEXT_BR7,  M_REL),
-    E2(0x80, CF_07, TEXT_BT,   M_IM3,  M_REL),
-    E1(0x90, CF_00, TEXT_BR,   M_REL),
-    E1(0x91, CF_00, TEXT_BM,   M_REL),
-    E1(0x92, CF_00, TEXT_BNC,  M_REL),
-    E1(0x94, CF_00, TEXT_BNZ,  M_REL),
-    E1(0x98, CF_00, TEXT_BNO,  M_REL),
-    E2(0x90, CF_0F, TEXT_BF,   M_IM4,  M_REL),
+    E1(0x8F, CF_00, flowBranch(TEXT_BR7), M_REL),
+    E2(0x80, CF_07, flowBranch(TEXT_BT),  M_IM3,  M_REL),
+    E1(0x90, CF_00, flowJump(TEXT_BR),    M_REL),
+    E1(0x91, CF_00, flowBranch(TEXT_BM),  M_REL),
+    E1(0x92, CF_00, flowBranch(TEXT_BNC), M_REL),
+    E1(0x94, CF_00, flowBranch(TEXT_BNZ), M_REL),
+    E1(0x98, CF_00, flowBranch(TEXT_BNO), M_REL),
+    E2(0x90, CF_0F, flowBranch(TEXT_BF),  M_IM4,  M_REL),
     E1(0xA0, CF_0F, TEXT_INS,  M_IOS),
     E1(0xB0, CF_0F, TEXT_OUTS, M_IOS),
     E1(0xC0, CF_0F, TEXT_AS,   M_REG),
@@ -78,20 +78,20 @@ constexpr Entry TABLE_MAIN[] PROGMEM = {
     E2(0x88, TEXT_OR,     IC_N,  ISZ_DATA,  M_EASRC, M_EADST),  // OR
     E1(0x8C, TEXT_NEG,    IC_N,  ISZ_DATA,  M_EADST),           // NEG
     E1(0x90, TEXT_NOT,    IC_N,  ISZ_DATA,  M_EADST),           // NOT
-    E1(0x98, TEXT_BRA,    IC_N,  ISZ_DATA,  M_DISP),            // BRA    disp .B/.W/.L
-    E1(0x9B, TEXT_JMP,    IC_N,  ISZ_NONE,  M_EAMEM),          // JMP    via EA (no Rn/imm)
+    E1(0x98, flowJump(TEXT_BRA), IC_N,  ISZ_DATA,  M_DISP),     // BRA    disp .B/.W/.L
+    E1(0x9B, flowJump(TEXT_JMP), IC_N,  ISZ_NONE,  M_EAMEM),   // JMP    via EA (no Rn/imm)
     E1(0x9C, TEXT_NEGX,   IC_N,  ISZ_DATA,  M_EADST),           // NEGX   negate with CX
-    E1(0xA0, TEXT_BEQ,    IC_N,  ISZ_DATA,  M_DISP),            // BEQ    (short)
-    E1(0xA8, TEXT_BSR,    IC_N,  ISZ_DATA,  M_DISP),            // BSR
-    E1(0xAB, TEXT_JSR,    IC_N,  ISZ_NONE,  M_EAMEM),          // JSR    via EA (no Rn/imm)
+    E1(0xA0, flowBranch(TEXT_BEQ), IC_N,  ISZ_DATA,  M_DISP),   // BEQ    (short)
+    E1(0xA8, flowBranch(TEXT_BSR), IC_N,  ISZ_DATA,  M_DISP),   // BSR
+    E1(0xAB, flowBranch(TEXT_JSR), IC_N,  ISZ_NONE,  M_EAMEM),  // JSR    via EA (no Rn/imm)
     E1(0xAC, TEXT_EXTU,   IC_N,  ISZ_EXTU,  M_RNNO),            // EXTU   Sz: 0=W,1=L,2=B
     F1(0xAF, TEXT_DNEG,   IC_N,  SZ_BYTE,   M_EADST),           // DNEG   decimal neg (byte)
-    E1(0xB0, TEXT_BNE,    IC_N,  ISZ_DATA,  M_DISP),            // BNE    (short)
+    E1(0xB0, flowBranch(TEXT_BNE), IC_N,  ISZ_DATA,  M_DISP),   // BNE    (short)
     F1(0xB3, TEXT_XCH,    IC_N,  SZ_LONG,   M_RR),              // XCH    exchange regs (long)
-    E2(0xB4, TEXT_SCB,    IC_N,  ISZ_DATA,  M_RCC,   M_DISP),   // SCB/cc Rn, disp (.B/.W/.L disp)
+    E2(0xB4, flowBranch(TEXT_SCB), IC_N,  ISZ_DATA,  M_RCC,   M_DISP),  // SCB/cc Rn, disp (.B/.W/.L disp)
     F1(0xB7, TEXT_SET,    IC_CC, SZ_BYTE,   M_EADST),           // SET/cc <EAd> (byte)
-    E1(0xB8, TEXT_RTD,    IC_N,  ISZ_DATA,  M_FRMSZ),           // RTD    deallocate (.B/.W/.L)
-    E0(0xBB, TEXT_RTS),                                         // RTS
+    E1(0xB8, flowEnd(TEXT_RTD), IC_N,  ISZ_DATA,  M_FRMSZ),     // RTD    deallocate (.B/.W/.L)
+    E0(0xBB, flowEnd(TEXT_RTS)),                                         // RTS
     E1(0xBC, TEXT_EXTS,   IC_N,  ISZ_EXTU,  M_RNNO),            // EXTS   Sz: 0=W,1=L,2=B
     F2(0xBF, TEXT_MOVA,   IC_N,  SZ_LONG,   M_EASRC, M_EADST),  // MOVA   move EA to R0 (long)
     E2(0xD0, TEXT_LINK,   IC_N,  ISZ_DATA,  M_RNNO,  M_FRMSZ),  // LINK   Rn,#frame (.B/.W/.L)
@@ -116,10 +116,10 @@ constexpr Entry TABLE_MAIN[] PROGMEM = {
     E1(0xEA, TEXT_SWAP,   IC_N,  ISZ_OBIT0, M_EADST),           // SWAP   swap halves (.B/.W, bit0)
     F1(0xEC, TEXT_TAS,    IC_N,  SZ_BYTE,   M_EADST),           // TAS    test and set (byte)
     E0(0xF0, TEXT_RESET),                                       // RESET
-    E0(0xF1, TEXT_RTE),                                         // RTE
+    E0(0xF1, flowEnd(TEXT_RTE)),                                         // RTE
     E1(0xF2, TEXT_TRAPA,  IC_N,  ISZ_NONE,  M_TRAPV),           // TRAPA  #imm4
     E2(0xF3, TEXT_TRAP,   IC_CC, ISZ_NONE,  M_NONE,  M_NONE),   // TRAP/cc (cc byte)
-    E0(0xF4, TEXT_RTR),                                         // RTR
+    E0(0xF4, flowEnd(TEXT_RTR)),                                         // RTR
     E0(0xF5, TEXT_SLEEP),                                       // SLEEP
     E2(0xF8, TEXT_ANDC,   IC_N,  ISZ_NONE,  M_EASRC, M_CR),     // ANDC   EA,CR
     E2(0xF9, TEXT_ORC,    IC_N,  ISZ_NONE,  M_EASRC, M_CR),     // ORC
@@ -190,22 +190,22 @@ constexpr Entry TABLE_DIV[] PROGMEM = {
 // Bcc:G.  Prefix 0xA4/0xA5/0xA6.  Opcode [*4|cc(4)]: low 4 bits select the
 // condition.  All class IC_G; the disassembler reconstructs the ":G" suffix.
 constexpr Entry TABLE_BCC_G[] PROGMEM = {
-    E1(0x00, TEXT_BT,     IC_G,  ISZ_PRSZ,  M_DISP),            // cc=0 T
-    E1(0x01, TEXT_BF,     IC_G,  ISZ_PRSZ,  M_DISP),            // cc=1 F
-    E1(0x02, TEXT_BHI,    IC_G,  ISZ_PRSZ,  M_DISP),            // cc=2 HI
-    E1(0x03, TEXT_BLS,    IC_G,  ISZ_PRSZ,  M_DISP),            // cc=3 LS
-    E1(0x04, TEXT_BCC,    IC_G,  ISZ_PRSZ,  M_DISP),            // cc=4 CC/HS
-    E1(0x05, TEXT_BCS,    IC_G,  ISZ_PRSZ,  M_DISP),            // cc=5 CS/LO
-    E1(0x06, TEXT_BNE,    IC_G,  ISZ_PRSZ,  M_DISP),            // cc=6 NE
-    E1(0x07, TEXT_BEQ,    IC_G,  ISZ_PRSZ,  M_DISP),            // cc=7 EQ
-    E1(0x08, TEXT_BVC,    IC_G,  ISZ_PRSZ,  M_DISP),            // cc=8 VC
-    E1(0x09, TEXT_BVS,    IC_G,  ISZ_PRSZ,  M_DISP),            // cc=9 VS
-    E1(0x0A, TEXT_BPL,    IC_G,  ISZ_PRSZ,  M_DISP),            // cc=A PL
-    E1(0x0B, TEXT_BMI,    IC_G,  ISZ_PRSZ,  M_DISP),            // cc=B MI
-    E1(0x0C, TEXT_BGE,    IC_G,  ISZ_PRSZ,  M_DISP),            // cc=C GE
-    E1(0x0D, TEXT_BLT,    IC_G,  ISZ_PRSZ,  M_DISP),            // cc=D LT
-    E1(0x0E, TEXT_BGT,    IC_G,  ISZ_PRSZ,  M_DISP),            // cc=E GT
-    E1(0x0F, TEXT_BLE,    IC_G,  ISZ_PRSZ,  M_DISP),            // cc=F LE
+    E1(0x00, flowJump(TEXT_BT),    IC_G,  ISZ_PRSZ,  M_DISP),   // cc=0 T
+    E1(0x01, flowBranch(TEXT_BF),  IC_G,  ISZ_PRSZ,  M_DISP),   // cc=1 F
+    E1(0x02, flowBranch(TEXT_BHI), IC_G,  ISZ_PRSZ,  M_DISP),   // cc=2 HI
+    E1(0x03, flowBranch(TEXT_BLS), IC_G,  ISZ_PRSZ,  M_DISP),   // cc=3 LS
+    E1(0x04, flowBranch(TEXT_BCC), IC_G,  ISZ_PRSZ,  M_DISP),   // cc=4 CC/HS
+    E1(0x05, flowBranch(TEXT_BCS), IC_G,  ISZ_PRSZ,  M_DISP),   // cc=5 CS/LO
+    E1(0x06, flowBranch(TEXT_BNE), IC_G,  ISZ_PRSZ,  M_DISP),   // cc=6 NE
+    E1(0x07, flowBranch(TEXT_BEQ), IC_G,  ISZ_PRSZ,  M_DISP),   // cc=7 EQ
+    E1(0x08, flowBranch(TEXT_BVC), IC_G,  ISZ_PRSZ,  M_DISP),   // cc=8 VC
+    E1(0x09, flowBranch(TEXT_BVS), IC_G,  ISZ_PRSZ,  M_DISP),   // cc=9 VS
+    E1(0x0A, flowBranch(TEXT_BPL), IC_G,  ISZ_PRSZ,  M_DISP),   // cc=A PL
+    E1(0x0B, flowBranch(TEXT_BMI), IC_G,  ISZ_PRSZ,  M_DISP),   // cc=B MI
+    E1(0x0C, flowBranch(TEXT_BGE), IC_G,  ISZ_PRSZ,  M_DISP),   // cc=C GE
+    E1(0x0D, flowBranch(TEXT_BLT), IC_G,  ISZ_PRSZ,  M_DISP),   // cc=D LT
+    E1(0x0E, flowBranch(TEXT_BGT), IC_G,  ISZ_PRSZ,  M_DISP),   // cc=E GT
+    E1(0x0F, flowBranch(TEXT_BLE), IC_G,  ISZ_PRSZ,  M_DISP),   // cc=F LE
     // HS/LO are Table 16-8 aliases for CC/CS; the assembler accepts them, the
     // disassembler emits the canonical CC/CS (matched earlier in table order).
     E1(0x04, TEXT_BHS,    IC_G,  ISZ_PRSZ,  M_DISP),            // cc=4 HS == CC
@@ -95,34 +95,34 @@ constexpr Entry H8300_TABLE[] PROGMEM = {
     E1(0x1280, TEXT_ROTL,  ISZ_NONE, SZ_BYTE, M_REG8,  POS___F), // ROTL  Rd
     E1(0x1300, TEXT_ROTXR, ISZ_NONE, SZ_BYTE, M_REG8,  POS___F), // ROTXR Rd
     E1(0x1380, TEXT_ROTR,  ISZ_NONE, SZ_BYTE, M_REG8,  POS___F), // ROTR  Rd
-    E1(0x4000, TEXT_BRA,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BRA d:8
-    E1(0x4000, TEXT_BT,    ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BT  d:8
+    E1(0x4000, flowJump(TEXT_BRA), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BRA d:8
+    E1(0x4000, flowJump(TEXT_BT),  ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BT  d:8
     E1(0x4100, TEXT_BRN,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BRN d:8
-    E1(0x4100, TEXT_BF,    ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BF  d:8
-    E1(0x4200, TEXT_BHI,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BHI d:8
-    E1(0x4300, TEXT_BLS,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BLS d:8
-    E1(0x4400, TEXT_BCC,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BCC d:8
-    E1(0x4400, TEXT_BHS,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BHS d:8
-    E1(0x4500, TEXT_BCS,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BCS d:8
-    E1(0x4500, TEXT_BLO,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BLO d:8
-    E1(0x4600, TEXT_BNE,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BNE d:8
-    E1(0x4700, TEXT_BEQ,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BEQ d:8
-    E1(0x4800, TEXT_BVC,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BVC d:8
-    E1(0x4900, TEXT_BVS,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BVS d:8
-    E1(0x4A00, TEXT_BPL,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BPL d:8
-    E1(0x4B00, TEXT_BMI,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BMI d:8
-    E1(0x4C00, TEXT_BGE,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BGE d:8
-    E1(0x4D00, TEXT_BLT,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BLT d:8
-    E1(0x4E00, TEXT_BGT,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BGT d:8
-    E1(0x4F00, TEXT_BLE,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BGE d:8
-    E1(0x5500, TEXT_BSR,   ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BSR d:8
-    E0(0x5470, TEXT_RTS),                                // RTS
-    E0(0x5670, TEXT_RTE),                                // RTE
-    E1(0x5900, TEXT_JMP,   ISZ_NONE, SZ_NONE, M_INDIR, POS__7_), // JMP @Rn
-    E1(0x5A00, TEXT_JMP,   ISZ_NONE, SZ_WORD, M_ABS16, POS____), // JMP @aa:16
-    E1(0x5B00, TEXT_JMP,   ISZ_NONE, SZ_NONE, M_MIND8, POS__FF), // JMP @@aa:8
+    E1(0x4100, flowBranch(TEXT_BF),  ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BF  d:8
+    E1(0x4200, flowBranch(TEXT_BHI), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BHI d:8
+    E1(0x4300, flowBranch(TEXT_BLS), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BLS d:8
+    E1(0x4400, flowBranch(TEXT_BCC), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BCC d:8
+    E1(0x4400, flowBranch(TEXT_BHS), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BHS d:8
+    E1(0x4500, flowBranch(TEXT_BCS), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BCS d:8
+    E1(0x4500, flowBranch(TEXT_BLO), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BLO d:8
+    E1(0x4600, flowBranch(TEXT_BNE), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BNE d:8
+    E1(0x4700, flowBranch(TEXT_BEQ), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BEQ d:8
+    E1(0x4800, flowBranch(TEXT_BVC), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BVC d:8
+    E1(0x4900, flowBranch(TEXT_BVS), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BVS d:8
+    E1(0x4A00, flowBranch(TEXT_BPL), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BPL d:8
+    E1(0x4B00, flowBranch(TEXT_BMI), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BMI d:8
+    E1(0x4C00, flowBranch(TEXT_BGE), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BGE d:8
+    E1(0x4D00, flowBranch(TEXT_BLT), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BLT d:8
+    E1(0x4E00, flowBranch(TEXT_BGT), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BGT d:8
+    E1(0x4F00, flowBranch(TEXT_BLE), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BGE d:8
+    E1(0x5500, flowBranch(TEXT_BSR), ISZ_NONE, SZ_BYTE, M_REL8,  POS__FF), // BSR d:8
+    E0(0x5470, flowEnd(TEXT_RTS)),                                // RTS
+    E0(0x5670, flowEnd(TEXT_RTE)),                                // RTE
+    E1(0x5900, flowEnd(TEXT_JMP),    ISZ_NONE, SZ_NONE, M_INDIR, POS__7_), // JMP @Rn
+    E1(0x5A00, flowJump(TEXT_JMP),   ISZ_NONE, SZ_WORD, M_ABS16, POS____), // JMP @aa:16
+    E1(0x5B00, flowEnd(TEXT_JMP),    ISZ_NONE, SZ_NONE, M_MIND8, POS__FF), // JMP @@aa:8
     E1(0x5D00, TEXT_JSR,   ISZ_NONE, SZ_NONE, M_INDIR, POS__7_), // JSR @Rn
-    E1(0x5E00, TEXT_JSR,   ISZ_NONE, SZ_WORD, M_ABS16, POS____), // JSR @aa:16
+    E1(0x5E00, flowBranch(TEXT_JSR), ISZ_NONE, SZ_WORD, M_ABS16, POS____), // JSR @aa:16
     E1(0x5F00, TEXT_JSR,   ISZ_NONE, SZ_NONE, M_MIND8, POS__FF), // JSR @@aa:8
     E2(0x6000, TEXT_BSET,  ISZ_NONE, SZ_BYTE, M_REG8,  M_REG8,  POS__F_, POS___F), // BSET  Rn, Rd
     E2(0x6100, TEXT_BNOT,  ISZ_NONE, SZ_BYTE, M_REG8,  M_REG8,  POS__F_, POS___F), // BNOT  Rn, Rd
@@ -750,27 +750,27 @@ constexpr Entry H8300H_TABLE[] PROGMEM = {
     E2(0x7910, TEXT_ADD,   ISZ_DATA, SZ_WORD, M_IMM16, M_REG16, POS____, POS___F), // ADD.W  #imm16, Rd
     E2(0x7920, TEXT_CMP,   ISZ_DATA, SZ_WORD, M_IMM16, M_REG16, POS____, POS___F), // CMP.W  #imm16, Rd
     E2(0x7930, TEXT_SUB,   ISZ_DATA, SZ_WORD, M_IMM16, M_REG16, POS____, POS___F), // SUB.W  #imm16, Rd
-    E1(0x5800, TEXT_BRA,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BRA :16
-    E1(0x5800, TEXT_BT,    ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BT  :16 (alias)
+    E1(0x5800, flowJump(TEXT_BRA), ISZ_NONE, SZ_WORD, M_REL16, POS____),           // BRA :16
+    E1(0x5800, flowJump(TEXT_BT),  ISZ_NONE, SZ_WORD, M_REL16, POS____),           // BT  :16 (alias)
     E1(0x5810, TEXT_BRN,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BRN :16
-    E1(0x5810, TEXT_BF,    ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BF  :16 (alias)
-    E1(0x5820, TEXT_BHI,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BHI :16
-    E1(0x5830, TEXT_BLS,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BLS :16
-    E1(0x5840, TEXT_BCC,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BCC :16
-    E1(0x5840, TEXT_BHS,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BHS :16 (alias)
-    E1(0x5850, TEXT_BCS,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BCS :16
-    E1(0x5850, TEXT_BLO,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BLO :16 (alias)
-    E1(0x5860, TEXT_BNE,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BNE :16
-    E1(0x5870, TEXT_BEQ,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BEQ :16
-    E1(0x5880, TEXT_BVC,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BVC :16
-    E1(0x5890, TEXT_BVS,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BVS :16
-    E1(0x58A0, TEXT_BPL,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BPL :16
-    E1(0x58B0, TEXT_BMI,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BMI :16
-    E1(0x58C0, TEXT_BGE,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BGE :16
-    E1(0x58D0, TEXT_BLT,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BLT :16
-    E1(0x58E0, TEXT_BGT,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BGT :16
-    E1(0x58F0, TEXT_BLE,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BLE :16
-    E1(0x5C00, TEXT_BSR,   ISZ_NONE, SZ_WORD, M_REL16, POS____),                   // BSR :16
+    E1(0x5810, flowBranch(TEXT_BF),  ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BF  :16 (alias)
+    E1(0x5820, flowBranch(TEXT_BHI), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BHI :16
+    E1(0x5830, flowBranch(TEXT_BLS), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BLS :16
+    E1(0x5840, flowBranch(TEXT_BCC), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BCC :16
+    E1(0x5840, flowBranch(TEXT_BHS), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BHS :16 (alias)
+    E1(0x5850, flowBranch(TEXT_BCS), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BCS :16
+    E1(0x5850, flowBranch(TEXT_BLO), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BLO :16 (alias)
+    E1(0x5860, flowBranch(TEXT_BNE), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BNE :16
+    E1(0x5870, flowBranch(TEXT_BEQ), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BEQ :16
+    E1(0x5880, flowBranch(TEXT_BVC), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BVC :16
+    E1(0x5890, flowBranch(TEXT_BVS), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BVS :16
+    E1(0x58A0, flowBranch(TEXT_BPL), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BPL :16
+    E1(0x58B0, flowBranch(TEXT_BMI), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BMI :16
+    E1(0x58C0, flowBranch(TEXT_BGE), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BGE :16
+    E1(0x58D0, flowBranch(TEXT_BLT), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BLT :16
+    E1(0x58E0, flowBranch(TEXT_BGT), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BGT :16
+    E1(0x58F0, flowBranch(TEXT_BLE), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BLE :16
+    E1(0x5C00, flowBranch(TEXT_BSR), ISZ_NONE, SZ_WORD, M_REL16, POS____),         // BSR :16
     E2(0x0B90, TEXT_ADDS,  ISZ_ADDR, SZ_WORD, M_VAL4, M_ADREG, POS____, POS___7),  // ADDS #4, ERd
     E2(0x1B90, TEXT_SUBS,  ISZ_ADDR, SZ_WORD, M_VAL4, M_ADREG, POS____, POS___7),  // SUBS #4, ERd
     E1(0x5700, TEXT_TRAPA, ISZ_NONE, SZ_NONE, M_IMM3, POS__7_),                    // TRAPA #vec (2-bit)
@@ -778,8 +778,8 @@ constexpr Entry H8300H_TABLE[] PROGMEM = {
     E2(0x6AA0, TEXT_MOV,   ISZ_DATA, SZ_BYTE, M_REG8,  M_ABS24, POS___F, POS____), // MOV.B Rs, @aa:24
     E2(0x6B20, TEXT_MOV,   ISZ_DATA, SZ_WORD, M_ABS24, M_REG16, POS____, POS___F), // MOV.W @aa:24, Rd
     E2(0x6BA0, TEXT_MOV,   ISZ_DATA, SZ_WORD, M_REG16, M_ABS24, POS___F, POS____), // MOV.W Rs, @aa:24
-    E1(0x5A00, TEXT_JMP,   ISZ_NONE, SZ_NONE, M_ABS24, POS__FF),                   // JMP @aa:24
-    E1(0x5E00, TEXT_JSR,   ISZ_NONE, SZ_NONE, M_ABS24, POS__FF),                   // JSR @aa:24
+    E1(0x5A00, flowJump(TEXT_JMP),   ISZ_NONE, SZ_NONE, M_ABS24, POS__FF),         // JMP @aa:24
+    E1(0x5E00, flowBranch(TEXT_JSR), ISZ_NONE, SZ_NONE, M_ABS24, POS__FF),         // JSR @aa:24
 };
 
 constexpr uint8_t H8300H_INDEX[] PROGMEM = {
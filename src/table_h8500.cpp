@@ -185,52 +185,52 @@ constexpr uint8_t INDEX_ECLK[] PROGMEM = {
 
 // Special format (PM_SPC): [OP byte][...]. No EA byte.
 constexpr Entry TABLE_SPC[] PROGMEM = {
-    E1(0x24, CF_00, TEXT_BCC,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BCC d:8
-    E1(0x25, CF_00, TEXT_BCS,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BCS d:8
-    E1(0x27, CF_00, TEXT_BEQ,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BEQ d:8
-    E1(0x21, CF_00, TEXT_BF,     IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BF d:8
-    E1(0x2C, CF_00, TEXT_BGE,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BGE d:8
-    E1(0x2E, CF_00, TEXT_BGT,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BGT d:8
-    E1(0x22, CF_00, TEXT_BHI,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BHI d:8
-    E1(0x24, CF_00, TEXT_BHS,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BHS d:8
-    E1(0x2F, CF_00, TEXT_BLE,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BLE d:8
-    E1(0x25, CF_00, TEXT_BLO,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BLO d:8
-    E1(0x23, CF_00, TEXT_BLS,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BLS d:8
-    E1(0x2D, CF_00, TEXT_BLT,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BLT d:8
-    E1(0x2B, CF_00, TEXT_BMI,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BMI d:8
-    E1(0x26, CF_00, TEXT_BNE,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BNE d:8
-    E1(0x2A, CF_00, TEXT_BPL,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BPL d:8
-    E1(0x20, CF_00, TEXT_BRA,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BRA d:8
+    E1(0x24, CF_00, flowBranch(TEXT_BCC), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BCC d:8
+    E1(0x25, CF_00, flowBranch(TEXT_BCS), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BCS d:8
+    E1(0x27, CF_00, flowBranch(TEXT_BEQ), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BEQ d:8
+    E1(0x21, CF_00, flowBranch(TEXT_BF),  IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BF d:8
+    E1(0x2C, CF_00, flowBranch(TEXT_BGE), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BGE d:8
+    E1(0x2E, CF_00, flowBranch(TEXT_BGT), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BGT d:8
+    E1(0x22, CF_00, flowBranch(TEXT_BHI), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BHI d:8
+    E1(0x24, CF_00, flowBranch(TEXT_BHS), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BHS d:8
+    E1(0x2F, CF_00, flowBranch(TEXT_BLE), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BLE d:8
+    E1(0x25, CF_00, flowBranch(TEXT_BLO), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BLO d:8
+    E1(0x23, CF_00, flowBranch(TEXT_BLS), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BLS d:8
+    E1(0x2D, CF_00, flowBranch(TEXT_BLT), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BLT d:8
+    E1(0x2B, CF_00, flowBranch(TEXT_BMI), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BMI d:8
+    E1(0x26, CF_00, flowBranch(TEXT_BNE), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BNE d:8
+    E1(0x2A, CF_00, flowBranch(TEXT_BPL), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BPL d:8
+    E1(0x20, CF_00, flowJump(TEXT_BRA),   IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BRA d:8
     E1(0x21, CF_00, TEXT_BRN,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BRN d:8
-    E1(0x0E, CF_00, TEXT_BSR,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BSR d:8
-    E1(0x20, CF_00, TEXT_BT,     IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BT d:8
-    E1(0x28, CF_00, TEXT_BVC,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BVC d:8
-    E1(0x29, CF_00, TEXT_BVS,    IC_N, ISZ_NONE, SZ_NONE, M_REL8),                // BVS d:8
-    E1(0x34, CF_00, TEXT_BCC,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BCC d:16
-    E1(0x35, CF_00, TEXT_BCS,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BCS d:16
-    E1(0x37, CF_00, TEXT_BEQ,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BEQ d:16
-    E1(0x34, CF_00, TEXT_BHS,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BHS d:16
-    E1(0x35, CF_00, TEXT_BLO,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BLO d:16
-    E1(0x33, CF_00, TEXT_BLS,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BLS d:16
-    E1(0x3D, CF_00, TEXT_BLT,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BLT d:16
-    E1(0x3B, CF_00, TEXT_BMI,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BMI d:16
-    E1(0x36, CF_00, TEXT_BNE,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BNE d:16
-    E1(0x3A, CF_00, TEXT_BPL,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BPL d:16
-    E1(0x30, CF_00, TEXT_BRA,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BRA d:16
-    E1(0x1E, CF_00, TEXT_BSR,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BSR d:16
-    E1(0x30, CF_00, TEXT_BT,     IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BT d:16
-    E1(0x38, CF_00, TEXT_BVC,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BVC d:16
-    E1(0x39, CF_00, TEXT_BVS,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BVS d:16
-    E1(0x31, CF_00, TEXT_BF,     IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BF d:16
-    E1(0x32, CF_00, TEXT_BHI,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BHI d:16
-    E1(0x3C, CF_00, TEXT_BGE,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BGE d:16
-    E1(0x3E, CF_00, TEXT_BGT,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BGT d:16
-    E1(0x3F, CF_00, TEXT_BLE,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BLE d:16
+    E1(0x0E, CF_00, flowBranch(TEXT_BSR), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BSR d:8
+    E1(0x20, CF_00, flowJump(TEXT_BT),    IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BT d:8
+    E1(0x28, CF_00, flowBranch(TEXT_BVC), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BVC d:8
+    E1(0x29, CF_00, flowBranch(TEXT_BVS), IC_N, ISZ_NONE, SZ_NONE, M_REL8),       // BVS d:8
+    E1(0x34, CF_00, flowBranch(TEXT_BCC), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BCC d:16
+    E1(0x35, CF_00, flowBranch(TEXT_BCS), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BCS d:16
+    E1(0x37, CF_00, flowBranch(TEXT_BEQ), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BEQ d:16
+    E1(0x34, CF_00, flowBranch(TEXT_BHS), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BHS d:16
+    E1(0x35, CF_00, flowBranch(TEXT_BLO), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BLO d:16
+    E1(0x33, CF_00, flowBranch(TEXT_BLS), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BLS d:16
+    E1(0x3D, CF_00, flowBranch(TEXT_BLT), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BLT d:16
+    E1(0x3B, CF_00, flowBranch(TEXT_BMI), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BMI d:16
+    E1(0x36, CF_00, flowBranch(TEXT_BNE), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BNE d:16
+    E1(0x3A, CF_00, flowBranch(TEXT_BPL), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BPL d:16
+    E1(0x30, CF_00, flowJump(TEXT_BRA),   IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BRA d:16
+    E1(0x1E, CF_00, flowBranch(TEXT_BSR), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BSR d:16
+    E1(0x30, CF_00, flowJump(TEXT_BT),    IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BT d:16
+    E1(0x38, CF_00, flowBranch(TEXT_BVC), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BVC d:16
+    E1(0x39, CF_00, flowBranch(TEXT_BVS), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BVS d:16
+    E1(0x31, CF_00, flowBranch(TEXT_BF),  IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BF d:16
+    E1(0x32, CF_00, flowBranch(TEXT_BHI), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BHI d:16
+    E1(0x3C, CF_00, flowBranch(TEXT_BGE), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BGE d:16
+    E1(0x3E, CF_00, flowBranch(TEXT_BGT), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BGT d:16
+    E1(0x3F, CF_00, flowBranch(TEXT_BLE), IC_N, ISZ_NONE, SZ_NONE, M_REL16),      // BLE d:16
     E1(0x31, CF_00, TEXT_BRN,    IC_N, ISZ_NONE, SZ_NONE, M_REL16),               // BRN d:16
     E2(0x40, CF_07, TEXT_CMP,    IC_E, ISZ_NONE, SZ_BYTE, M_IMM8,    M_REG),      // CMP:E #xx:8,Rd
     E2(0x48, CF_07, TEXT_CMP,    IC_I, ISZ_NONE, SZ_WORD, M_IMM16,   M_REG),      // CMP:I #xx:16,Rd
-    E1(0x10, CF_00, TEXT_JMP,    IC_N, ISZ_NONE, SZ_NONE, M_ABS16),               // JMP @aa:16
-    E1(0x18, CF_00, TEXT_JSR,    IC_N, ISZ_NONE, SZ_NONE, M_ABS16),               // JSR @aa:16
+    E1(0x10, CF_00, flowJump(TEXT_JMP),   IC_N, ISZ_NONE, SZ_NONE, M_ABS16),      // JMP @aa:16
+    E1(0x18, CF_00, flowBranch(TEXT_JSR), IC_N, ISZ_NONE, SZ_NONE, M_ABS16),      // JSR @aa:16
     E2(0x02, CF_00, TEXT_LDM,    IC_N, ISZ_NONE, SZ_WORD, M_SP,      M_REGLIST),  // LDM @SP+,(rlist)
     E2(0x17, CF_00, TEXT_LINK,   IC_N, ISZ_NONE, SZ_NONE, M_FP,      M_IMM8),     // LINK FP,#xx:8
     E2(0x1F, CF_00, TEXT_LINK,   IC_N, ISZ_NONE, SZ_NONE, M_FP,      M_IMM16),    // LINK FP,#xx:16
@@ -241,13 +241,13 @@ constexpr Entry TABLE_SPC[] PROGMEM = {
     E2(0x60, CF_0F, TEXT_MOV,    IC_L, ISZ_DATA, SZ_DATA, M_ABS8,    M_REG),      // MOV:L.B/.W @aa:8,Rd
     E2(0x70, CF_0F, TEXT_MOV,    IC_S, ISZ_DATA, SZ_DATA, M_REG,     M_ABS8),     // MOV:S.B/.W Rs,@aa:8
     E0(0x00,                 TEXT_NOP),                                           // NOP
-    E1(0x14, CF_00, TEXT_RTD,    IC_N, ISZ_NONE, SZ_NONE, M_IMM8),                // RTD #xx:8
-    E1(0x1C, CF_00, TEXT_RTD,    IC_N, ISZ_NONE, SZ_NONE, M_IMM16),               // RTD #xx:16
-    E0(0x0A,                 TEXT_RTE),                                           // RTE
-    E0(0x19,                 TEXT_RTS),                                           // RTS
-    E2(0x07, CF_00, TEXT_SCB_EQ, IC_N, ISZ_NONE, SZ_NONE, M_SCB,     M_REL8),     // SCB/EQ Rn,d:8
-    E2(0x01, CF_00, TEXT_SCB_F,  IC_N, ISZ_NONE, SZ_NONE, M_SCB,     M_REL8),     // SCB/F Rn,d:8
-    E2(0x06, CF_00, TEXT_SCB_NE, IC_N, ISZ_NONE, SZ_NONE, M_SCB,     M_REL8),     // SCB/NE Rn,d:8
+    E1(0x14, CF_00, flowEnd(TEXT_RTD), IC_N, ISZ_NONE, SZ_NONE, M_IMM8),          // RTD #xx:8
+    E1(0x1C, CF_00, flowEnd(TEXT_RTD), IC_N, ISZ_NONE, SZ_NONE, M_IMM16),         // RTD #xx:16
+    E0(0x0A,                 flowEnd(TEXT_RTE)),                                           // RTE
+    E0(0x19,                 flowEnd(TEXT_RTS)),                                           // RTS
+    E2(0x07, CF_00, flowBranch(TEXT_SCB_EQ), IC_N, ISZ_NONE, SZ_NONE, M_SCB,     M_REL8),  // SCB/EQ Rn,d:8
+    E2(0x01, CF_00, flowBranch(TEXT_SCB_F),  IC_N, ISZ_NONE, SZ_NONE, M_SCB,     M_REL8),  // SCB/F Rn,d:8
+    E2(0x06, CF_00, flowBranch(TEXT_SCB_NE), IC_N, ISZ_NONE, SZ_NONE, M_SCB,     M_REL8),  // SCB/NE Rn,d:8
     E0(0x1A,                 TEXT_SLEEP),                                         // SLEEP
     E2(0x12, CF_00, TEXT_STM,    IC_N, ISZ_NONE, SZ_WORD, M_REGLIST, M_SP),       // STM (rlist),@-SP
     E0(0x09,                 TEXT_TRAP_VS),                                       // TRAP/VS
@@ -328,12 +328,12 @@ constexpr uint8_t INDEX_SPC[] PROGMEM = {
 
 // Secondary (0x11-prefix) instructions, all CPUs: JMP/JSR @Rn / @(d,Rn).
 constexpr Entry TABLE_SEC[] PROGMEM = {
-    E1(0xD0, CF_07, TEXT_JMP,    IC_N, ISZ_NONE, SZ_NONE, M_IND),                 // JMP @Rn
-    E1(0xE0, CF_07, TEXT_JMP,    IC_N, ISZ_NONE, SZ_NONE, M_IDX8),                // JMP @(d:8,Rn)
-    E1(0xF0, CF_07, TEXT_JMP,    IC_N, ISZ_NONE, SZ_NONE, M_IDX16),               // JMP @(d:16,Rn)
-    E1(0xD8, CF_07, TEXT_JSR,    IC_N, ISZ_NONE, SZ_NONE, M_IND),                 // JSR @Rn
-    E1(0xE8, CF_07, TEXT_JSR,    IC_N, ISZ_NONE, SZ_NONE, M_IDX8),                // JSR @(d:8,Rn)
-    E1(0xF8, CF_07, TEXT_JSR,    IC_N, ISZ_NONE, SZ_NONE, M_IDX16),               // JSR @(d:16,Rn)
+    E1(0xD0, CF_07, flowJump(TEXT_JMP),   IC_N, ISZ_NONE, SZ_NONE, M_IND),        // JMP @Rn
+    E1(0xE0, CF_07, flowJump(TEXT_JMP),   IC_N, ISZ_NONE, SZ_NONE, M_IDX8),       // JMP @(d:8,Rn)
+    E1(0xF0, CF_07, flowJump(TEXT_JMP),   IC_N, ISZ_NONE, SZ_NONE, M_IDX16),      // JMP @(d:16,Rn)
+    E1(0xD8, CF_07, flowBranch(TEXT_JSR), IC_N, ISZ_NONE, SZ_NONE, M_IND),        // JSR @Rn
+    E1(0xE8, CF_07, flowBranch(TEXT_JSR), IC_N, ISZ_NONE, SZ_NONE, M_IDX8),       // JSR @(d:8,Rn)
+    E1(0xF8, CF_07, flowBranch(TEXT_JSR), IC_N, ISZ_NONE, SZ_NONE, M_IDX16),      // JSR @(d:16,Rn)
 };
 
 constexpr uint8_t INDEX_SEC[] PROGMEM = {
@@ -347,8 +347,8 @@ constexpr uint8_t INDEX_SEC[] PROGMEM = {
 
 // Page-jump SPC instructions (maximum-mode, all variants): PJMP/PJSR @aa:24.
 constexpr Entry TABLE_SPC_PJ[] PROGMEM = {
-    E1(0x03, CF_00, TEXT_PJSR,   IC_N, ISZ_NONE, SZ_NONE, M_ABS24),               // PJSR @aa:24
-    E1(0x13, CF_00, TEXT_PJMP,   IC_N, ISZ_NONE, SZ_NONE, M_ABS24),               // PJMP @aa:24
+    E1(0x03, CF_00, flowBranch(TEXT_PJSR), IC_N, ISZ_NONE, SZ_NONE, M_ABS24),     // PJSR @aa:24
+    E1(0x13, CF_00, flowJump(TEXT_PJMP),   IC_N, ISZ_NONE, SZ_NONE, M_ABS24),     // PJMP @aa:24
 };
 
 constexpr uint8_t INDEX_SPC_PJ[] PROGMEM = {
@@ -358,11 +358,11 @@ constexpr uint8_t INDEX_SPC_PJ[] PROGMEM = {
 
 // Page-jump SEC instructions (maximum-mode, all variants): PJMP/PJSR @Rn, PRTS, PRTD.
 constexpr Entry TABLE_SEC_PJ[] PROGMEM = {
-    E1(0xC0, CF_07, TEXT_PJMP,   IC_N, ISZ_NONE, SZ_NONE, M_INDP),                // PJMP @Rn
-    E1(0xC8, CF_07, TEXT_PJSR,   IC_N, ISZ_NONE, SZ_NONE, M_INDP),                // PJSR @Rn
-    E1(0x14, CF_00, TEXT_PRTD,   IC_N, ISZ_NONE, SZ_NONE, M_IMM8),                // PRTD #xx:8
-    E1(0x1C, CF_00, TEXT_PRTD,   IC_N, ISZ_NONE, SZ_NONE, M_IMM16),               // PRTD #xx:16
-    E0(0x19,                 TEXT_PRTS),                                          // PRTS
+    E1(0xC0, CF_07, flowJump(TEXT_PJMP),   IC_N, ISZ_NONE, SZ_NONE, M_INDP),      // PJMP @Rn
+    E1(0xC8, CF_07, flowBranch(TEXT_PJSR), IC_N, ISZ_NONE, SZ_NONE, M_INDP),      // PJSR @Rn
+    E1(0x14, CF_00, flowEnd(TEXT_PRTD),    IC_N, ISZ_NONE, SZ_NONE, M_IMM8),      // PRTD #xx:8
+    E1(0x1C, CF_00, flowEnd(TEXT_PRTD),    IC_N, ISZ_NONE, SZ_NONE, M_IMM16),     // PRTD #xx:16
+    E0(0x19,                 flowEnd(TEXT_PRTS)),                                          // PRTS
 };
 
 constexpr uint8_t INDEX_SEC_PJ[] PROGMEM = {
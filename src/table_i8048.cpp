@@ -66,25 +66,25 @@ constexpr Entry TABLE_I8039[] PROGMEM = {
     E1(0x18, CF_07, TEXT_INC,  M_R),
     E1(0x10, CF_01, TEXT_INC,  M_IR),
     E1(0xC8, CF_07, TEXT_DEC,  M_R),
-    E1(0x04, CF_E0, TEXT_JMP,  M_AD11),
-    E1(0xB3, CF_00, TEXT_JMPP, M_IA),
-    E2(0xE8, CF_07, TEXT_DJNZ, M_R,    M_AD08),
-    E1(0xF6, CF_00, TEXT_JC,   M_AD08),
-    E1(0xE6, CF_00, TEXT_JNC,  M_AD08),
-    E1(0xC6, CF_00, TEXT_JZ,   M_AD08),
-    E1(0x96, CF_00, TEXT_JNZ,  M_AD08),
-    E1(0x36, CF_00, TEXT_JT0,  M_AD08),
-    E1(0x26, CF_00, TEXT_JNT0, M_AD08),
-    E1(0x56, CF_00, TEXT_JT1,  M_AD08),
-    E1(0x46, CF_00, TEXT_JNT1, M_AD08),
-    E1(0xB6, CF_00, TEXT_JF0,  M_AD08),
-    E1(0x76, CF_00, TEXT_JF1,  M_AD08),
-    E1(0x16, CF_00, TEXT_JTF,  M_AD08),
-    E1(0x86, CF_00, TEXT_JNI,  M_AD08),
-    E2(0x12, CF_E0, TEXT_JB,   M_BITN,  M_AD08),
-    E1(0x14, CF_E0, TEXT_CALL, M_AD11),
-    E0(0x83, CF_00, TEXT_RET),
-    E0(0x93, CF_00, TEXT_RETR),
+    E1(0x04, CF_E0, flowJump(TEXT_JMP),    M_AD11),
+    E1(0xB3, CF_00, flowJump(TEXT_JMPP),   M_IA),
+    E2(0xE8, CF_07, flowBranch(TEXT_DJNZ), M_R,    M_AD08),
+    E1(0xF6, CF_00, flowBranch(TEXT_JC),   M_AD08),
+    E1(0xE6, CF_00, flowBranch(TEXT_JNC),  M_AD08),
+    E1(0xC6, CF_00, flowBranch(TEXT_JZ),   M_AD08),
+    E1(0x96, CF_00, flowBranch(TEXT_JNZ),  M_AD08),
+    E1(0x36, CF_00, flowBranch(TEXT_JT0),  M_AD08),
+    E1(0x26, CF_00, flowBranch(TEXT_JNT0), M_AD08),
+    E1(0x56, CF_00, flowBranch(TEXT_JT1),  M_AD08),
+    E1(0x46, CF_00, flowBranch(TEXT_JNT1), M_AD08),
+    E1(0xB6, CF_00, flowBranch(TEXT_JF0),  M_AD08),
+    E1(0x76, CF_00, flowBranch(TEXT_JF1),  M_AD08),
+    E1(0x16, CF_00, flowBranch(TEXT_JTF),  M_AD08),
+    E1(0x86, CF_00, flowBranch(TEXT_JNI),  M_AD08),
+    E2(0x12, CF_E0, flowBranch(TEXT_JB),   M_BITN,  M_AD08),
+    E1(0x14, CF_E0, flowBranch(TEXT_CALL), M_AD11),
+    E0(0x83, CF_00, flowEnd(TEXT_RET)),
+    E0(0x93, CF_00, flowEnd(TEXT_RETR)),
     E1(0x97, CF_00, TEXT_CLR,  M_C),
     E1(0xA7, CF_00, TEXT_CPL,  M_C),
     E1(0x85, CF_20, TEXT_CLR,  M_F),
@@ -237,7 +237,7 @@ constexpr Entry TABLE_MSM80C39[] PROGMEM = {
     E2(0x63, CF_00, TEXT_MOV,   M_A,  M_P1),
     E2(0x73, CF_00, TEXT_MOV,   M_A,  M_P2),
     E1(0xC0, CF_01, TEXT_DEC,   M_IR),
-    E2(0xE0, CF_01, TEXT_DJNZ,  M_IR, M_AD08),
+    E2(0xE0, CF_01, flowBranch(TEXT_DJNZ), M_IR, M_AD08),
     E2(0xC3, CF_00, TEXT_MOVP1, M_P,  M_IR3),
     E2(0xF3, CF_00, TEXT_MOV,   M_P1, M_IR3),
     E0(0x82, CF_00, TEXT_HLTS),
@@ -31,64 +31,64 @@ namespace i8051 {
 // clang-format off
 constexpr Entry TABLE_I8051[] PROGMEM = {
     E0(0x00, CF_00, TEXT_NOP),
-    E1(0x01, CF_E0, TEXT_AJMP,  M_ADR11),
-    E1(0x02, CF_00, TEXT_LJMP,  M_ADR16),
+    E1(0x01, CF_E0, flowJump(TEXT_AJMP), M_ADR11),
+    E1(0x02, CF_00, flowJump(TEXT_LJMP), M_ADR16),
     E1(0x03, CF_00, TEXT_RR,    M_AREG),
     E1(0x04, CF_00, TEXT_INC,   M_AREG),
     E1(0x05, CF_00, TEXT_INC,   M_ADR8),
     E1(0x06, CF_01, TEXT_INC,   M_IDIRR),
     E1(0x08, CF_07, TEXT_INC,   M_RREG),
-    E2(0x10, CF_00, TEXT_JBC,   M_BITAD, M_REL),
-    E1(0x11, CF_E0, TEXT_ACALL, M_ADR11),
-    E1(0x12, CF_00, TEXT_LCALL, M_ADR16),
+    E2(0x10, CF_00, flowBranch(TEXT_JBC),   M_BITAD, M_REL),
+    E1(0x11, CF_E0, flowBranch(TEXT_ACALL), M_ADR11),
+    E1(0x12, CF_00, flowBranch(TEXT_LCALL), M_ADR16),
     E1(0x13, CF_00, TEXT_RRC,   M_AREG),
     E1(0x14, CF_00, TEXT_DEC,   M_AREG),
     E1(0x15, CF_00, TEXT_DEC,   M_ADR8),
     E1(0x16, CF_01, TEXT_DEC,   M_IDIRR),
     E1(0x18, CF_07, TEXT_DEC,   M_RREG),
-    E2(0x20, CF_00, TEXT_JB,    M_BITAD, M_REL),
-    E0(0x22, CF_00, TEXT_RET),
+    E2(0x20, CF_00, flowBranch(TEXT_JB), M_BITAD, M_REL),
+    E0(0x22, CF_00, flowEnd(TEXT_RET)),
     E1(0x23, CF_00, TEXT_RL,    M_AREG),
     E2(0x24, CF_00, TEXT_ADD,   M_AREG,  M_IMM8),
     E2(0x25, CF_00, TEXT_ADD,   M_AREG,  M_ADR8),
     E2(0x26, CF_01, TEXT_ADD,   M_AREG,  M_IDIRR),
     E2(0x28, CF_07, TEXT_ADD,   M_AREG,  M_RREG),
-    E2(0x30, CF_00, TEXT_JNB,   M_BITAD, M_REL),
-    E0(0x32, CF_00, TEXT_RETI),
+    E2(0x30, CF_00, flowBranch(TEXT_JNB), M_BITAD, M_REL),
+    E0(0x32, CF_00, flowEnd(TEXT_RETI)),
     E1(0x33, CF_00, TEXT_RLC,   M_AREG),
     E2(0x34, CF_00, TEXT_ADDC,  M_AREG,  M_IMM8),
     E2(0x35, CF_00, TEXT_ADDC,  M_AREG,  M_ADR8),
     E2(0x36, CF_01, TEXT_ADDC,  M_AREG,  M_IDIRR),
     E2(0x38, CF_07, TEXT_ADDC,  M_AREG,  M_RREG),
-    E1(0x40, CF_00, TEXT_JC,    M_REL),
+    E1(0x40, CF_00, flowBranch(TEXT_JC), M_REL),
     E2(0x42, CF_00, TEXT_ORL,   M_ADR8,  M_AREG),
     E2(0x43, CF_00, TEXT_ORL,   M_ADR8,  M_IMM8),
     E2(0x44, CF_00, TEXT_ORL,   M_AREG,  M_IMM8),
     E2(0x45, CF_00, TEXT_ORL,   M_AREG,  M_ADR8),
     E2(0x46, CF_01, TEXT_ORL,   M_AREG,  M_IDIRR),
     E2(0x48, CF_07, TEXT_ORL,   M_AREG,  M_RREG),
-    E1(0x50, CF_00, TEXT_JNC,   M_REL),
+    E1(0x50, CF_00, flowBranch(TEXT_JNC), M_REL),
     E2(0x52, CF_00, TEXT_ANL,   M_ADR8,  M_AREG),
     E2(0x53, CF_00, TEXT_ANL,   M_ADR8,  M_IMM8),
     E2(0x54, CF_00, TEXT_ANL,   M_AREG,  M_IMM8),
     E2(0x55, CF_00, TEXT_ANL,   M_AREG,  M_ADR8),
     E2(0x56, CF_01, TEXT_ANL,   M_AREG,  M_IDIRR),
     E2(0x58, CF_07, TEXT_ANL,   M_AREG,  M_RREG),
-    E1(0x60, CF_00, TEXT_JZ,    M_REL),
+    E1(0x60, CF_00, flowBranch(TEXT_JZ), M_REL),
     E2(0x62, CF_00, TEXT_XRL,   M_ADR8,  M_AREG),
     E2(0x63, CF_00, TEXT_XRL,   M_ADR8,  M_IMM8),
     E2(0x64, CF_00, TEXT_XRL,   M_AREG,  M_IMM8),
     E2(0x65, CF_00, TEXT_XRL,   M_AREG,  M_ADR8),
     E2(0x66, CF_01, TEXT_XRL,   M_AREG,  M_IDIRR),
     E2(0x68, CF_07, TEXT_XRL,   M_AREG,  M_RREG),
-    E1(0x70, CF_00, TEXT_JNZ,   M_REL),
+    E1(0x70, CF_00, flowBranch(TEXT_JNZ), M_REL),
     E2(0x72, CF_00, TEXT_ORL,   M_CREG,  M_BITAD),
-    E1(0x73, CF_00, TEXT_JMP,   M_INDXD),
+    E1(0x73, CF_00, flowJump(TEXT_JMP), M_INDXD),
     E2(0x74, CF_00, TEXT_MOV,   M_AREG,  M_IMM8),
     E2(0x75, CF_00, TEXT_MOV,   M_ADR8,  M_IMM8),
     E2(0x76, CF_01, TEXT_MOV,   M_IDIRR, M_IMM8),
     E2(0x78, CF_07, TEXT_MOV,   M_RREG,  M_IMM8),
-    E1(0x80, CF_00, TEXT_SJMP,  M_REL),
+    E1(0x80, CF_00, flowJump(TEXT_SJMP), M_REL),
     E2(0x82, CF_00, TEXT_ANL,   M_CREG,  M_BITAD),
     E2(0x83, CF_00, TEXT_MOVC,  M_AREG,  M_INDXP),
     E1(0x84, CF_00, TEXT_DIV,   M_ABREG),
@@ -111,10 +111,10 @@ constexpr Entry TABLE_I8051[] PROGMEM = {
     E2(0xB0, CF_00, TEXT_ANL,   M_CREG,  M_NOTAD),
     E1(0xB2, CF_00, TEXT_CPL,   M_BITAD),
     E1(0xB3, CF_00, TEXT_CPL,   M_CREG),
-    E2(0xB4, CF_00, TEXT_CJNE,  M_AREG,  M_IMM8_REL),
-    E2(0xB5, CF_00, TEXT_CJNE,  M_AREG,  M_ADR8_REL),
-    E2(0xB6, CF_01, TEXT_CJNE,  M_IDIRR, M_IMM8_REL),
-    E2(0xB8, CF_07, TEXT_CJNE,  M_RREG,  M_IMM8_REL),
+    E2(0xB4, CF_00, flowBranch(TEXT_CJNE), M_AREG,  M_IMM8_REL),
+    E2(0xB5, CF_00, flowBranch(TEXT_CJNE), M_AREG,  M_ADR8_REL),
+    E2(0xB6, CF_01, flowBranch(TEXT_CJNE), M_IDIRR, M_IMM8_REL),
+    E2(0xB8, CF_07, flowBranch(TEXT_CJNE), M_RREG,  M_IMM8_REL),
     E1(0xC0, CF_00, TEXT_PUSH,  M_ADR8),
     E1(0xC2, CF_00, TEXT_CLR,   M_BITAD),
     E1(0xC3, CF_00, TEXT_CLR,   M_CREG),
@@ -126,9 +126,9 @@ constexpr Entry TABLE_I8051[] PROGMEM = {
     E1(0xD2, CF_00, TEXT_SETB,  M_BITAD),
     E1(0xD3, CF_00, TEXT_SETB,  M_CREG),
     E1(0xD4, CF_00, TEXT_DA,    M_AREG),
-    E2(0xD5, CF_00, TEXT_DJNZ,  M_ADR8,  M_REL),
+    E2(0xD5, CF_00, flowBranch(TEXT_DJNZ), M_ADR8,  M_REL),
     E2(0xD6, CF_01, TEXT_XCHD,  M_AREG,  M_IDIRR),
-    E2(0xD8, CF_07, TEXT_DJNZ,  M_RREG,  M_REL),
+    E2(0xD8, CF_07, flowBranch(TEXT_DJNZ), M_RREG,  M_REL),
     E2(0xE0, CF_00, TEXT_MOVX,  M_AREG,  M_IDIRD),
     E2(0xE2, CF_01, TEXT_MOVX,  M_AREG,  M_IDIRR),
     E1(0xE4, CF_00, TEXT_CLR,   M_AREG),
@@ -72,34 +72,34 @@ constexpr Entry TABLE_I8080[] PROGMEM = {
     E0(0xF0, CF_00, TEXT_RP),
     E0(0xF8, CF_00, TEXT_RM),
     E1(0xC1, CF_30, TEXT_POP,  M_STK),
-    E0(0xC9, CF_00, TEXT_RET),
-    E0(0xE9, CF_00, TEXT_PCHL),
+    E0(0xC9, CF_00, flowEnd(TEXT_RET)),
+    E0(0xE9, CF_00, flowEnd(TEXT_PCHL)),
     E0(0xF9, CF_00, TEXT_SPHL),
-    E1(0xC2, CF_00, TEXT_JNZ,  M_ABS),
-    E1(0xCA, CF_00, TEXT_JZ,   M_ABS),
-    E1(0xD2, CF_00, TEXT_JNC,  M_ABS),
-    E1(0xDA, CF_00, TEXT_JC,   M_ABS),
-    E1(0xE2, CF_00, TEXT_JPO,  M_ABS),
-    E1(0xEA, CF_00, TEXT_JPE,  M_ABS),
-    E1(0xF2, CF_00, TEXT_JP,   M_ABS),
-    E1(0xFA, CF_00, TEXT_JM,   M_ABS),
-    E1(0xC3, CF_00, TEXT_JMP,  M_ABS),
+    E1(0xC2, CF_00, flowBranch(TEXT_JNZ), M_ABS),
+    E1(0xCA, CF_00, flowBranch(TEXT_JZ),  M_ABS),
+    E1(0xD2, CF_00, flowBranch(TEXT_JNC), M_ABS),
+    E1(0xDA, CF_00, flowBranch(TEXT_JC),  M_ABS),
+    E1(0xE2, CF_00, flowBranch(TEXT_JPO), M_ABS),
+    E1(0xEA, CF_00, flowBranch(TEXT_JPE), M_ABS),
+    E1(0xF2, CF_00, flowBranch(TEXT_JP),  M_ABS),
+    E1(0xFA, CF_00, flowBranch(TEXT_JM),  M_ABS),
+    E1(0xC3, CF_00, flowJump(TEXT_JMP),   M_ABS),
     E1(0xD3, CF_00, TEXT_OUT,  M_IOA),
     E1(0xDB, CF_00, TEXT_IN,   M_IOA),
     E0(0xE3, CF_00, TEXT_XTHL),
     E0(0xEB, CF_00, TEXT_XCHG),
     E0(0xF3, CF_00, TEXT_DI),
     E0(0xFB, CF_00, TEXT_EI),
-    E1(0xC4, CF_00, TEXT_CNZ,  M_ABS),
-    E1(0xCC, CF_00, TEXT_CZ,   M_ABS),
-    E1(0xD4, CF_00, TEXT_CNC,  M_ABS),
-    E1(0xDC, CF_00, TEXT_CC,   M_ABS),
-    E1(0xE4, CF_00, TEXT_CPO,  M_ABS),
-    E1(0xEC, CF_00, TEXT_CPE,  M_ABS),
-    E1(0xF4, CF_00, TEXT_CP,   M_ABS),
-    E1(0xFC, CF_00, TEXT_CM,   M_ABS),
+    E1(0xC4, CF_00, flowBranch(TEXT_CNZ), M_ABS),
+    E1(0xCC, CF_00, flowBranch(TEXT_CZ),  M_ABS),
+    E1(0xD4, CF_00, flowBranch(TEXT_CNC), M_ABS),
+    E1(0xDC, CF_00, flowBranch(TEXT_CC),  M_ABS),
+    E1(0xE4, CF_00, flowBranch(TEXT_CPO), M_ABS),
+    E1(0xEC, CF_00, flowBranch(TEXT_CPE), M_ABS),
+    E1(0xF4, CF_00, flowBranch(TEXT_CP),  M_ABS),
+    E1(0xFC, CF_00, flowBranch(TEXT_CM),  M_ABS),
     E1(0xC5, CF_30, TEXT_PUSH, M_STK),
-    E1(0xCD, CF_00, TEXT_CALL, M_ABS),
+    E1(0xCD, CF_00, flowBranch(TEXT_CALL), M_ABS),
     E1(0xC6, CF_00, TEXT_ADI,  M_IM8),
     E1(0xCE, CF_00, TEXT_ACI,  M_IM8),
     E1(0xD6, CF_00, TEXT_SUI,  M_IM8),
@@ -233,11 +233,11 @@ constexpr Entry TABLE_Z8080[] PROGMEM = {
     E1(0xB8, CF_07, TEXT_CP,   M_SRC),
     E1(0xC0, CF_38, TEXT_RET,  M_CC),
     E1(0xC1, CF_30, TEXT_POP,  M_STK),
-    E0(0xC9, CF_00, TEXT_RET),
+    E0(0xC9, CF_00, flowEnd(TEXT_RET)),
     E2(0xF9, CF_00, TEXT_LD,   R_SP,  R_HL),
-    E2(0xC2, CF_38, TEXT_JP,   M_CC,  M_IM16),
-    E1(0xC3, CF_00, TEXT_JP,   M_IM16),
-    E1(0xE9, CF_00, TEXT_JP,   I_HL),
+    E2(0xC2, CF_38, flowBranch(TEXT_JP), M_CC,  M_IM16),
+    E1(0xC3, CF_00, flowJump(TEXT_JP),   M_IM16),
+    E1(0xE9, CF_00, flowEnd(TEXT_JP),    I_HL),
     E2(0xD3, CF_00, TEXT_OUT,  M_IOA, R_A),
     E2(0xDB, CF_00, TEXT_IN,   R_A,   M_IOA),
     E2(0xE3, CF_00, TEXT_EX,   I_SP,  R_HL),
@@ -246,9 +246,9 @@ constexpr Entry TABLE_Z8080[] PROGMEM = {
     E2(0xEB, CF_00, TEXT_EX,   R_HL,  R_DE),
     E0(0xF3, CF_00, TEXT_DI),
     E0(0xFB, CF_00, TEXT_EI),
-    E2(0xC4, CF_38, TEXT_CALL, M_CC,  M_IM16),
+    E2(0xC4, CF_38, flowBranch(TEXT_CALL), M_CC,  M_IM16),
     E1(0xC5, CF_30, TEXT_PUSH, M_STK),
-    E1(0xCD, CF_00, TEXT_CALL, M_IM16),
+    E1(0xCD, CF_00, flowBranch(TEXT_CALL), M_IM16),
     E2(0xC6, CF_00, TEXT_ADD,  R_A,   M_IM8),
     E2(0xCE, CF_00, TEXT_ADC,  R_A,   M_IM8),
     E2(0xD6, CF_00, TEXT_SUB,  R_A,   M_IM8),
@@ -360,7 +360,7 @@ constexpr uint8_t INDEX_Z8085[] PROGMEM = {
 
 constexpr Entry TABLE_V30EMU[] PROGMEM = {
     E1(0xED, CF_00, TEXT_CALLN, M_IM8),
-    E0(0xFD, CF_00, TEXT_RETEM),
+    E0(0xFD, CF_00, flowEnd(TEXT_RETEM)),
 };
 
 constexpr uint8_t INDEX_V30EMU[] PROGMEM = {
@@ -142,36 +142,36 @@ constexpr Entry T8086_00[] PROGMEM = {
     E1(0x48, CF_07, TEXT_DEC,    SZ_DATA, M_WREG, P_OREG),
     E1(0x50, CF_07, TEXT_PUSH,   SZ_DATA, M_WREG, P_OREG),
     E1(0x58, CF_07, TEXT_POP,    SZ_DATA, M_WREG, P_OREG),
-    E1(0x70, CF_00, TEXT_JO,     SZ_NONE, M_REL8, P_OPR),
-    E1(0x71, CF_00, TEXT_JNO,    SZ_NONE, M_REL8, P_OPR),
-    E1(0x72, CF_00, TEXT_JB,     SZ_NONE, M_REL8, P_OPR),
-    E1(0x72, CF_00, TEXT_JC,     SZ_NONE, M_REL8, P_OPR),
-    E1(0x72, CF_00, TEXT_JNAE,   SZ_NONE, M_REL8, P_OPR),
-    E1(0x73, CF_00, TEXT_JAE,    SZ_NONE, M_REL8, P_OPR),
-    E1(0x73, CF_00, TEXT_JNB,    SZ_NONE, M_REL8, P_OPR),
-    E1(0x73, CF_00, TEXT_JNC,    SZ_NONE, M_REL8, P_OPR),
-    E1(0x74, CF_00, TEXT_JE,     SZ_NONE, M_REL8, P_OPR),
-    E1(0x74, CF_00, TEXT_JZ,     SZ_NONE, M_REL8, P_OPR),
-    E1(0x75, CF_00, TEXT_JNE,    SZ_NONE, M_REL8, P_OPR),
-    E1(0x75, CF_00, TEXT_JNZ,    SZ_NONE, M_REL8, P_OPR),
-    E1(0x76, CF_00, TEXT_JBE,    SZ_NONE, M_REL8, P_OPR),
-    E1(0x76, CF_00, TEXT_JNA,    SZ_NONE, M_REL8, P_OPR),
-    E1(0x77, CF_00, TEXT_JA,     SZ_NONE, M_REL8, P_OPR),
-    E1(0x77, CF_00, TEXT_JNBE,   SZ_NONE, M_REL8, P_OPR),
-    E1(0x78, CF_00, TEXT_JS,     SZ_NONE, M_REL8, P_OPR),
-    E1(0x79, CF_00, TEXT_JNS,    SZ_NONE, M_REL8, P_OPR),
-    E1(0x7A, CF_00, TEXT_JPE,    SZ_NONE, M_REL8, P_OPR),
-    E1(0x7A, CF_00, TEXT_JP,     SZ_NONE, M_REL8, P_OPR),
-    E1(0x7B, CF_00, TEXT_JPO,    SZ_NONE, M_REL8, P_OPR),
-    E1(0x7B, CF_00, TEXT_JNP,    SZ_NONE, M_REL8, P_OPR),
-    E1(0x7C, CF_00, TEXT_JL,     SZ_NONE, M_REL8, P_OPR),
-    E1(0x7C, CF_00, TEXT_JNGE,   SZ_NONE, M_REL8, P_OPR),
-    E1(0x7D, CF_00, TEXT_JGE,    SZ_NONE, M_REL8, P_OPR),
-    E1(0x7D, CF_00, TEXT_JNL,    SZ_NONE, M_REL8, P_OPR),
-    E1(0x7E, CF_00, TEXT_JLE,    SZ_NONE, M_REL8, P_OPR),
-    E1(0x7E, CF_00, TEXT_JNG,    SZ_NONE, M_REL8, P_OPR),
-    E1(0x7F, CF_00, TEXT_JG,     SZ_NONE, M_REL8, P_OPR),
-    E1(0x7F, CF_00, TEXT_JNLE,   SZ_NONE, M_REL8, P_OPR),
+    E1(0x70, CF_00, flowBranch(TEXT_JO),   SZ_NONE, M_REL8, P_OPR),
+    E1(0x71, CF_00, flowBranch(TEXT_JNO),  SZ_NONE, M_REL8, P_OPR),
+    E1(0x72, CF_00, flowBranch(TEXT_JB),   SZ_NONE, M_REL8, P_OPR),
+    E1(0x72, CF_00, flowBranch(TEXT_JC),   SZ_NONE, M_REL8, P_OPR),
+    E1(0x72, CF_00, flowBranch(TEXT_JNAE), SZ_NONE, M_REL8, P_OPR),
+    E1(0x73, CF_00, flowBranch(TEXT_JAE),  SZ_NONE, M_REL8, P_OPR),
+    E1(0x73, CF_00, flowBranch(TEXT_JNB),  SZ_NONE, M_REL8, P_OPR),
+    E1(0x73, CF_00, flowBranch(TEXT_JNC),  SZ_NONE, M_REL8, P_OPR),
+    E1(0x74, CF_00, flowBranch(TEXT_JE),   SZ_NONE, M_REL8, P_OPR),
+    E1(0x74, CF_00, flowBranch(TEXT_JZ),   SZ_NONE, M_REL8, P_OPR),
+    E1(0x75, CF_00, flowBranch(TEXT_JNE),  SZ_NONE, M_REL8, P_OPR),
+    E1(0x75, CF_00, flowBranch(TEXT_JNZ),  SZ_NONE, M_REL8, P_OPR),
+    E1(0x76, CF_00, flowBranch(TEXT_JBE),  SZ_NONE, M_REL8, P_OPR),
+    E1(0x76, CF_00, flowBranch(TEXT_JNA),  SZ_NONE, M_REL8, P_OPR),
+    E1(0x77, CF_00, flowBranch(TEXT_JA),   SZ_NONE, M_REL8, P_OPR),
+    E1(0x77, CF_00, flowBranch(TEXT_JNBE), SZ_NONE, M_REL8, P_OPR),
+    E1(0x78, CF_00, flowBranch(TEXT_JS),   SZ_NONE, M_REL8, P_OPR),
+    E1(0x79, CF_00, flowBranch(TEXT_JNS),  SZ_NONE, M_REL8, P_OPR),
+    E1(0x7A, CF_00, flowBranch(TEXT_JPE),  SZ_NONE, M_REL8, P_OPR),
+    E1(0x7A, CF_00, flowBranch(TEXT_JP),   SZ_NONE, M_REL8, P_OPR),
+    E1(0x7B, CF_00, flowBranch(TEXT_JPO),  SZ_NONE, M_REL8, P_OPR),
+    E1(0x7B, CF_00, flowBranch(TEXT_JNP),  SZ_NONE, M_REL8, P_OPR),
+    E1(0x7C, CF_00, flowBranch(TEXT_JL),   SZ_NONE, M_REL8, P_OPR),
+    E1(0x7C, CF_00, flowBranch(TEXT_JNGE), SZ_NONE, M_REL8, P_OPR),
+    E1(0x7D, CF_00, flowBranch(TEXT_JGE),  SZ_NONE, M_REL8, P_OPR),
+    E1(0x7D, CF_00, flowBranch(TEXT_JNL),  SZ_NONE, M_REL8, P_OPR),
+    E1(0x7E, CF_00, flowBranch(TEXT_JLE),  SZ_NONE, M_REL8, P_OPR),
+    E1(0x7E, CF_00, flowBranch(TEXT_JNG),  SZ_NONE, M_REL8, P_OPR),
+    E1(0x7F, CF_00, flowBranch(TEXT_JG),   SZ_NONE, M_REL8, P_OPR),
+    E1(0x7F, CF_00, flowBranch(TEXT_JNLE), SZ_NONE, M_REL8, P_OPR),
     E2(0x84, CF_00, TEXT_TEST,   SZ_BYTE, M_BMOD, M_BREG, P_MOD,  P_REG),
     E2(0x84, CF_00, TEXT_TEST,   SZ_BYTE, M_BREG, M_BMOD, P_REG,  P_MOD),
     E2(0x85, CF_00, TEXT_TEST,   SZ_DATA, M_WMOD, M_WREG, P_MOD,  P_REG),
@@ -189,9 +189,9 @@ constexpr Entry T8086_00[] PROGMEM = {
     E2(0x8E, CF_00, TEXT_MOV,    SZ_WORD, M_SREG, M_WMOD, P_REG,  P_MOD),
     E0(0x98, CF_00, TEXT_CBW,    SZ_NONE),
     E0(0x99, CF_00, TEXT_CWD,    SZ_NONE),
-    E1(0x9A, CF_00, TEXT_CALL,   SZ_NONE, M_FAR,  P_OPR), // FMODE_FAR
-    E1(0x9A, CF_00, TEXT_CALLF,  SZ_NONE, M_FAR,  P_OPR), // FMODE_F
-    E2(0x9A, CF_00, TEXT_LCALL,  SZ_NONE, M_SEG,  M_OFF, P_OPR,  P_OPR), // FMODE_L
+    E1(0x9A, CF_00, flowBranch(TEXT_CALL),  SZ_NONE, M_FAR,  P_OPR), // FMODE_FAR
+    E1(0x9A, CF_00, flowBranch(TEXT_CALLF), SZ_NONE, M_FAR,  P_OPR), // FMODE_F
+    E2(0x9A, CF_00, flowBranch(TEXT_LCALL), SZ_NONE, M_SEG,  M_OFF, P_OPR,  P_OPR), // FMODE_L
     E0(0x9B, CF_00, TEXT_WAIT,   SZ_NONE),
     E0(0x9C, CF_00, TEXT_PUSHF,  SZ_WORD),
     E0(0x9D, CF_00, TEXT_POPF,   SZ_WORD),
@@ -231,42 +231,42 @@ constexpr Entry T8086_00[] PROGMEM = {
     S0(0xAF, CF_00, TEXT_SCASW,  SZ_NONE),
     E2(0xB0, CF_07, TEXT_MOV,    SZ_BYTE, M_BREG, M_WIMM, P_OREG, P_OPR),
     E2(0xB8, CF_07, TEXT_MOV,    SZ_DATA, M_WREG, M_WIMM, P_OREG, P_OPR),
-    E1(0xC2, CF_00, TEXT_RET,    SZ_NONE, M_UI16, P_OPR),
-    E0(0xC3, CF_00, TEXT_RET,    SZ_NONE),
+    E1(0xC2, CF_00, flowEnd(TEXT_RET), SZ_NONE, M_UI16, P_OPR),
+    E0(0xC3, CF_00, flowEnd(TEXT_RET), SZ_NONE),
     E2(0xC4, CF_00, TEXT_LES,    SZ_DATA, M_WREG, M_MEM, P_REG,  P_MOD),
     E2(0xC5, CF_00, TEXT_LDS,    SZ_DATA, M_WREG, M_MEM, P_REG,  P_MOD),
-    E1(0xCA, CF_00, TEXT_RETF,   SZ_WORD, M_UI16, P_OPR), // FMODE_FAR
-    E1(0xCA, CF_00, TEXT_RETF,   SZ_WORD, M_UI16, P_OPR), // FMODE_F
-    E1(0xCA, CF_00, TEXT_LRET,   SZ_WORD, M_UI16, P_OPR), // FMODE_L
-    E0(0xCB, CF_00, TEXT_RETF,   SZ_NONE),                // FMODE_FAR
-    E0(0xCB, CF_00, TEXT_RETF,   SZ_NONE),                // FMODE_F
-    E0(0xCB, CF_00, TEXT_LRET,   SZ_NONE),                // FMODE_L
+    E1(0xCA, CF_00, flowEnd(TEXT_RETF), SZ_WORD, M_UI16, P_OPR), // FMODE_FAR
+    E1(0xCA, CF_00, flowEnd(TEXT_RETF), SZ_WORD, M_UI16, P_OPR), // FMODE_F
+    E1(0xCA, CF_00, flowEnd(TEXT_LRET), SZ_WORD, M_UI16, P_OPR), // FMODE_L
+    E0(0xCB, CF_00, flowEnd(TEXT_RETF), SZ_NONE),         // FMODE_FAR
+    E0(0xCB, CF_00, flowEnd(TEXT_RETF), SZ_NONE),         // FMODE_F
+    E0(0xCB, CF_00, flowEnd(TEXT_LRET), SZ_NONE),         // FMODE_L
     E1(0xCC, CF_00, TEXT_INT,    SZ_NONE, M_VAL3, P_NONE),
     E1(0xCD, CF_00, TEXT_INT,    SZ_BYTE, M_WIMM, P_OPR),
     E0(0xCE, CF_00, TEXT_INTO,   SZ_NONE),
-    E0(0xCF, CF_00, TEXT_IRET,   SZ_NONE),
+    E0(0xCF, CF_00, flowEnd(TEXT_IRET), SZ_NONE),
     E0(0xD7, CF_00, TEXT_XLAT,   SZ_NONE),
-    E1(0xE0, CF_00, TEXT_LOOPNE, SZ_NONE, M_REL8, P_OPR),
-    E2(0xE0, CF_00, TEXT_LOOPNE, SZ_NONE, M_REL8, M_CX, P_OPR, P_NONE),
-    E1(0xE0, CF_00, TEXT_LOOPNZ, SZ_NONE, M_REL8, P_OPR),
-    E2(0xE0, CF_00, TEXT_LOOPNZ, SZ_NONE, M_REL8, M_CX, P_OPR, P_NONE),
-    E1(0xE1, CF_00, TEXT_LOOPE,  SZ_NONE, M_REL8, P_OPR),
-    E2(0xE1, CF_00, TEXT_LOOPE,  SZ_NONE, M_REL8, M_CX, P_OPR, P_NONE),
-    E1(0xE1, CF_00, TEXT_LOOPZ,  SZ_NONE, M_REL8, P_OPR),
-    E2(0xE1, CF_00, TEXT_LOOPZ,  SZ_NONE, M_REL8, M_CX, P_OPR, P_NONE),
-    E1(0xE2, CF_00, TEXT_LOOP,   SZ_NONE, M_REL8, P_OPR),
-    E2(0xE2, CF_00, TEXT_LOOP,   SZ_NONE, M_REL8, M_CX, P_OPR, P_NONE),
-    E1(0xE3, CF_00, TEXT_JCXZ,   SZ_NONE, M_REL8, P_OPR),
+    E1(0xE0, CF_00, flowBranch(TEXT_LOOPNE), SZ_NONE, M_REL8, P_OPR),
+    E2(0xE0, CF_00, flowBranch(TEXT_LOOPNE), SZ_NONE, M_REL8, M_CX, P_OPR, P_NONE),
+    E1(0xE0, CF_00, flowBranch(TEXT_LOOPNZ), SZ_NONE, M_REL8, P_OPR),
+    E2(0xE0, CF_00, flowBranch(TEXT_LOOPNZ), SZ_NONE, M_REL8, M_CX, P_OPR, P_NONE),
+    E1(0xE1, CF_00, flowBranch(TEXT_LOOPE),  SZ_NONE, M_REL8, P_OPR),
+    E2(0xE1, CF_00, flowBranch(TEXT_LOOPE),  SZ_NONE, M_REL8, M_CX, P_OPR, P_NONE),
+    E1(0xE1, CF_00, flowBranch(TEXT_LOOPZ),  SZ_NONE, M_REL8, P_OPR),
+    E2(0xE1, CF_00, flowBranch(TEXT_LOOPZ),  SZ_NONE, M_REL8, M_CX, P_OPR, P_NONE),
+    E1(0xE2, CF_00, flowBranch(TEXT_LOOP),   SZ_NONE, M_REL8, P_OPR),
+    E2(0xE2, CF_00, flowBranch(TEXT_LOOP),   SZ_NONE, M_REL8, M_CX, P_OPR, P_NONE),
+    E1(0xE3, CF_00, flowBranch(TEXT_JCXZ),   SZ_NONE, M_REL8, P_OPR),
     E2(0xE4, CF_00, TEXT_IN,     SZ_BYTE, M_AL,   M_IOA,  P_NONE, P_OPR),
     E2(0xE5, CF_00, TEXT_IN,     SZ_DATA, M_AX,   M_IOA,  P_NONE, P_OPR),
     E2(0xE6, CF_00, TEXT_OUT,    SZ_BYTE, M_IOA,  M_AL,   P_OPR,  P_NONE),
     E2(0xE7, CF_00, TEXT_OUT,    SZ_DATA, M_IOA,  M_AX,   P_OPR,  P_NONE),
-    E1(0xE8, CF_00, TEXT_CALL,   SZ_NONE, M_REL,  P_OPR),
-    E1(0xEB, CF_00, TEXT_JMP,    SZ_NONE, M_REL8, P_OPR),
-    E1(0xE9, CF_00, TEXT_JMP,    SZ_NONE, M_REL,  P_OPR),
-    E1(0xEA, CF_00, TEXT_JMP,    SZ_NONE, M_FAR,  P_OPR),
-    E1(0xEA, CF_00, TEXT_JMPF,   SZ_NONE, M_FAR,  P_OPR),
-    E2(0xEA, CF_00, TEXT_LJMP,   SZ_NONE, M_SEG,  M_OFF,  P_OPR,  P_OPR),
+    E1(0xE8, CF_00, flowBranch(TEXT_CALL), SZ_NONE, M_REL,  P_OPR),
+    E1(0xEB, CF_00, flowJump(TEXT_JMP),    SZ_NONE, M_REL8, P_OPR),
+    E1(0xE9, CF_00, flowJump(TEXT_JMP),    SZ_NONE, M_REL,  P_OPR),
+    E1(0xEA, CF_00, flowJump(TEXT_JMP),    SZ_NONE, M_FAR,  P_OPR),
+    E1(0xEA, CF_00, flowJump(TEXT_JMPF),   SZ_NONE, M_FAR,  P_OPR),
+    E2(0xEA, CF_00, flowJump(TEXT_LJMP),   SZ_NONE, M_SEG,  M_OFF,  P_OPR,  P_OPR),
     E2(0xEC, CF_00, TEXT_IN,     SZ_BYTE, M_AL,   M_DX,   P_NONE, P_NONE),
     E2(0xED, CF_00, TEXT_IN,     SZ_DATA, M_AX,   M_DX,   P_NONE, P_NONE),
     E2(0xEE, CF_00, TEXT_OUT,    SZ_BYTE, M_DX,   M_AL,   P_NONE, P_NONE),
@@ -689,10 +689,10 @@ constexpr Entry T8086_FF[] PROGMEM = {
     E1(030, CF_00, TEXT_CALL,  SZ_NONE, M_FARM, P_OMOD), // FMODE_FAR
     E1(030, CF_00, TEXT_CALLF, SZ_NONE, M_WMEM, P_OMOD), // FMODE_F
     E1(030, CF_00, TEXT_LCALL, SZ_NONE, M_WMEM, P_OMOD), // FMODE_L
-    E1(040, CF_00, TEXT_JMP,   SZ_NONE, M_WMOD, P_OMOD),
-    E1(050, CF_00, TEXT_JMP,   SZ_NONE, M_FARM, P_OMOD), // FMODE_FAR
-    E1(050, CF_00, TEXT_JMPF,  SZ_NONE, M_WMEM, P_OMOD), // FMODE_F
-    E1(050, CF_00, TEXT_LJMP,  SZ_NONE, M_WMEM, P_OMOD), // FMODE_L
+    E1(040, CF_00, flowEnd(TEXT_JMP),  SZ_NONE, M_WMOD, P_OMOD),
+    E1(050, CF_00, flowEnd(TEXT_JMP),  SZ_NONE, M_FARM, P_OMOD), // FMODE_FAR
+    E1(050, CF_00, flowEnd(TEXT_JMPF), SZ_NONE, M_WMEM, P_OMOD), // FMODE_F
+    E1(050, CF_00, flowEnd(TEXT_LJMP), SZ_NONE, M_WMEM, P_OMOD), // FMODE_L
     E1(060, CF_00, TEXT_PUSH,  SZ_WORD, M_WMOD, P_OMOD),
 };
 
@@ -868,11 +868,11 @@ constexpr Entry T80386_00[] PROGMEM = {
     // imm32" in use32. Disasm prefers TEXT_PUSH (with explicit data32) so the
     // existing roundtrip text stays unchanged.
     E1(0x68, CF_00, TEXT_PUSHD, SZ_DWORD, M_WIMM, P_OPR),
-    E2(0xE0, CF_00, TEXT_LOOPNE, SZ_NONE, M_REL8, M_ECX, P_OPR, P_NONE),
-    E2(0xE0, CF_00, TEXT_LOOPNZ, SZ_NONE, M_REL8, M_ECX, P_OPR, P_NONE),
-    E2(0xE1, CF_00, TEXT_LOOPE,  SZ_NONE, M_REL8, M_ECX, P_OPR, P_NONE),
-    E2(0xE1, CF_00, TEXT_LOOPZ,  SZ_NONE, M_REL8, M_ECX, P_OPR, P_NONE),
-    E2(0xE2, CF_00, TEXT_LOOP,   SZ_NONE, M_REL8, M_ECX, P_OPR, P_NONE),
+    E2(0xE0, CF_00, flowBranch(TEXT_LOOPNE), SZ_NONE, M_REL8, M_ECX, P_OPR, P_NONE),
+    E2(0xE0, CF_00, flowBranch(TEXT_LOOPNZ), SZ_NONE, M_REL8, M_ECX, P_OPR, P_NONE),
+    E2(0xE1, CF_00, flowBranch(TEXT_LOOPE),  SZ_NONE, M_REL8, M_ECX, P_OPR, P_NONE),
+    E2(0xE1, CF_00, flowBranch(TEXT_LOOPZ),  SZ_NONE, M_REL8, M_ECX, P_OPR, P_NONE),
+    E2(0xE2, CF_00, flowBranch(TEXT_LOOP),   SZ_NONE, M_REL8, M_ECX, P_OPR, P_NONE),
 };
 
 constexpr uint8_t I80386_00[] PROGMEM = {
@@ -897,10 +897,10 @@ constexpr Entry T80386_FF[] PROGMEM = {
     N1(030, CF_00, TEXT_CALL,  SZ_DATA, M_FARM, P_OMOD),
     E1(030, CF_00, TEXT_CALLF, SZ_DATA, M_WMEM, P_OMOD),
     E1(030, CF_00, TEXT_LCALL, SZ_DATA, M_WMEM, P_OMOD),
-    N1(040, CF_00, TEXT_JMP,   SZ_DATA, M_WMOD, P_OMOD),
-    N1(050, CF_00, TEXT_JMP,   SZ_DATA, M_FARM, P_OMOD),
-    E1(050, CF_00, TEXT_JMPF,  SZ_DATA, M_WMEM, P_OMOD),
-    E1(050, CF_00, TEXT_LJMP,  SZ_DATA, M_WMEM, P_OMOD),
+    N1(040, CF_00, flowEnd(TEXT_JMP),  SZ_DATA, M_WMOD, P_OMOD),
+    N1(050, CF_00, flowEnd(TEXT_JMP),  SZ_DATA, M_FARM, P_OMOD),
+    E1(050, CF_00, flowEnd(TEXT_JMPF), SZ_DATA, M_WMEM, P_OMOD),
+    E1(050, CF_00, flowEnd(TEXT_LJMP), SZ_DATA, M_WMEM, P_OMOD),
     N1(060, CF_00, TEXT_PUSH,  SZ_DATA, M_WMOD, P_OMOD),
 };
 
@@ -925,8 +925,8 @@ constexpr Entry TCODE16_00[] PROGMEM = {
     S0(0xAD, CF_00, TEXT_LODSW, SZ_NONE),
     S1(0xAF, CF_00, TEXT_SCASW, SZ_WORD, M_DMEM),
     S0(0xAF, CF_00, TEXT_SCASW, SZ_NONE),
-    E0(0xCF, CF_00, TEXT_IRET,  SZ_WORD),
-    E1(0xE3, CF_00, TEXT_JCXZ,  SZ_NONE,  M_REL8, P_OPR),
+    E0(0xCF, CF_00, flowEnd(TEXT_IRET),    SZ_WORD),
+    E1(0xE3, CF_00, flowBranch(TEXT_JCXZ), SZ_NONE,  M_REL8, P_OPR),
 };
 
 constexpr Entry TCODE32_00[] PROGMEM = {
@@ -950,8 +950,8 @@ constexpr Entry TCODE32_00[] PROGMEM = {
     S0(0xAD, CF_00, TEXT_LODSD,  SZ_NONE),
     S1(0xAF, CF_00, TEXT_SCASD,  SZ_DWORD, M_DMEM),
     S0(0xAF, CF_00, TEXT_SCASD,  SZ_NONE),
-    E0(0xCF, CF_00, TEXT_IRETD,  SZ_NONE),
-    E1(0xE3, CF_00, TEXT_JECXZ,  SZ_NONE,  M_REL8, P_OPR),
+    E0(0xCF, CF_00, flowEnd(TEXT_IRETD),    SZ_NONE),
+    E1(0xE3, CF_00, flowBranch(TEXT_JECXZ), SZ_NONE,  M_REL8, P_OPR),
 };
 
 constexpr uint8_t ICODE32_00[] PROGMEM = {
@@ -1011,36 +1011,36 @@ constexpr Entry T80386_0F[] PROGMEM = {
     E2(0x23, CF_00, TEXT_MOV,  SZ_DWORD, M_DBGR, M_DREG, P_REG, P_MOD),
     E2(0x24, CF_00, TEXT_MOV,  SZ_DWORD, M_DREG, M_TSTR, P_MOD, P_REG),
     E2(0x26, CF_00, TEXT_MOV,  SZ_DWORD, M_TSTR, M_DREG, P_REG, P_MOD),
-    E1(0x80, CF_00, TEXT_JO,   SZ_NONE, M_REL, P_OPR),
-    E1(0x81, CF_00, TEXT_JNO,  SZ_NONE, M_REL, P_OPR),
-    E1(0x82, CF_00, TEXT_JB,   SZ_NONE, M_REL, P_OPR),
-    E1(0x82, CF_00, TEXT_JC,   SZ_NONE, M_REL, P_OPR),
-    E1(0x82, CF_00, TEXT_JNAE, SZ_NONE, M_REL, P_OPR),
-    E1(0x83, CF_00, TEXT_JAE,  SZ_NONE, M_REL, P_OPR),
-    E1(0x83, CF_00, TEXT_JNB,  SZ_NONE, M_REL, P_OPR),
-    E1(0x83, CF_00, TEXT_JNC,  SZ_NONE, M_REL, P_OPR),
-    E1(0x84, CF_00, TEXT_JE,   SZ_NONE, M_REL, P_OPR),
-    E1(0x84, CF_00, TEXT_JZ,   SZ_NONE, M_REL, P_OPR),
-    E1(0x85, CF_00, TEXT_JNE,  SZ_NONE, M_REL, P_OPR),
-    E1(0x85, CF_00, TEXT_JNZ,  SZ_NONE, M_REL, P_OPR),
-    E1(0x86, CF_00, TEXT_JBE,  SZ_NONE, M_REL, P_OPR),
-    E1(0x86, CF_00, TEXT_JNA,  SZ_NONE, M_REL, P_OPR),
-    E1(0x87, CF_00, TEXT_JA,   SZ_NONE, M_REL, P_OPR),
-    E1(0x87, CF_00, TEXT_JNBE, SZ_NONE, M_REL, P_OPR),
-    E1(0x88, CF_00, TEXT_JS,   SZ_NONE, M_REL, P_OPR),
-    E1(0x89, CF_00, TEXT_JNS,  SZ_NONE, M_REL, P_OPR),
-    E1(0x8A, CF_00, TEXT_JPE,  SZ_NONE, M_REL, P_OPR),
-    E1(0x8A, CF_00, TEXT_JP,   SZ_NONE, M_REL, P_OPR),
-    E1(0x8B, CF_00, TEXT_JPO,  SZ_NONE, M_REL, P_OPR),
-    E1(0x8B, CF_00, TEXT_JNP,  SZ_NONE, M_REL, P_OPR),
-    E1(0x8C, CF_00, TEXT_JL,   SZ_NONE, M_REL, P_OPR),
-    E1(0x8C, CF_00, TEXT_JNGE, SZ_NONE, M_REL, P_OPR),
-    E1(0x8D, CF_00, TEXT_JGE,  SZ_NONE, M_REL, P_OPR),
-    E1(0x8D, CF_00, TEXT_JNL,  SZ_NONE, M_REL, P_OPR),
-    E1(0x8E, CF_00, TEXT_JLE,  SZ_NONE, M_REL, P_OPR),
-    E1(0x8E, CF_00, TEXT_JNG,  SZ_NONE, M_REL, P_OPR),
-    E1(0x8F, CF_00, TEXT_JG,   SZ_NONE, M_REL, P_OPR),
-    E1(0x8F, CF_00, TEXT_JNLE, SZ_NONE, M_REL, P_OPR),
+    E1(0x80, CF_00, flowBranch(TEXT_JO),   SZ_NONE, M_REL, P_OPR),
+    E1(0x81, CF_00, flowBranch(TEXT_JNO),  SZ_NONE, M_REL, P_OPR),
+    E1(0x82, CF_00, flowBranch(TEXT_JB),   SZ_NONE, M_REL, P_OPR),
+    E1(0x82, CF_00, flowBranch(TEXT_JC),   SZ_NONE, M_REL, P_OPR),
+    E1(0x82, CF_00, flowBranch(TEXT_JNAE), SZ_NONE, M_REL, P_OPR),
+    E1(0x83, CF_00, flowBranch(TEXT_JAE),  SZ_NONE, M_REL, P_OPR),
+    E1(0x83, CF_00, flowBranch(TEXT_JNB),  SZ_NONE, M_REL, P_OPR),
+    E1(0x83, CF_00, flowBranch(TEXT_JNC),  SZ_NONE, M_REL, P_OPR),
+    E1(0x84, CF_00, flowBranch(TEXT_JE),   SZ_NONE, M_REL, P_OPR),
+    E1(0x84, CF_00, flowBranch(TEXT_JZ),   SZ_NONE, M_REL, P_OPR),
+    E1(0x85, CF_00, flowBranch(TEXT_JNE),  SZ_NONE, M_REL, P_OPR),
+    E1(0x85, CF_00, flowBranch(TEXT_JNZ),  SZ_NONE, M_REL, P_OPR),
+    E1(0x86, CF_00, flowBranch(TEXT_JBE),  SZ_NONE, M_REL, P_OPR),
+    E1(0x86, CF_00, flowBranch(TEXT_JNA),  SZ_NONE, M_REL, P_OPR),
+    E1(0x87, CF_00, flowBranch(TEXT_JA),   SZ_NONE, M_REL, P_OPR),
+    E1(0x87, CF_00, flowBranch(TEXT_JNBE), SZ_NONE, M_REL, P_OPR),
+    E1(0x88, CF_00, flowBranch(TEXT_JS),   SZ_NONE, M_REL, P_OPR),
+    E1(0x89, CF_00, flowBranch(TEXT_JNS),  SZ_NONE, M_REL, P_OPR),
+    E1(0x8A, CF_00, flowBranch(TEXT_JPE),  SZ_NONE, M_REL, P_OPR),
+    E1(0x8A, CF_00, flowBranch(TEXT_JP),   SZ_NONE, M_REL, P_OPR),
+    E1(0x8B, CF_00, flowBranch(TEXT_JPO),  SZ_NONE, M_REL, P_OPR),
+    E1(0x8B, CF_00, flowBranch(TEXT_JNP),  SZ_NONE, M_REL, P_OPR),
+    E1(0x8C, CF_00, flowBranch(TEXT_JL),   SZ_NONE, M_REL, P_OPR),
+    E1(0x8C, CF_00, flowBranch(TEXT_JNGE), SZ_NONE, M_REL, P_OPR),
+    E1(0x8D, CF_00, flowBranch(TEXT_JGE),  SZ_NONE, M_REL, P_OPR),
+    E1(0x8D, CF_00, flowBranch(TEXT_JNL),  SZ_NONE, M_REL, P_OPR),
+    E1(0x8E, CF_00, flowBranch(TEXT_JLE),  SZ_NONE, M_REL, P_OPR),
+    E1(0x8E, CF_00, flowBranch(TEXT_JNG),  SZ_NONE, M_REL, P_OPR),
+    E1(0x8F, CF_00, flowBranch(TEXT_JG),   SZ_NONE, M_REL, P_OPR),
+    E1(0x8F, CF_00, flowBranch(TEXT_JNLE), SZ_NONE, M_REL, P_OPR),
     E1(0x90, CF_00, TEXT_SETO,   SZ_BYTE, M_BMOD, P_MOD),
     E1(0x91, CF_00, TEXT_SETNO,  SZ_BYTE, M_BMOD, P_MOD),
     E1(0x92, CF_00, TEXT_SETB,   SZ_BYTE, M_BMOD, P_MOD),
@@ -2165,11 +2165,29 @@ void applyTcodePrefix(AsmInsn &insn, const Entry *entry) {
     }
 }
 
+#if !defined(LIBASM_ASM_NOINDEX)
+template <typename CPU_T>
+const entry::NameIndexes<CPU_T, EntryPage, Entry> &nameIndexes(
+        const CPU_T *head, const CPU_T *tail) {
+    static const entry::NameIndexes<CPU_T, EntryPage, Entry> INDEXES{head, tail};
+    return INDEXES;
+}
+#endif
+
+template <typename CPU_T>
+const Entry *searchName(const CPU_T *table, const CPU_T *end, const CPU_T *c, AsmInsn &insn) {
+#if defined(LIBASM_ASM_NOINDEX)
+    return c->searchName(insn, acceptModes);
+#else
+    return c->searchName(insn, nameIndexes(table, end)[c], acceptModes);
+#endif
+}
+
 Error searchName(const CpuSpec &cpuSpec, AsmInsn &insn) {
-    const auto *entry = cpu(cpuSpec.cpu)->searchName(insn, acceptModes);
+    const auto *entry = searchName(ARRAY_RANGE(CPU_TABLE), cpu(cpuSpec.cpu), insn);
 #if !defined(LIBASM_I8086_NOFPU)
     if (insn.getError() == UNKNOWN_INSTRUCTION)
-        entry = fpu(cpuSpec.fpu)->searchName(insn, acceptModes);
+        entry = searchName(ARRAY_RANGE(FPU_TABLE), fpu(cpuSpec.fpu), insn);
 #endif
     applyTcodePrefix(insn, entry);
     if (insn.getError() == UNKNOWN_INSTRUCTION)
@@ -2254,6 +2272,32 @@ bool matchOpCode(DisInsn &insn, const Entry *entry, const EntryPage *page) {
     return opc == entry->readOpCode();
 }
 
+#if !defined(LIBASM_DIS_NOINDEX)
+Config::opcode_t opCodeMask(const Entry *entry, const EntryPage *) {
+    const auto flags = entry->readFlags();
+    auto mask = flags.mask();
+    if (flags.dstPos() == P_OMOD || flags.srcPos() == P_OMOD)
+        mask |= 0307;
+    return mask;
+}
+
+template <typename CPU_T>
+const entry::OpCodeIndexes<CPU_T, EntryPage, Entry> &indexes(const CPU_T *head, const CPU_T *tail) {
+    static const entry::OpCodeIndexes<CPU_T, EntryPage, Entry> INDEXES{head, tail, opCodeMask};
+    return INDEXES;
+}
+#endif
+
+template <typename CPU_T>
+const Entry *searchOpCode(const CPU_T *table, const CPU_T *end, const CPU_T *c, DisInsn &insn,
+        StrBuffer &out) {
+#if defined(LIBASM_DIS_NOINDEX)
+    return c->searchOpCode(insn, out, matchOpCode);
+#else
+    return c->searchOpCode(insn, out, indexes(table, end)[c], matchOpCode);
+#endif
+}
+
 // TCODE16_00 and TCODE32_00 must be parallel arrays: same length, with each
 // TCODE32_00[i] being the 32-bit data form of TCODE16_00[i] (matching opcode).
 static_assert(sizeof(TCODE16_00) == sizeof(TCODE32_00),
@@ -2272,7 +2316,7 @@ const Entry *toData32(const Entry *entry) {
 }
 
 Error searchOpCode(const CpuSpec &cpuSpec, DisInsn &insn, StrBuffer &out) {
-    auto entry = cpu(cpuSpec.cpu)->searchOpCode(insn, out, matchOpCode);
+    auto entry = searchOpCode(ARRAY_RANGE(CPU_TABLE), cpu(cpuSpec.cpu), insn, out);
     if (isData16(entry)) {
         // JCXZ/JECXZ (0xE3) switches based on address size, not data size
         const bool switch32 = (cpuSpec.has32bit() && insn.opCode() == 0xE3)
@@ -2289,7 +2333,7 @@ Error searchOpCode(const CpuSpec &cpuSpec, DisInsn &insn, StrBuffer &out) {
     }
 #if !defined(LIBASM_I8086_NOFPU)
     if (insn.getError() == UNKNOWN_INSTRUCTION)
-        fpu(cpuSpec.fpu)->searchOpCode(insn, out, matchOpCode);
+        searchOpCode(ARRAY_RANGE(FPU_TABLE), fpu(cpuSpec.fpu), insn, out);
 #endif
     return insn.getError();
 }
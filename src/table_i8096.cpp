@@ -44,7 +44,7 @@ constexpr Entry TABLE_00[] PROGMEM = {
     E3(0x40, CF_03, TEXT_AND,   M_WREG,  M_WREG,  M_WAOP),
     E2(0x70, CF_03, TEXT_ANDB,  M_BREG,  M_BAOP),
     E3(0x50, CF_03, TEXT_ANDB,  M_BREG,  M_BREG,  M_BAOP),
-    E1(0xE3, CF_00, TEXT_BR,    M_INDIR),
+    E1(0xE3, CF_00, flowJump(TEXT_BR), M_INDIR),
     E1(0x01, CF_00, TEXT_CLR,   M_WREG),
     E1(0x11, CF_00, TEXT_CLRB,  M_BREG),
     E0(0xF8, CF_00, TEXT_CLRC),
@@ -56,36 +56,36 @@ constexpr Entry TABLE_00[] PROGMEM = {
     E0(0xFA, CF_00, TEXT_DI),
     E2(0x8C, CF_03, TEXT_DIVU,  M_LREG,  M_WAOP),
     E2(0x9C, CF_03, TEXT_DIVUB, M_WREG,  M_BAOP),
-    E2(0xE0, CF_00, TEXT_DJNZ,  M_BREG,  M_REL8),
+    E2(0xE0, CF_00, flowBranch(TEXT_DJNZ), M_BREG,  M_REL8),
     E0(0xFB, CF_00, TEXT_EI),
     E1(0x06, CF_00, TEXT_EXT,   M_LREG),
     E1(0x16, CF_00, TEXT_EXTB,  M_WREG),
     E1(0x07, CF_00, TEXT_INC,   M_WREG),
     E1(0x17, CF_00, TEXT_INCB,  M_BREG),
-    E3(0x30, CF_07, TEXT_JBC,   M_BREG,  M_BITNO, M_REL8),
-    E3(0x38, CF_07, TEXT_JBS,   M_BREG,  M_BITNO, M_REL8),
-    E1(0xDB, CF_00, TEXT_JC,    M_REL8),
-    E1(0xDF, CF_00, TEXT_JE,    M_REL8),
-    E1(0xD6, CF_00, TEXT_JGE,   M_REL8),
-    E1(0xD2, CF_00, TEXT_JGT,   M_REL8),
-    E1(0xD9, CF_00, TEXT_JH,    M_REL8),
-    E1(0xDA, CF_00, TEXT_JLE,   M_REL8),
-    E1(0xDE, CF_00, TEXT_JLT,   M_REL8),
-    E1(0xD3, CF_00, TEXT_JNC,   M_REL8),
-    E1(0xD7, CF_00, TEXT_JNE,   M_REL8),
-    E1(0xD1, CF_00, TEXT_JNH,   M_REL8),
-    E1(0xD0, CF_00, TEXT_JNST,  M_REL8),
-    E1(0xD5, CF_00, TEXT_JNV,   M_REL8),
-    E1(0xD4, CF_00, TEXT_JNVT,  M_REL8),
-    E1(0xD8, CF_00, TEXT_JST,   M_REL8),
-    E1(0xDD, CF_00, TEXT_JV,    M_REL8),
-    E1(0xDC, CF_00, TEXT_JVT,   M_REL8),
-    E1(0xEF, CF_00, TEXT_LCALL, M_REL16),
+    E3(0x30, CF_07, flowBranch(TEXT_JBC),   M_BREG,  M_BITNO, M_REL8),
+    E3(0x38, CF_07, flowBranch(TEXT_JBS),   M_BREG,  M_BITNO, M_REL8),
+    E1(0xDB, CF_00, flowBranch(TEXT_JC),    M_REL8),
+    E1(0xDF, CF_00, flowBranch(TEXT_JE),    M_REL8),
+    E1(0xD6, CF_00, flowBranch(TEXT_JGE),   M_REL8),
+    E1(0xD2, CF_00, flowBranch(TEXT_JGT),   M_REL8),
+    E1(0xD9, CF_00, flowBranch(TEXT_JH),    M_REL8),
+    E1(0xDA, CF_00, flowBranch(TEXT_JLE),   M_REL8),
+    E1(0xDE, CF_00, flowBranch(TEXT_JLT),   M_REL8),
+    E1(0xD3, CF_00, flowBranch(TEXT_JNC),   M_REL8),
+    E1(0xD7, CF_00, flowBranch(TEXT_JNE),   M_REL8),
+    E1(0xD1, CF_00, flowBranch(TEXT_JNH),   M_REL8),
+    E1(0xD0, CF_00, flowBranch(TEXT_JNST),  M_REL8),
+    E1(0xD5, CF_00, flowBranch(TEXT_JNV),   M_REL8),
+    E1(0xD4, CF_00, flowBranch(TEXT_JNVT),  M_REL8),
+    E1(0xD8, CF_00, flowBranch(TEXT_JST),   M_REL8),
+    E1(0xDD, CF_00, flowBranch(TEXT_JV),    M_REL8),
+    E1(0xDC, CF_00, flowBranch(TEXT_JVT),   M_REL8),
+    E1(0xEF, CF_00, flowBranch(TEXT_LCALL), M_REL16),
     E2(0xA0, CF_03, TEXT_LD,    M_WREG,  M_WAOP),
     E2(0xB0, CF_03, TEXT_LDB,   M_BREG,  M_BAOP),
     E2(0xBC, CF_03, TEXT_LDBSE, M_WREG,  M_BAOP),
     E2(0xAC, CF_03, TEXT_LDBZE, M_WREG,  M_BAOP),
-    E1(0xE7, CF_00, TEXT_LJMP,  M_REL16),
+    E1(0xE7, CF_00, flowJump(TEXT_LJMP), M_REL16),
     E2(0x6C, CF_03, TEXT_MULU,  M_LREG,  M_WAOP),
     E3(0x4C, CF_03, TEXT_MULU,  M_LREG,  M_WREG,  M_WAOP),
     E2(0x7C, CF_03, TEXT_MULUB, M_WREG,  M_BAOP),
@@ -103,9 +103,9 @@ constexpr Entry TABLE_00[] PROGMEM = {
     E0(0xF3, CF_00, TEXT_POPF),
     E1(0xC8, CF_03, TEXT_PUSH,  M_WAOP),
     E0(0xF2, CF_00, TEXT_PUSHF),
-    E0(0xF0, CF_00, TEXT_RET),
+    E0(0xF0, CF_00, flowEnd(TEXT_RET)),
     E0(0xFF, CF_00, TEXT_RST),
-    E1(0x28, CF_07, TEXT_SCALL, M_REL11),
+    E1(0x28, CF_07, flowBranch(TEXT_SCALL), M_REL11),
     E0(0xF9, CF_00, TEXT_SETC),
     E2(0x09, CF_00, TEXT_SHL,   M_WREG,  M_COUNT),
     E2(0x19, CF_00, TEXT_SHLB,  M_BREG,  M_COUNT),
@@ -116,7 +116,7 @@ constexpr Entry TABLE_00[] PROGMEM = {
     E2(0x0E, CF_00, TEXT_SHRAL, M_LREG,  M_COUNT),
     E2(0x18, CF_00, TEXT_SHRB,  M_BREG,  M_COUNT),
     E2(0x0C, CF_00, TEXT_SHRL,  M_LREG,  M_COUNT),
-    E1(0x20, CF_07, TEXT_SJMP,  M_REL11),
+    E1(0x20, CF_07, flowJump(TEXT_SJMP), M_REL11),
     E1(0x00, CF_00, TEXT_SKIP,  M_BREG),
     U2(0xC1, CF_00, TEXT_ST,    M_WREG,  M_IMM16), // undefined ST immediate instruction
     E2(0xC0, CF_03, TEXT_ST,    M_WREG,  M_WAOP),
@@ -254,7 +254,7 @@ constexpr uint8_t INDEX_FE[] PROGMEM = {
 constexpr Entry I80196KB_TABLE[] PROGMEM = {
     E2(0xC1, CF_00, TEXT_BMOV,  M_LREG, M_WREG),
     E2(0xC5, CF_00, TEXT_CMPL,  M_LREG, M_LREG),
-    E2(0xE1, CF_00, TEXT_DJNZW, M_WREG, M_REL8),
+    E2(0xE1, CF_00, flowBranch(TEXT_DJNZW), M_WREG, M_REL8),
     E0(0xF4, CF_00, TEXT_PUSHA),
     E0(0xF5, CF_00, TEXT_POPA),
     E1(0xF6, CF_00, TEXT_IDLPD, M_IMM8),
@@ -275,7 +275,7 @@ constexpr Entry I80196KC_TABLE[] PROGMEM = {
     E2(0x14, CF_00, TEXT_XCHB,  M_BREG, M_BREG),
     E2(0x1B, CF_00, TEXT_XCHB,  M_BREG, M_BIDX),
     E2(0xCD, CF_00, TEXT_BMOVI, M_LREG, M_WREG),
-    E3(0xE2, CF_00, TEXT_TIJMP, M_WREG, M_WREG, M_IMM8),
+    E3(0xE2, CF_00, flowEnd(TEXT_TIJMP), M_WREG, M_WREG, M_IMM8),
     E0(0xEC, CF_00, TEXT_DPTS),
     E0(0xED, CF_00, TEXT_EPTS),
 };
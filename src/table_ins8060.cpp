@@ -54,10 +54,10 @@ constexpr Entry TABLE_INS8060[] PROGMEM = {
     E0(0x70, CF_00, TEXT_ADE),
     E0(0x78, CF_00, TEXT_CAE),
     E1(0x8F, CF_00, TEXT_DLY,  M_IMM8),
-    E1(0x90, CF_03, TEXT_JMP,  M_REL8),
-    E1(0x94, CF_03, TEXT_JP,   M_REL8),
-    E1(0x98, CF_03, TEXT_JZ,   M_REL8),
-    E1(0x9C, CF_03, TEXT_JNZ,  M_REL8),
+    E1(0x90, CF_03, flowJump(TEXT_JMP),   M_REL8),
+    E1(0x94, CF_03, flowBranch(TEXT_JP),  M_REL8),
+    E1(0x98, CF_03, flowBranch(TEXT_JZ),  M_REL8),
+    E1(0x9C, CF_03, flowBranch(TEXT_JNZ), M_REL8),
     E1(0xA8, CF_03, TEXT_ILD,  M_DISP),
     E1(0xB8, CF_03, TEXT_DLD,  M_DISP),
     E1(0xC4, CF_00, TEXT_LDI,  M_IMM8),
@@ -48,12 +48,12 @@ constexpr Entry TABLE_INS8070[] PROGMEM = {
     E1(0x0E, CF_00, TEXT_SL,   M_AR,           SZ_BYTE),
     E1(0x0F, CF_00, TEXT_SL,   M_EA,           SZ_WORD),
     E1(0x10, CF_0F, TEXT_CALL, M_VEC,          SZ_NONE),
-    X1(0x20, CF_00, TEXT_JSR,  M_ADR),
+    X1(0x20, CF_00, flowBranch(TEXT_JSR), M_ADR),
     E2(0x22, CF_01, TEXT_PLI,  M_P23,  M_IMM,  SZ_WORD),
-    X1(0x24, CF_00, TEXT_JMP,  M_ADR),
+    X1(0x24, CF_00, flowJump(TEXT_JMP), M_ADR),
     E2(0x24, CF_03, TEXT_LD,   M_PTR,  M_IMM,  SZ_WORD),
     E2(0x2C, CF_00, TEXT_MPY,  M_EA,   M_TR,   SZ_WORD),
-    X1(0x2D, CF_00, TEXT_BND,  M_PCR),
+    X1(0x2D, CF_00, flowBranch(TEXT_BND), M_PCR),
     E1(0x2E, CF_01, TEXT_SSM,  M_P23,          SZ_BYTE),
     E2(0x30, CF_03, TEXT_LD,   M_EA,   M_PTR,  SZ_WORD),
     E1(0x38, CF_00, TEXT_POP,  M_AR,           SZ_BYTE),
@@ -73,19 +73,19 @@ constexpr Entry TABLE_INS8070[] PROGMEM = {
     U1(0x55, CF_00, TEXT_PUSH, M_SP), // undefined PUSH SP
     E1(0x54, CF_03, TEXT_PUSH, M_PTR,          SZ_WORD),
     E2(0x58, CF_00, TEXT_OR,   M_AR,   M_ER,   SZ_BYTE),
-    E0(0x5C, CF_00, TEXT_RET),
+    E0(0x5C, CF_00, flowEnd(TEXT_RET)),
     E1(0x5E, CF_01, TEXT_POP,  M_P23,          SZ_WORD),
     E2(0x60, CF_00, TEXT_XOR,  M_AR,   M_ER,   SZ_BYTE),
-    X1(0x64, CF_00, TEXT_BP,   M_PCR),
-    X1(0x66, CF_01, TEXT_BP,   M_IDX),
-    X1(0x6C, CF_00, TEXT_BZ,   M_PCR),
-    X1(0x6E, CF_01, TEXT_BZ,   M_IDX),
+    X1(0x64, CF_00, flowBranch(TEXT_BP), M_PCR),
+    X1(0x66, CF_01, flowBranch(TEXT_BP), M_IDX),
+    X1(0x6C, CF_00, flowBranch(TEXT_BZ), M_PCR),
+    X1(0x6E, CF_01, flowBranch(TEXT_BZ), M_IDX),
     E2(0x70, CF_00, TEXT_ADD,  M_AR,   M_ER,   SZ_BYTE),
-    X1(0x74, CF_00, TEXT_BRA,  M_PCR),
-    X1(0x76, CF_01, TEXT_BRA,  M_IDX),
+    X1(0x74, CF_00, flowJump(TEXT_BRA), M_PCR),
+    X1(0x76, CF_01, flowJump(TEXT_BRA), M_IDX),
     E2(0x78, CF_00, TEXT_SUB,  M_AR,   M_ER,   SZ_BYTE),
-    X1(0x7C, CF_00, TEXT_BNZ,  M_PCR),
-    X1(0x7E, CF_01, TEXT_BNZ,  M_IDX),
+    X1(0x7C, CF_00, flowBranch(TEXT_BNZ), M_PCR),
+    X1(0x7E, CF_01, flowBranch(TEXT_BNZ), M_IDX),
     E2(0x80, CF_07, TEXT_LD,   M_EA,   M_GEN,  SZ_WORD),
     U2(0x8C, CF_00, TEXT_ST,   M_EA,   M_IMM), // undefined ST EA immediate
     E2(0x88, CF_07, TEXT_ST,   M_EA,   M_GEN,  SZ_WORD),
@@ -49,23 +49,23 @@ constexpr Entry MC6800_TABLE[] PROGMEM = {
     E0(0x17, CF_00, TEXT_TBA),
     E0(0x19, CF_00, TEXT_DAA),
     E0(0x1B, CF_00, TEXT_ABA),
-    E1(0x20, CF_00, TEXT_BRA,  M_REL),
-    E1(0x22, CF_00, TEXT_BHI,  M_REL),
-    E1(0x23, CF_00, TEXT_BLS,  M_REL),
-    E1(0x24, CF_00, TEXT_BHS,  M_REL),
-    E1(0x24, CF_00, TEXT_BCC,  M_REL),
-    E1(0x25, CF_00, TEXT_BLO,  M_REL),
-    E1(0x25, CF_00, TEXT_BCS,  M_REL),
-    E1(0x26, CF_00, TEXT_BNE,  M_REL),
-    E1(0x27, CF_00, TEXT_BEQ,  M_REL),
-    E1(0x28, CF_00, TEXT_BVC,  M_REL),
-    E1(0x29, CF_00, TEXT_BVS,  M_REL),
-    E1(0x2A, CF_00, TEXT_BPL,  M_REL),
-    E1(0x2B, CF_00, TEXT_BMI,  M_REL),
-    E1(0x2C, CF_00, TEXT_BGE,  M_REL),
-    E1(0x2D, CF_00, TEXT_BLT,  M_REL),
-    E1(0x2E, CF_00, TEXT_BGT,  M_REL),
-    E1(0x2F, CF_00, TEXT_BLE,  M_REL),
+    E1(0x20, CF_00, flowJump(TEXT_BRA),   M_REL),
+    E1(0x22, CF_00, flowBranch(TEXT_BHI), M_REL),
+    E1(0x23, CF_00, flowBranch(TEXT_BLS), M_REL),
+    E1(0x24, CF_00, flowBranch(TEXT_BHS), M_REL),
+    E1(0x24, CF_00, flowBranch(TEXT_BCC), M_REL),
+    E1(0x25, CF_00, flowBranch(TEXT_BLO), M_REL),
+    E1(0x25, CF_00, flowBranch(TEXT_BCS), M_REL),
+    E1(0x26, CF_00, flowBranch(TEXT_BNE), M_REL),
+    E1(0x27, CF_00, flowBranch(TEXT_BEQ), M_REL),
+    E1(0x28, CF_00, flowBranch(TEXT_BVC), M_REL),
+    E1(0x29, CF_00, flowBranch(TEXT_BVS), M_REL),
+    E1(0x2A, CF_00, flowBranch(TEXT_BPL), M_REL),
+    E1(0x2B, CF_00, flowBranch(TEXT_BMI), M_REL),
+    E1(0x2C, CF_00, flowBranch(TEXT_BGE), M_REL),
+    E1(0x2D, CF_00, flowBranch(TEXT_BLT), M_REL),
+    E1(0x2E, CF_00, flowBranch(TEXT_BGT), M_REL),
+    E1(0x2F, CF_00, flowBranch(TEXT_BLE), M_REL),
     E0(0x30, CF_00, TEXT_TSX),
     E0(0x31, CF_00, TEXT_INS),
     E0(0x32, CF_00, TEXT_PULA),
@@ -74,8 +74,8 @@ constexpr Entry MC6800_TABLE[] PROGMEM = {
     E0(0x35, CF_00, TEXT_TXS),
     E0(0x36, CF_00, TEXT_PSHA),
     E0(0x37, CF_00, TEXT_PSHB),
-    E0(0x39, CF_00, TEXT_RTS),
-    E0(0x3B, CF_00, TEXT_RTI),
+    E0(0x39, CF_00, flowEnd(TEXT_RTS)),
+    E0(0x3B, CF_00, flowEnd(TEXT_RTI)),
     E0(0x3E, CF_00, TEXT_WAI),
     E0(0x3F, CF_00, TEXT_SWI),
     E0(0x40, CF_00, TEXT_NEGA),
@@ -113,7 +113,7 @@ constexpr Entry MC6800_TABLE[] PROGMEM = {
     E1(0x6A, CF_10, TEXT_DEC,  M_GMEM),
     E1(0x6C, CF_10, TEXT_INC,  M_GMEM),
     E1(0x6D, CF_10, TEXT_TST,  M_GMEM),
-    E1(0x6E, CF_10, TEXT_JMP,  M_GMEM),
+    E1(0x6E, CF_10, flowJump(TEXT_JMP), M_GMEM),
     E1(0x6F, CF_10, TEXT_CLR,  M_GMEM),
     E1(0x80, CF_30, TEXT_SUBA, M_GN8),
     E1(0xC0, CF_30, TEXT_SUBB, M_GN8),
@@ -142,13 +142,13 @@ constexpr Entry MC6800_TABLE[] PROGMEM = {
     E1(0x8B, CF_30, TEXT_ADDA, M_GN8),
     E1(0xCB, CF_30, TEXT_ADDB, M_GN8),
     E1(0x8C, CF_30, TEXT_CPX,  M_GN16),
-    E1(0x8D, CF_00, TEXT_BSR,  M_REL),
+    E1(0x8D, CF_00, flowBranch(TEXT_BSR), M_REL),
     E1(0x8E, CF_30, TEXT_LDS,  M_GN16),
     E1(0x9F, CF_00, TEXT_STS,  M_DIR),
     E1(0xAF, CF_00, TEXT_STS,  M_IDX),
     E1(0xBF, CF_00, TEXT_STS,  M_EXT),
-    E1(0xAD, CF_00, TEXT_JSR,  M_IDX),
-    E1(0xBD, CF_00, TEXT_JSR,  M_EXT),
+    E1(0xAD, CF_00, flowBranch(TEXT_JSR), M_IDX),
+    E1(0xBD, CF_00, flowBranch(TEXT_JSR), M_EXT),
     E1(0xCE, CF_30, TEXT_LDX,  M_GN16),
     E1(0xDF, CF_00, TEXT_STX,  M_DIR),
     E1(0xEF, CF_00, TEXT_STX,  M_IDX),
@@ -307,7 +307,7 @@ constexpr Entry MC6801_TABLE[] PROGMEM = {
     E0(0x3C, CF_00, TEXT_PSHX),
     E0(0x3D, CF_00, TEXT_MUL),
     E1(0x83, CF_30, TEXT_SUBD, M_GN16),
-    E1(0x9D, CF_00, TEXT_JSR,  M_DIR),
+    E1(0x9D, CF_00, flowBranch(TEXT_JSR), M_DIR),
     E1(0xC3, CF_30, TEXT_ADDD, M_GN16),
     E1(0xCC, CF_30, TEXT_LDD,  M_GN16),
     E1(0xDD, CF_00, TEXT_STD,  M_DIR),
@@ -378,14 +378,14 @@ constexpr uint8_t HD6301_INDEX[] PROGMEM = {
 constexpr Entry MC68HC11_P00[] PROGMEM = {
     E0(0x02, CF_00, TEXT_IDIV),
     E0(0x03, CF_00, TEXT_FDIV),
-    E3(0x12, CF_00, TEXT_BRSET, M_DIR, M_IM8, M_REL),
-    E3(0x13, CF_00, TEXT_BRCLR, M_DIR, M_IM8, M_REL),
+    E3(0x12, CF_00, flowBranch(TEXT_BRSET), M_DIR, M_IM8, M_REL),
+    E3(0x13, CF_00, flowBranch(TEXT_BRCLR), M_DIR, M_IM8, M_REL),
     E2(0x14, CF_00, TEXT_BSET,  M_DIR, M_IM8),
     E2(0x15, CF_00, TEXT_BCLR,  M_DIR, M_IM8),
     E2(0x1C, CF_00, TEXT_BSET,  M_IDX, M_IM8),
     E2(0x1D, CF_00, TEXT_BCLR,  M_IDX, M_IM8),
-    E3(0x1E, CF_00, TEXT_BRSET, M_IDX, M_IM8, M_REL),
-    E3(0x1F, CF_00, TEXT_BRCLR, M_IDX, M_IM8, M_REL),
+    E3(0x1E, CF_00, flowBranch(TEXT_BRSET), M_IDX, M_IM8, M_REL),
+    E3(0x1F, CF_00, flowBranch(TEXT_BRCLR), M_IDX, M_IM8, M_REL),
     E0(0x8F, CF_00, TEXT_XGDX),
     E0(0xCF, CF_00, TEXT_STOP),
 };
@@ -410,8 +410,8 @@ constexpr Entry MC68HC11_P18[] PROGMEM = {
     E0(0x09, CF_00, TEXT_DEY),
     E2(0x1C, CF_00, TEXT_BSET,  M_IDY, M_IM8),
     E2(0x1D, CF_00, TEXT_BCLR,  M_IDY, M_IM8),
-    E3(0x1E, CF_00, TEXT_BRSET, M_IDY, M_IM8, M_REL),
-    E3(0x1F, CF_00, TEXT_BRCLR, M_IDY, M_IM8, M_REL),
+    E3(0x1E, CF_00, flowBranch(TEXT_BRSET), M_IDY, M_IM8, M_REL),
+    E3(0x1F, CF_00, flowBranch(TEXT_BRCLR), M_IDY, M_IM8, M_REL),
     E0(0x30, CF_00, TEXT_TSY),
     E0(0x35, CF_00, TEXT_TYS),
     E0(0x38, CF_00, TEXT_PULY),
@@ -428,7 +428,7 @@ constexpr Entry MC68HC11_P18[] PROGMEM = {
     E1(0x6A, CF_00, TEXT_DEC,   M_IDY),
     E1(0x6C, CF_00, TEXT_INC,   M_IDY),
     E1(0x6D, CF_00, TEXT_TST,   M_IDY),
-    E1(0x6E, CF_00, TEXT_JMP,   M_IDY),
+    E1(0x6E, CF_00, flowJump(TEXT_JMP), M_IDY),
     E1(0x6F, CF_00, TEXT_CLR,   M_IDY),
     E1(0x8C, CF_00, TEXT_CPY,   M_IM16),
     E0(0x8F, CF_00, TEXT_XGDY),
@@ -458,7 +458,7 @@ constexpr Entry MC68HC11_P18[] PROGMEM = {
     E1(0xAB, CF_00, TEXT_ADDA,  M_IDY),
     E1(0xEB, CF_00, TEXT_ADDB,  M_IDY),
     E1(0xAC, CF_00, TEXT_CPY,   M_IDY),
-    E1(0xAD, CF_00, TEXT_JSR,   M_IDY),
+    E1(0xAD, CF_00, flowBranch(TEXT_JSR), M_IDY),
     E1(0xAE, CF_00, TEXT_LDS,   M_IDY),
     E1(0xAF, CF_00, TEXT_STS,   M_IDY),
     E1(0xBC, CF_00, TEXT_CPY,   M_EXT),
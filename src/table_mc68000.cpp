@@ -123,35 +123,35 @@ constexpr Entry MC68000_TABLE[] PROGMEM = {
     E0(0047160, TEXT_RESET),
     E0(0047161, TEXT_NOP),
     E1(0047162, TEXT_STOP,  ISZ_NONE, M_IMDAT, OP___, SZ_WORD, CF_0000),
-    E0(0047163, TEXT_RTE),
-    E0(0047165, TEXT_RTS),
+    E0(0047163, flowEnd(TEXT_RTE)),
+    E0(0047165, flowEnd(TEXT_RTS)),
     E0(0047166, TEXT_TRAPV),
-    E0(0047167, TEXT_RTR),
-    E1(0047200, TEXT_JSR,   ISZ_NONE, M_JADDR, OP_10, SZ_WORD, CF_0077),
-    E1(0047300, TEXT_JMP,   ISZ_NONE, M_JADDR, OP_10, SZ_WORD, CF_0077),
+    E0(0047167, flowEnd(TEXT_RTR)),
+    E1(0047200, flowBranch(TEXT_JSR), ISZ_NONE, M_JADDR, OP_10, SZ_WORD, CF_0077),
+    E1(0047300, flowJump(TEXT_JMP),   ISZ_NONE, M_JADDR, OP_10, SZ_WORD, CF_0077),
     E2(0044200, TEXT_MOVEM, ISZ_DATA, M_MULT,  M_DADDR, OP___, OP_10, SZ_ADDR, CF_0177),
     E2(0046200, TEXT_MOVEM, ISZ_DATA, M_IADDR, M_MULT,  OP_10, OP___, SZ_ADDR, CF_0177),
     E2(0040700, TEXT_LEA,   ISZ_NONE, M_JADDR, M_AREG,  OP_10, OP__3, SZ_LONG, CF_7077),
     E2(0040600, TEXT_CHK,   ISZ_WORD, M_RDATA, M_DREG,  OP_10, OP__3, SZ_WORD, CF_7077),
     E2(0050310, TEXT_DBT,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0050710, TEXT_DBRA,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0050710, TEXT_DBF,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0051310, TEXT_DBHI,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0051710, TEXT_DBLS,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0052310, TEXT_DBCC,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0052310, TEXT_DBHS,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0052710, TEXT_DBCS,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0052710, TEXT_DBLO,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0053310, TEXT_DBNE,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0053710, TEXT_DBEQ,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0054310, TEXT_DBVC,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0054710, TEXT_DBVS,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0055310, TEXT_DBPL,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0055710, TEXT_DBMI,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0056310, TEXT_DBGE,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0056710, TEXT_DBLT,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0057310, TEXT_DBGT,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
-    E2(0057710, TEXT_DBLE,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0050710, flowBranch(TEXT_DBRA), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0050710, flowBranch(TEXT_DBF),  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0051310, flowBranch(TEXT_DBHI), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0051710, flowBranch(TEXT_DBLS), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0052310, flowBranch(TEXT_DBCC), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0052310, flowBranch(TEXT_DBHS), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0052710, flowBranch(TEXT_DBCS), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0052710, flowBranch(TEXT_DBLO), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0053310, flowBranch(TEXT_DBNE), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0053710, flowBranch(TEXT_DBEQ), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0054310, flowBranch(TEXT_DBVC), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0054710, flowBranch(TEXT_DBVS), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0055310, flowBranch(TEXT_DBPL), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0055710, flowBranch(TEXT_DBMI), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0056310, flowBranch(TEXT_DBGE), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0056710, flowBranch(TEXT_DBLT), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0057310, flowBranch(TEXT_DBGT), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
+    E2(0057710, flowBranch(TEXT_DBLE), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007),
     E1(0050300, TEXT_ST,    ISZ_NONE, M_WDATA, OP_10, SZ_BYTE, CF_0077),
     E1(0050700, TEXT_SF,    ISZ_NONE, M_WDATA, OP_10, SZ_BYTE, CF_0077),
     E1(0051300, TEXT_SHI,   ISZ_NONE, M_WDATA, OP_10, SZ_BYTE, CF_0077),
@@ -172,25 +172,25 @@ constexpr Entry MC68000_TABLE[] PROGMEM = {
     E1(0057700, TEXT_SLE,   ISZ_NONE, M_WDATA, OP_10, SZ_BYTE, CF_0077),
     E2(0050000, TEXT_ADDQ,  ISZ_DATA, M_IM3,   M_WADDR, OP__3, OP_10, SZ_DATA, CF_7377),
     E2(0050400, TEXT_SUBQ,  ISZ_DATA, M_IM3,   M_WADDR, OP__3, OP_10, SZ_DATA, CF_7377),
-    E1(0060000, TEXT_BRA,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0060000, TEXT_BT,    ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0060400, TEXT_BSR,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0061000, TEXT_BHI,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0061400, TEXT_BLS,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0062000, TEXT_BCC,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0062000, TEXT_BHS,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0062400, TEXT_BCS,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0062400, TEXT_BLO,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0063000, TEXT_BNE,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0063400, TEXT_BEQ,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0064000, TEXT_BVC,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0064400, TEXT_BVS,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0065000, TEXT_BPL,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0065400, TEXT_BMI,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0066000, TEXT_BGE,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0066400, TEXT_BLT,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0067000, TEXT_BGT,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
-    E1(0067400, TEXT_BLE,   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0060000, flowJump(TEXT_BRA),   ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0060000, flowJump(TEXT_BT),    ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0060400, flowBranch(TEXT_BSR), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0061000, flowBranch(TEXT_BHI), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0061400, flowBranch(TEXT_BLS), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0062000, flowBranch(TEXT_BCC), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0062000, flowBranch(TEXT_BHS), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0062400, flowBranch(TEXT_BCS), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0062400, flowBranch(TEXT_BLO), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0063000, flowBranch(TEXT_BNE), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0063400, flowBranch(TEXT_BEQ), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0064000, flowBranch(TEXT_BVC), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0064400, flowBranch(TEXT_BVS), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0065000, flowBranch(TEXT_BPL), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0065400, flowBranch(TEXT_BMI), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0066000, flowBranch(TEXT_BGE), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0066400, flowBranch(TEXT_BLT), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0067000, flowBranch(TEXT_BGT), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
+    E1(0067400, flowBranch(TEXT_BLE), ISZ_NONE, M_REL8,  OP___, SZ_BYTE, CF_0377),
     E2(0070000, TEXT_MOVEQ, ISZ_NONE, M_IM8,   M_DREG,  OP___, OP__3, SZ_LONG, CF_7377),
     E2(0100300, TEXT_DIVU,  ISZ_DATA, M_RDATA, M_DREG,  OP_10, OP__3, SZ_WORD, CF_7077),
     E2(0100700, TEXT_DIVS,  ISZ_DATA, M_RDATA, M_DREG,  OP_10, OP__3, SZ_WORD, CF_7077),
@@ -441,7 +441,7 @@ constexpr uint8_t MC68000_INDEX[] PROGMEM = {
 constexpr Entry MC68010_TABLE[] PROGMEM = {
     E1(0044110, TEXT_BKPT,  ISZ_NONE, M_IM3,   OP__0, SZ_NONE, CF_0007),
     E2(0041300, TEXT_MOVE,  ISZ_FIXD, M_CCR,   M_WDATA, OP___, OP_10, SZ_WORD, CF_0077),
-    E1(0047164, TEXT_RTD,   ISZ_NONE, M_IMDAT, OP___, SZ_WORD, CF_0000),
+    E1(0047164, flowEnd(TEXT_RTD), ISZ_NONE, M_IMDAT, OP___, SZ_WORD, CF_0000),
     X2(0047172, TEXT_MOVEC, ISZ_NONE, M_CREG,  M_GREG,  EX_RC, EX_GR, SZ_LONG, CF_0000, 0x0000, PF_FFFF),
     X2(0047173, TEXT_MOVEC, ISZ_NONE, M_GREG,  M_CREG,  EX_GR, EX_RC, SZ_LONG, CF_0000, 0x0000, PF_FFFF),
     X2(0007000, TEXT_MOVES, ISZ_DATA, M_WMEM,  M_GREG,  OP_10, EX_GR, SZ_DATA, CF_0377, 0x0000, PF_F000),
@@ -629,9 +629,9 @@ constexpr uint8_t MC68020_INDEX[] PROGMEM = {
 };
 
 constexpr Entry MC68020_MODULE[] PROGMEM = {
-    E2(0003300, TEXT_CALLM,  ISZ_NONE, M_IMDAT, M_JADDR, OP___, OP_10, SZ_BYTE, CF_0077),
-    E1(0003310, TEXT_RTM,    ISZ_NONE, M_AREG,  OP__0, SZ_NONE, CF_0007),
-    E1(0003300, TEXT_RTM,    ISZ_NONE, M_DREG,  OP__0, SZ_NONE, CF_0007),
+    E2(0003300, flowBranch(TEXT_CALLM), ISZ_NONE, M_IMDAT, M_JADDR, OP___, OP_10, SZ_BYTE, CF_0077),
+    E1(0003310, flowEnd(TEXT_RTM),      ISZ_NONE, M_AREG,  OP__0, SZ_NONE, CF_0007),
+    E1(0003300, flowEnd(TEXT_RTM),      ISZ_NONE, M_DREG,  OP__0, SZ_NONE, CF_0007),
 };
 
 constexpr uint8_t MC68020_MODULE_INDEX[] PROGMEM = {
@@ -949,68 +949,68 @@ constexpr uint8_t MC68881_INDEX[] PROGMEM = {
 constexpr Entry FPU_BRANCH[] PROGMEM = {
     E1(0xF280, TEXT_FBF,      ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
     X0(0xF280, TEXT_FNOP,     CF_0000,  0x0000,  PF_0000),
-    E1(0xF281, TEXT_FBEQ,     ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF282, TEXT_FBOGT,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF283, TEXT_FBOGE,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF284, TEXT_FBOLT,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF285, TEXT_FBOLE,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF286, TEXT_FBOGL,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF287, TEXT_FBOR,     ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF288, TEXT_FBUN,     ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF289, TEXT_FBUEQ,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF28A, TEXT_FBUGT,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF28B, TEXT_FBUGE,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF28C, TEXT_FBULT,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF28D, TEXT_FBULE,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF28E, TEXT_FBNE,     ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF28F, TEXT_FBT,      ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF281, flowBranch(TEXT_FBEQ),  ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF282, flowBranch(TEXT_FBOGT), ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF283, flowBranch(TEXT_FBOGE), ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF284, flowBranch(TEXT_FBOLT), ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF285, flowBranch(TEXT_FBOLE), ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF286, flowBranch(TEXT_FBOGL), ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF287, flowBranch(TEXT_FBOR),  ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF288, flowBranch(TEXT_FBUN),  ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF289, flowBranch(TEXT_FBUEQ), ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF28A, flowBranch(TEXT_FBUGT), ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF28B, flowBranch(TEXT_FBUGE), ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF28C, flowBranch(TEXT_FBULT), ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF28D, flowBranch(TEXT_FBULE), ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF28E, flowBranch(TEXT_FBNE),  ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF28F, flowJump(TEXT_FBT),     ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
     E1(0xF290, TEXT_FBSF,     ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF291, TEXT_FBSEQ,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF292, TEXT_FBGT,     ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF293, TEXT_FBGE,     ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF294, TEXT_FBLT,     ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF295, TEXT_FBLE,     ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF296, TEXT_FBGL,     ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF297, TEXT_FBGLE,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF298, TEXT_FBNGLE,   ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF299, TEXT_FBNGL,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF29A, TEXT_FBNLE,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF29B, TEXT_FBNLT,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF29C, TEXT_FBNGE,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF29D, TEXT_FBNGT,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF29E, TEXT_FBSNE,    ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    E1(0xF29F, TEXT_FBST,     ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
-    P2(0xF248, TEXT_FDBF,     ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0000),
-    P2(0xF248, TEXT_FDBEQ,    ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0001),
-    P2(0xF248, TEXT_FDBOGT,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0002),
-    P2(0xF248, TEXT_FDBOGE,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0003),
-    P2(0xF248, TEXT_FDBOLT,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0004),
-    P2(0xF248, TEXT_FDBOLE,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0005),
-    P2(0xF248, TEXT_FDBOGL,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0006),
-    P2(0xF248, TEXT_FDBOR,    ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0007),
-    P2(0xF248, TEXT_FDBUN,    ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0008),
-    P2(0xF248, TEXT_FDBUEQ,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0009),
-    P2(0xF248, TEXT_FDBUGT,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000A),
-    P2(0xF248, TEXT_FDBUGE,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000B),
-    P2(0xF248, TEXT_FDBULT,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000C),
-    P2(0xF248, TEXT_FDBULE,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000D),
-    P2(0xF248, TEXT_FDBNE,    ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000E),
+    E1(0xF291, flowBranch(TEXT_FBSEQ),  ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF292, flowBranch(TEXT_FBGT),   ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF293, flowBranch(TEXT_FBGE),   ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF294, flowBranch(TEXT_FBLT),   ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF295, flowBranch(TEXT_FBLE),   ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF296, flowBranch(TEXT_FBGL),   ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF297, flowBranch(TEXT_FBGLE),  ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF298, flowBranch(TEXT_FBNGLE), ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF299, flowBranch(TEXT_FBNGL),  ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF29A, flowBranch(TEXT_FBNLE),  ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF29B, flowBranch(TEXT_FBNLT),  ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF29C, flowBranch(TEXT_FBNGE),  ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF29D, flowBranch(TEXT_FBNGT),  ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF29E, flowBranch(TEXT_FBSNE),  ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    E1(0xF29F, flowJump(TEXT_FBST),     ISZ_NONE, M_REL32, OP___, SZ_LONG, CF_0100),
+    P2(0xF248, flowBranch(TEXT_FDBF),   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0000),
+    P2(0xF248, flowBranch(TEXT_FDBEQ),  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0001),
+    P2(0xF248, flowBranch(TEXT_FDBOGT), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0002),
+    P2(0xF248, flowBranch(TEXT_FDBOGE), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0003),
+    P2(0xF248, flowBranch(TEXT_FDBOLT), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0004),
+    P2(0xF248, flowBranch(TEXT_FDBOLE), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0005),
+    P2(0xF248, flowBranch(TEXT_FDBOGL), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0006),
+    P2(0xF248, flowBranch(TEXT_FDBOR),  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0007),
+    P2(0xF248, flowBranch(TEXT_FDBUN),  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0008),
+    P2(0xF248, flowBranch(TEXT_FDBUEQ), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0009),
+    P2(0xF248, flowBranch(TEXT_FDBUGT), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000A),
+    P2(0xF248, flowBranch(TEXT_FDBUGE), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000B),
+    P2(0xF248, flowBranch(TEXT_FDBULT), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000C),
+    P2(0xF248, flowBranch(TEXT_FDBULE), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000D),
+    P2(0xF248, flowBranch(TEXT_FDBNE),  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000E),
     P2(0xF248, TEXT_FDBT,     ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000F),
-    P2(0xF248, TEXT_FDBSF,    ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0010),
-    P2(0xF248, TEXT_FDBSEQ,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0011),
-    P2(0xF248, TEXT_FDBGT,    ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0012),
-    P2(0xF248, TEXT_FDBGE,    ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0013),
-    P2(0xF248, TEXT_FDBLT,    ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0014),
-    P2(0xF248, TEXT_FDBLE,    ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0015),
-    P2(0xF248, TEXT_FDBGL,    ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0016),
-    P2(0xF248, TEXT_FDBGLE,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0017),
-    P2(0xF248, TEXT_FDBNGLE,  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0018),
-    P2(0xF248, TEXT_FDBNGL,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0019),
-    P2(0xF248, TEXT_FDBNLE,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x001A),
-    P2(0xF248, TEXT_FDBNLT,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x001B),
-    P2(0xF248, TEXT_FDBNGE,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x001C),
-    P2(0xF248, TEXT_FDBNGT,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x001D),
-    P2(0xF248, TEXT_FDBSNE,   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x001E),
+    P2(0xF248, flowBranch(TEXT_FDBSF),   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0010),
+    P2(0xF248, flowBranch(TEXT_FDBSEQ),  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0011),
+    P2(0xF248, flowBranch(TEXT_FDBGT),   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0012),
+    P2(0xF248, flowBranch(TEXT_FDBGE),   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0013),
+    P2(0xF248, flowBranch(TEXT_FDBLT),   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0014),
+    P2(0xF248, flowBranch(TEXT_FDBLE),   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0015),
+    P2(0xF248, flowBranch(TEXT_FDBGL),   ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0016),
+    P2(0xF248, flowBranch(TEXT_FDBGLE),  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0017),
+    P2(0xF248, flowBranch(TEXT_FDBNGLE), ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0018),
+    P2(0xF248, flowBranch(TEXT_FDBNGL),  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0019),
+    P2(0xF248, flowBranch(TEXT_FDBNLE),  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x001A),
+    P2(0xF248, flowBranch(TEXT_FDBNLT),  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x001B),
+    P2(0xF248, flowBranch(TEXT_FDBNGE),  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x001C),
+    P2(0xF248, flowBranch(TEXT_FDBNGT),  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x001D),
+    P2(0xF248, flowBranch(TEXT_FDBSNE),  ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x001E),
     P2(0xF248, TEXT_FDBST,    ISZ_NONE, M_DREG,  M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x001F),
 };
 
@@ -1513,38 +1513,38 @@ constexpr uint8_t MC68851_INDEX[] PROGMEM = {
 };
 
 constexpr Entry MC68851_BRANCH[] PROGMEM = {
-    E1(0xF080, TEXT_PBBS,  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
-    E1(0xF081, TEXT_PBBC,  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
-    E1(0xF082, TEXT_PBLS,  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
-    E1(0xF083, TEXT_PBLC,  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
-    E1(0xF084, TEXT_PBSS,  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
-    E1(0xF085, TEXT_PBSC,  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
-    E1(0xF086, TEXT_PBAS,  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
-    E1(0xF087, TEXT_PBAC,  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
-    E1(0xF088, TEXT_PBWS,  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
-    E1(0xF089, TEXT_PBWC,  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
-    E1(0xF08A, TEXT_PBIS,  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
-    E1(0xF08B, TEXT_PBIC,  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
-    E1(0xF08C, TEXT_PBGS,  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
-    E1(0xF08D, TEXT_PBGC,  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
-    E1(0xF08E, TEXT_PBCS,  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
-    E1(0xF08F, TEXT_PBCC,  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
-    P2(0xF048, TEXT_PDBBS, ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0000),
-    P2(0xF048, TEXT_PDBBC, ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0001),
-    P2(0xF048, TEXT_PDBLS, ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0002),
-    P2(0xF048, TEXT_PDBLC, ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0003),
-    P2(0xF048, TEXT_PDBSS, ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0004),
-    P2(0xF048, TEXT_PDBSC, ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0005),
-    P2(0xF048, TEXT_PDBAS, ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0006),
-    P2(0xF048, TEXT_PDBAC, ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0007),
-    P2(0xF048, TEXT_PDBWS, ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0008),
-    P2(0xF048, TEXT_PDBWC, ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0009),
-    P2(0xF048, TEXT_PDBIS, ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000A),
-    P2(0xF048, TEXT_PDBIC, ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000B),
-    P2(0xF048, TEXT_PDBGS, ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000C),
-    P2(0xF048, TEXT_PDBGC, ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000D),
-    P2(0xF048, TEXT_PDBCS, ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000E),
-    P2(0xF048, TEXT_PDBCC, ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000F),
+    E1(0xF080, flowBranch(TEXT_PBBS),  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
+    E1(0xF081, flowBranch(TEXT_PBBC),  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
+    E1(0xF082, flowBranch(TEXT_PBLS),  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
+    E1(0xF083, flowBranch(TEXT_PBLC),  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
+    E1(0xF084, flowBranch(TEXT_PBSS),  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
+    E1(0xF085, flowBranch(TEXT_PBSC),  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
+    E1(0xF086, flowBranch(TEXT_PBAS),  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
+    E1(0xF087, flowBranch(TEXT_PBAC),  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
+    E1(0xF088, flowBranch(TEXT_PBWS),  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
+    E1(0xF089, flowBranch(TEXT_PBWC),  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
+    E1(0xF08A, flowBranch(TEXT_PBIS),  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
+    E1(0xF08B, flowBranch(TEXT_PBIC),  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
+    E1(0xF08C, flowBranch(TEXT_PBGS),  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
+    E1(0xF08D, flowBranch(TEXT_PBGC),  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
+    E1(0xF08E, flowBranch(TEXT_PBCS),  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
+    E1(0xF08F, flowBranch(TEXT_PBCC),  ISZ_NONE, M_REL32, OP___ ,SZ_LONG, CF_0100),
+    P2(0xF048, flowBranch(TEXT_PDBBS), ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0000),
+    P2(0xF048, flowBranch(TEXT_PDBBC), ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0001),
+    P2(0xF048, flowBranch(TEXT_PDBLS), ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0002),
+    P2(0xF048, flowBranch(TEXT_PDBLC), ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0003),
+    P2(0xF048, flowBranch(TEXT_PDBSS), ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0004),
+    P2(0xF048, flowBranch(TEXT_PDBSC), ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0005),
+    P2(0xF048, flowBranch(TEXT_PDBAS), ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0006),
+    P2(0xF048, flowBranch(TEXT_PDBAC), ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0007),
+    P2(0xF048, flowBranch(TEXT_PDBWS), ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0008),
+    P2(0xF048, flowBranch(TEXT_PDBWC), ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x0009),
+    P2(0xF048, flowBranch(TEXT_PDBIS), ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000A),
+    P2(0xF048, flowBranch(TEXT_PDBIC), ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000B),
+    P2(0xF048, flowBranch(TEXT_PDBGS), ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000C),
+    P2(0xF048, flowBranch(TEXT_PDBGC), ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000D),
+    P2(0xF048, flowBranch(TEXT_PDBCS), ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000E),
+    P2(0xF048, flowBranch(TEXT_PDBCC), ISZ_NONE, M_DREG, M_REL16, OP__0, OP___, SZ_WORD, CF_0007, 0x000F),
 };
 
 constexpr uint8_t MC68851_BRANCH_INDEX[] PROGMEM = {
@@ -1949,15 +1949,38 @@ const Pmmu *pmmu(PmmuType pmmuType) {
 }
 #endif
 
+#if !defined(LIBASM_ASM_NOINDEX)
+template <typename CPU_T>
+const entry::NameIndexes<CPU_T, EntryPage, Entry> &nameIndexes(
+        const CPU_T *head, const CPU_T *tail) {
+    static const entry::NameIndexes<CPU_T, EntryPage, Entry> INDEXES{head, tail};
+    return INDEXES;
+}
+#endif
+
+template <typename CPU_T>
+const Entry *searchName(const CPU_T *table, const CPU_T *end, const CPU_T *c, AsmInsn &insn,
+        bool (*acceptModes)(AsmInsn &, const Entry *),
+        void (*pageSetup)(AsmInsn &, const EntryPage *) = Cpu::defaultPageSetup,
+        void (*readCode)(AsmInsn &, const Entry *, const EntryPage *) = Cpu::defaultReadCode) {
+#if defined(LIBASM_ASM_NOINDEX)
+    return c->searchName(insn, acceptModes, pageSetup, readCode);
+#else
+    return c->searchName(insn, nameIndexes(table, end)[c], acceptModes, pageSetup, readCode);
+#endif
+}
+
 bool hasOperand(const CpuSpec &cpuSpec, AsmInsn &insn) {
-    cpu(cpuSpec.cpu)->searchName(insn, Cpu::acceptAll<AsmInsn, Entry>);
+    searchName(ARRAY_RANGE(CPU_TABLE), cpu(cpuSpec.cpu), insn, Cpu::acceptAll<AsmInsn, Entry>);
 #if !defined(LIBASM_MC68000_NOFPU)
     if (!insn.isOK())
-        fpu(cpuSpec.fpu)->searchName(insn, Cpu::acceptAll<AsmInsn, Entry>);
+        searchName(
+                ARRAY_RANGE(FPU_TABLE), fpu(cpuSpec.fpu), insn, Cpu::acceptAll<AsmInsn, Entry>);
 #endif
 #if !defined(LIBASM_MC68000_NOPMMU)
     if (!insn.isOK())
-        pmmu(cpuSpec.pmmu)->searchName(insn, Cpu::acceptAll<AsmInsn, Entry>);
+        searchName(
+                ARRAY_RANGE(PMMU_TABLE), pmmu(cpuSpec.pmmu), insn, Cpu::acceptAll<AsmInsn, Entry>);
 #endif
     return insn.isOK() && insn.src() != M_NONE;
 }
@@ -2083,10 +2106,11 @@ void readCode(AsmInsn &insn, const Entry *entry_P, const EntryPage *) {
 }
 
 Error searchName(const CpuSpec &cpuSpec, AsmInsn &insn) {
-    cpu(cpuSpec.cpu)->searchName(insn, acceptModes, pageSetup, readCode);
+    searchName(ARRAY_RANGE(CPU_TABLE), cpu(cpuSpec.cpu), insn, acceptModes, pageSetup, readCode);
 #if !defined(LIBASM_MC68000_NOFPU)
     if (insn.getError() == UNKNOWN_INSTRUCTION) {
-        fpu(cpuSpec.fpu)->searchName(insn, acceptModes, pageSetup, readCode);
+        searchName(
+                ARRAY_RANGE(FPU_TABLE), fpu(cpuSpec.fpu), insn, acceptModes, pageSetup, readCode);
         if (insn.getError() != UNKNOWN_INSTRUCTION) {
             const auto opc = (insn.opCode() & ~07000) | (cpuSpec.fpuCid << 9);
             insn.setOpCode(opc);
@@ -2095,7 +2119,8 @@ Error searchName(const CpuSpec &cpuSpec, AsmInsn &insn) {
 #endif
 #if !defined(LIBASM_MC68000_NOPMMU)
     if (insn.getError() == UNKNOWN_INSTRUCTION) {
-        pmmu(cpuSpec.pmmu)->searchName(insn, acceptModes, pageSetup, readCode);
+        searchName(ARRAY_RANGE(PMMU_TABLE), pmmu(cpuSpec.pmmu), insn, acceptModes, pageSetup,
+                readCode);
     }
 #endif
     return insn.getError();
@@ -2200,22 +2225,44 @@ bool matchOpCode(DisInsn &insn, const Entry *entry, const EntryPage *) {
     return post == flags.postVal();
 }
 
+#if !defined(LIBASM_DIS_NOINDEX)
+Config::opcode_t opCodeMask(const Entry *entry, const EntryPage *) {
+    return entry->readFlags().insnMask();
+}
+
+template <typename CPU_T>
+const entry::OpCodeIndexes<CPU_T, EntryPage, Entry> &indexes(const CPU_T *head, const CPU_T *tail) {
+    static const entry::OpCodeIndexes<CPU_T, EntryPage, Entry> INDEXES{head, tail, opCodeMask};
+    return INDEXES;
+}
+#endif
+
+template <typename CPU_T>
+const Entry *searchOpCode(const CPU_T *table, const CPU_T *end, const CPU_T *c, DisInsn &insn,
+        StrBuffer &out) {
+#if defined(LIBASM_DIS_NOINDEX)
+    return c->searchOpCode(insn, out, matchOpCode);
+#else
+    return c->searchOpCode(insn, out, indexes(table, end)[c], matchOpCode);
+#endif
+}
+
 Error searchOpCode(const CpuSpec &cpuSpec, DisInsn &insn, StrBuffer &out) {
-    cpu(cpuSpec.cpu)->searchOpCode(insn, out, matchOpCode);
+    searchOpCode(ARRAY_RANGE(CPU_TABLE), cpu(cpuSpec.cpu), insn, out);
 #if !defined(LIBASM_MC68000_NOFPU)
     if (insn.getError() == UNKNOWN_INSTRUCTION) {
         const auto opc = insn.opCode();
         if ((opc & 0xFE00) == (0xF000 | (cpuSpec.fpuCid << 9))) {
             // set default FPU coprocessor id
             insn.setOpCode((opc & ~07000) | 01000);
-            fpu(cpuSpec.fpu)->searchOpCode(insn, out, matchOpCode);
+            searchOpCode(ARRAY_RANGE(FPU_TABLE), fpu(cpuSpec.fpu), insn, out);
             insn.setOpCode(opc);
         }
     }
 #endif
 #if !defined(LIBASM_MC68000_NOPMMU)
     if (insn.getError() == UNKNOWN_INSTRUCTION) {
-        pmmu(cpuSpec.pmmu)->searchOpCode(insn, out, matchOpCode);
+        searchOpCode(ARRAY_RANGE(PMMU_TABLE), pmmu(cpuSpec.pmmu), insn, out);
     }
 #endif
     if (insn.getError() == UNKNOWN_INSTRUCTION)
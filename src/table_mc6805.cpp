@@ -32,24 +32,24 @@ namespace mc6805 {
 
 // clang-format off
 constexpr Entry MC6805_TABLE[] PROGMEM = {
-    E1(0x20, CF_00, TEXT_BRA,  M_REL),
+    E1(0x20, CF_00, flowJump(TEXT_BRA), M_REL),
     E1(0x21, CF_00, TEXT_BRN,  M_REL),
-    E1(0x22, CF_00, TEXT_BHI,  M_REL),
-    E1(0x23, CF_00, TEXT_BLS,  M_REL),
-    E1(0x24, CF_00, TEXT_BHS,  M_REL),
-    E1(0x24, CF_00, TEXT_BCC,  M_REL),
-    E1(0x25, CF_00, TEXT_BLO,  M_REL),
-    E1(0x25, CF_00, TEXT_BCS,  M_REL),
-    E1(0x26, CF_00, TEXT_BNE,  M_REL),
-    E1(0x27, CF_00, TEXT_BEQ,  M_REL),
-    E1(0x28, CF_00, TEXT_BHCC, M_REL),
-    E1(0x29, CF_00, TEXT_BHCS, M_REL),
-    E1(0x2A, CF_00, TEXT_BPL,  M_REL),
-    E1(0x2B, CF_00, TEXT_BMI,  M_REL),
-    E1(0x2C, CF_00, TEXT_BMC,  M_REL),
-    E1(0x2D, CF_00, TEXT_BMS,  M_REL),
-    E1(0x2E, CF_00, TEXT_BIL,  M_REL),
-    E1(0x2F, CF_00, TEXT_BIH,  M_REL),
+    E1(0x22, CF_00, flowBranch(TEXT_BHI),  M_REL),
+    E1(0x23, CF_00, flowBranch(TEXT_BLS),  M_REL),
+    E1(0x24, CF_00, flowBranch(TEXT_BHS),  M_REL),
+    E1(0x24, CF_00, flowBranch(TEXT_BCC),  M_REL),
+    E1(0x25, CF_00, flowBranch(TEXT_BLO),  M_REL),
+    E1(0x25, CF_00, flowBranch(TEXT_BCS),  M_REL),
+    E1(0x26, CF_00, flowBranch(TEXT_BNE),  M_REL),
+    E1(0x27, CF_00, flowBranch(TEXT_BEQ),  M_REL),
+    E1(0x28, CF_00, flowBranch(TEXT_BHCC), M_REL),
+    E1(0x29, CF_00, flowBranch(TEXT_BHCS), M_REL),
+    E1(0x2A, CF_00, flowBranch(TEXT_BPL),  M_REL),
+    E1(0x2B, CF_00, flowBranch(TEXT_BMI),  M_REL),
+    E1(0x2C, CF_00, flowBranch(TEXT_BMC),  M_REL),
+    E1(0x2D, CF_00, flowBranch(TEXT_BMS),  M_REL),
+    E1(0x2E, CF_00, flowBranch(TEXT_BIL),  M_REL),
+    E1(0x2F, CF_00, flowBranch(TEXT_BIH),  M_REL),
     E1(0x30, CF_00, TEXT_NEG,  M_DIR),
     E1(0x33, CF_00, TEXT_COM,  M_DIR),
     E1(0x34, CF_00, TEXT_LSR,  M_DIR),
@@ -110,11 +110,11 @@ constexpr Entry MC6805_TABLE[] PROGMEM = {
     E1(0xA9, CF_10, TEXT_ADC,  M_GEN1),
     E1(0xAA, CF_10, TEXT_ORA,  M_GEN1),
     E1(0xAB, CF_10, TEXT_ADD,  M_GEN1),
-    E1(0xBC, CF_00, TEXT_JMP,  M_DIR),
+    E1(0xBC, CF_00, flowJump(TEXT_JMP), M_DIR),
     E1(0xAE, CF_10, TEXT_LDX,  M_GEN1),
     E1(0xBF, CF_00, TEXT_STX,  M_DIR),
-    E1(0xAD, CF_00, TEXT_BSR,  M_REL),
-    E1(0xBD, CF_00, TEXT_JSR,  M_DIR),
+    E1(0xAD, CF_00, flowBranch(TEXT_BSR), M_REL),
+    E1(0xBD, CF_00, flowBranch(TEXT_JSR), M_DIR),
     E1(0xC0, CF_30, TEXT_SUB,  M_GEN2),
     E1(0xC1, CF_30, TEXT_CMP,  M_GEN2),
     E1(0xC2, CF_30, TEXT_SBC,  M_GEN2),
@@ -127,12 +127,12 @@ constexpr Entry MC6805_TABLE[] PROGMEM = {
     E1(0xC9, CF_30, TEXT_ADC,  M_GEN2),
     E1(0xCA, CF_30, TEXT_ORA,  M_GEN2),
     E1(0xCB, CF_30, TEXT_ADD,  M_GEN2),
-    E1(0xCC, CF_30, TEXT_JMP,  M_GEN2),
+    E1(0xCC, CF_30, flowJump(TEXT_JMP), M_GEN2),
     E1(0xCE, CF_30, TEXT_LDX,  M_GEN2),
     E1(0xCF, CF_30, TEXT_STX,  M_GEN2),
-    E1(0xCD, CF_30, TEXT_JSR,  M_GEN2),
-    E0(0x80, CF_00, TEXT_RTI),
-    E0(0x81, CF_00, TEXT_RTS),
+    E1(0xCD, CF_30, flowBranch(TEXT_JSR), M_GEN2),
+    E0(0x80, CF_00, flowEnd(TEXT_RTI)),
+    E0(0x81, CF_00, flowEnd(TEXT_RTS)),
     E0(0x83, CF_00, TEXT_SWI),
     E0(0x97, CF_00, TEXT_TAX),
     E0(0x98, CF_00, TEXT_CLC),
@@ -144,8 +144,8 @@ constexpr Entry MC6805_TABLE[] PROGMEM = {
     E0(0x9F, CF_00, TEXT_TXA),
     E2(0x10, CF_00, TEXT_BSET,  M_BNO, M_DIR),
     E2(0x11, CF_00, TEXT_BCLR,  M_BNO, M_DIR),
-    E3(0x00, CF_00, TEXT_BRSET, M_BNO, M_DIR, M_REL),
-    E3(0x01, CF_00, TEXT_BRCLR, M_BNO, M_DIR, M_REL),
+    E3(0x00, CF_00, flowBranch(TEXT_BRSET), M_BNO, M_DIR, M_REL),
+    E3(0x01, CF_00, flowBranch(TEXT_BRCLR), M_BNO, M_DIR, M_REL),
 };
 
 constexpr uint8_t MC6805_INDEX[] PROGMEM = {
@@ -310,21 +310,21 @@ constexpr Entry MC68HC08_TABLE[] PROGMEM = {
     E0(0x8C, CF_00, TEXT_CLRH),
     E0(0x94, CF_00, TEXT_TXS),
     E0(0x95, CF_00, TEXT_TSX),
-    E1(0x90, CF_00, TEXT_BGE,   M_REL),
-    E1(0x91, CF_00, TEXT_BLT,   M_REL),
-    E1(0x92, CF_00, TEXT_BGT,   M_REL),
-    E1(0x93, CF_00, TEXT_BLE,   M_REL),
-    E2(0x3B, CF_00, TEXT_DBNZ,  M_DIR,  M_REL),
-    E1(0x4B, CF_00, TEXT_DBNZA, M_REL),
-    E1(0x5B, CF_00, TEXT_DBNZX, M_REL),
-    E2(0x6B, CF_00, TEXT_DBNZ,  M_IX1,  M_REL),
-    E2(0x7B, CF_00, TEXT_DBNZ,  M_IX0,  M_REL),
-    E2(0x7B, CF_00, TEXT_DBNZ,  M_REGX, M_REL),
-    E2(0x31, CF_00, TEXT_CBEQ,  M_DIR,  M_REL),
-    E2(0x41, CF_00, TEXT_CBEQA, M_IMM,  M_REL),
-    E2(0x51, CF_00, TEXT_CBEQX, M_IMM,  M_REL),
-    E2(0x61, CF_00, TEXT_CBEQ,  M_IX1P, M_REL),
-    E2(0x71, CF_00, TEXT_CBEQ,  M_IX0P, M_REL),
+    E1(0x90, CF_00, flowBranch(TEXT_BGE),   M_REL),
+    E1(0x91, CF_00, flowBranch(TEXT_BLT),   M_REL),
+    E1(0x92, CF_00, flowBranch(TEXT_BGT),   M_REL),
+    E1(0x93, CF_00, flowBranch(TEXT_BLE),   M_REL),
+    E2(0x3B, CF_00, flowBranch(TEXT_DBNZ),  M_DIR,  M_REL),
+    E1(0x4B, CF_00, flowBranch(TEXT_DBNZA), M_REL),
+    E1(0x5B, CF_00, flowBranch(TEXT_DBNZX), M_REL),
+    E2(0x6B, CF_00, flowBranch(TEXT_DBNZ),  M_IX1,  M_REL),
+    E2(0x7B, CF_00, flowBranch(TEXT_DBNZ),  M_IX0,  M_REL),
+    E2(0x7B, CF_00, flowBranch(TEXT_DBNZ),  M_REGX, M_REL),
+    E2(0x31, CF_00, flowBranch(TEXT_CBEQ),  M_DIR,  M_REL),
+    E2(0x41, CF_00, flowBranch(TEXT_CBEQA), M_IMM,  M_REL),
+    E2(0x51, CF_00, flowBranch(TEXT_CBEQX), M_IMM,  M_REL),
+    E2(0x61, CF_00, flowBranch(TEXT_CBEQ),  M_IX1P, M_REL),
+    E2(0x71, CF_00, flowBranch(TEXT_CBEQ),  M_IX0P, M_REL),
 };
 
 constexpr uint8_t MC68HC08_INDEX[] PROGMEM = {
@@ -373,7 +373,7 @@ constexpr uint8_t MC68HC08_INDEX[] PROGMEM = {
 
 constexpr Entry MC68HC08_P9E[] PROGMEM = {
     E1(0x60, CF_00, TEXT_NEG,  M_SP1),
-    E2(0x61, CF_00, TEXT_CBEQ, M_SP1,  M_REL),
+    E2(0x61, CF_00, flowBranch(TEXT_CBEQ), M_SP1,  M_REL),
     E1(0x63, CF_00, TEXT_COM,  M_SP1),
     E1(0x64, CF_00, TEXT_LSR,  M_SP1),
     E1(0x66, CF_00, TEXT_ROR,  M_SP1),
@@ -382,7 +382,7 @@ constexpr Entry MC68HC08_P9E[] PROGMEM = {
     E1(0x68, CF_00, TEXT_LSL,  M_SP1),
     E1(0x69, CF_00, TEXT_ROL,  M_SP1),
     E1(0x6A, CF_00, TEXT_DEC,  M_SP1),
-    E2(0x6B, CF_00, TEXT_DBNZ, M_SP1,  M_REL),
+    E2(0x6B, CF_00, flowBranch(TEXT_DBNZ), M_SP1,  M_REL),
     E1(0x6C, CF_00, TEXT_INC,  M_SP1),
     E1(0x6D, CF_00, TEXT_TST,  M_SP1),
     E1(0x6F, CF_00, TEXT_CLR,  M_SP1),
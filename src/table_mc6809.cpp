@@ -41,36 +41,36 @@ constexpr Entry MC6809_P00[] PROGMEM = {
     E1(0x0A, TEXT_DEC,   M_DIR),
     E1(0x0C, TEXT_INC,   M_DIR),
     E1(0x0D, TEXT_TST,   M_DIR),
-    E1(0x0E, TEXT_JMP,   M_DIR),
+    E1(0x0E, flowJump(TEXT_JMP), M_DIR),
     E1(0x0F, TEXT_CLR,   M_DIR),
     E0(0x12, TEXT_NOP),
     E0(0x13, TEXT_SYNC),
-    E1(0x16, TEXT_LBRA,  M_LREL),
-    E1(0x17, TEXT_LBSR,  M_LREL),
+    E1(0x16, flowJump(TEXT_LBRA),   M_LREL),
+    E1(0x17, flowBranch(TEXT_LBSR), M_LREL),
     E0(0x19, TEXT_DAA),
     E1(0x1A, TEXT_ORCC,  M_IM8),
     E1(0x1C, TEXT_ANDCC, M_IM8),
     E0(0x1D, TEXT_SEX),
     E1(0x1E, TEXT_EXG,   M_PAIR),
     E1(0x1F, TEXT_TFR,   M_PAIR),
-    E1(0x20, TEXT_BRA,   M_REL),
+    E1(0x20, flowJump(TEXT_BRA), M_REL),
     E1(0x21, TEXT_BRN,   M_REL),
-    E1(0x22, TEXT_BHI,   M_REL),
-    E1(0x23, TEXT_BLS,   M_REL),
-    E1(0x24, TEXT_BHS,   M_REL),
-    E1(0x24, TEXT_BCC,   M_REL),
-    E1(0x25, TEXT_BLO,   M_REL),
-    E1(0x25, TEXT_BCS,   M_REL),
-    E1(0x26, TEXT_BNE,   M_REL),
-    E1(0x27, TEXT_BEQ,   M_REL),
-    E1(0x28, TEXT_BVC,   M_REL),
-    E1(0x29, TEXT_BVS,   M_REL),
-    E1(0x2A, TEXT_BPL,   M_REL),
-    E1(0x2B, TEXT_BMI,   M_REL),
-    E1(0x2C, TEXT_BGE,   M_REL),
-    E1(0x2D, TEXT_BLT,   M_REL),
-    E1(0x2E, TEXT_BGT,   M_REL),
-    E1(0x2F, TEXT_BLE,   M_REL),
+    E1(0x22, flowBranch(TEXT_BHI), M_REL),
+    E1(0x23, flowBranch(TEXT_BLS), M_REL),
+    E1(0x24, flowBranch(TEXT_BHS), M_REL),
+    E1(0x24, flowBranch(TEXT_BCC), M_REL),
+    E1(0x25, flowBranch(TEXT_BLO), M_REL),
+    E1(0x25, flowBranch(TEXT_BCS), M_REL),
+    E1(0x26, flowBranch(TEXT_BNE), M_REL),
+    E1(0x27, flowBranch(TEXT_BEQ), M_REL),
+    E1(0x28, flowBranch(TEXT_BVC), M_REL),
+    E1(0x29, flowBranch(TEXT_BVS), M_REL),
+    E1(0x2A, flowBranch(TEXT_BPL), M_REL),
+    E1(0x2B, flowBranch(TEXT_BMI), M_REL),
+    E1(0x2C, flowBranch(TEXT_BGE), M_REL),
+    E1(0x2D, flowBranch(TEXT_BLT), M_REL),
+    E1(0x2E, flowBranch(TEXT_BGT), M_REL),
+    E1(0x2F, flowBranch(TEXT_BLE), M_REL),
     E1(0x30, TEXT_LEAX,  M_IDX),
     E1(0x31, TEXT_LEAY,  M_IDX),
     E1(0x32, TEXT_LEAS,  M_IDX),
@@ -79,9 +79,9 @@ constexpr Entry MC6809_P00[] PROGMEM = {
     E1(0x35, TEXT_PULS,  M_LIST),
     E1(0x36, TEXT_PSHU,  M_LIST),
     E1(0x37, TEXT_PULU,  M_LIST),
-    E0(0x39, TEXT_RTS),
+    E0(0x39, flowEnd(TEXT_RTS)),
     E0(0x3A, TEXT_ABX),
-    E0(0x3B, TEXT_RTI),
+    E0(0x3B, flowEnd(TEXT_RTI)),
     E1(0x3C, TEXT_CWAI,  M_IM8),
     E0(0x3D, TEXT_MUL),
     E0(0x3F, TEXT_SWI),
@@ -120,7 +120,7 @@ constexpr Entry MC6809_P00[] PROGMEM = {
     E1(0x6A, TEXT_DEC,   M_GMEM),
     E1(0x6C, TEXT_INC,   M_GMEM),
     E1(0x6D, TEXT_TST,   M_GMEM),
-    E1(0x6E, TEXT_JMP,   M_GMEM),
+    E1(0x6E, flowJump(TEXT_JMP), M_GMEM),
     E1(0x6F, TEXT_CLR,   M_GMEM),
     E1(0x80, TEXT_SUBA,  M_GEN8),
     E1(0x81, TEXT_CMPA,  M_GEN8),
@@ -137,8 +137,8 @@ constexpr Entry MC6809_P00[] PROGMEM = {
     E1(0x8A, TEXT_ORA,   M_GEN8),
     E1(0x8B, TEXT_ADDA,  M_GEN8),
     E1(0x8C, TEXT_CMPX,  M_GEN16),
-    E1(0x8D, TEXT_BSR,   M_REL),
-    E1(0x8D, TEXT_JSR,   M_GEN16),
+    E1(0x8D, flowBranch(TEXT_BSR), M_REL),
+    E1(0x8D, flowBranch(TEXT_JSR), M_GEN16),
     E1(0x8E, TEXT_LDX,   M_GEN16),
     E1(0x9F, TEXT_STX,   M_DIR),
     E1(0xAF, TEXT_STX,   M_IDX),
@@ -307,22 +307,22 @@ constexpr uint8_t MC6809_I00[] PROGMEM = {
 
 constexpr Entry MC6809_P10[] PROGMEM = {
     E1(0x21, TEXT_LBRN,  M_LREL),
-    E1(0x22, TEXT_LBHI,  M_LREL),
-    E1(0x23, TEXT_LBLS,  M_LREL),
-    E1(0x24, TEXT_LBHS,  M_LREL),
-    E1(0x24, TEXT_LBCC,  M_LREL),
-    E1(0x25, TEXT_LBLO,  M_LREL),
-    E1(0x25, TEXT_LBCS,  M_LREL),
-    E1(0x26, TEXT_LBNE,  M_LREL),
-    E1(0x27, TEXT_LBEQ,  M_LREL),
-    E1(0x28, TEXT_LBVC,  M_LREL),
-    E1(0x29, TEXT_LBVS,  M_LREL),
-    E1(0x2A, TEXT_LBPL,  M_LREL),
-    E1(0x2B, TEXT_LBMI,  M_LREL),
-    E1(0x2C, TEXT_LBGE,  M_LREL),
-    E1(0x2D, TEXT_LBLT,  M_LREL),
-    E1(0x2E, TEXT_LBGT,  M_LREL),
-    E1(0x2F, TEXT_LBLE,  M_LREL),
+    E1(0x22, flowBranch(TEXT_LBHI), M_LREL),
+    E1(0x23, flowBranch(TEXT_LBLS), M_LREL),
+    E1(0x24, flowBranch(TEXT_LBHS), M_LREL),
+    E1(0x24, flowBranch(TEXT_LBCC), M_LREL),
+    E1(0x25, flowBranch(TEXT_LBLO), M_LREL),
+    E1(0x25, flowBranch(TEXT_LBCS), M_LREL),
+    E1(0x26, flowBranch(TEXT_LBNE), M_LREL),
+    E1(0x27, flowBranch(TEXT_LBEQ), M_LREL),
+    E1(0x28, flowBranch(TEXT_LBVC), M_LREL),
+    E1(0x29, flowBranch(TEXT_LBVS), M_LREL),
+    E1(0x2A, flowBranch(TEXT_LBPL), M_LREL),
+    E1(0x2B, flowBranch(TEXT_LBMI), M_LREL),
+    E1(0x2C, flowBranch(TEXT_LBGE), M_LREL),
+    E1(0x2D, flowBranch(TEXT_LBLT), M_LREL),
+    E1(0x2E, flowBranch(TEXT_LBGT), M_LREL),
+    E1(0x2F, flowBranch(TEXT_LBLE), M_LREL),
     E0(0x3F, TEXT_SWI2),
     E1(0x83, TEXT_CMPD,  M_GEN16),
     E1(0x8C, TEXT_CMPY,  M_GEN16),
@@ -34,54 +34,54 @@ namespace mc68hc12 {
 constexpr Entry MC68HC12_TABLE[] PROGMEM = {
     E0(0x02, CF_00, TEXT_INY),
     E0(0x03, CF_00, TEXT_DEY),
-    E1(0x05, CF_00, TEXT_JMP,  M_IDX),
-    E1(0x06, CF_00, TEXT_JMP,  M_EXT),
-    E1(0x07, CF_00, TEXT_BSR,  M_RL8),
+    E1(0x05, CF_00, flowEnd(TEXT_JMP),    M_IDX),
+    E1(0x06, CF_00, flowJump(TEXT_JMP),   M_EXT),
+    E1(0x07, CF_00, flowBranch(TEXT_BSR), M_RL8),
     E0(0x08, CF_00, TEXT_INX),
     E0(0x09, CF_00, TEXT_DEX),
-    E0(0x0A, CF_00, TEXT_RTC),
-    E0(0x0B, CF_00, TEXT_RTI),
+    E0(0x0A, CF_00, flowEnd(TEXT_RTC)),
+    E0(0x0B, CF_00, flowEnd(TEXT_RTI)),
     E2(0x0C, CF_00, TEXT_BSET,  M_DIDX, M_IM8),
     E2(0x0D, CF_00, TEXT_BCLR,  M_DIDX, M_IM8),
-    E3(0x0E, CF_00, TEXT_BRSET, M_DIDX, M_IM8, M_RL8),
-    E3(0x0F, CF_00, TEXT_BRCLR, M_DIDX, M_IM8, M_RL8),
+    E3(0x0E, CF_00, flowBranch(TEXT_BRSET), M_DIDX, M_IM8, M_RL8),
+    E3(0x0F, CF_00, flowBranch(TEXT_BRCLR), M_DIDX, M_IM8, M_RL8),
     E1(0x10, CF_00, TEXT_ANDCC, M_IM8),
     E0(0x11, CF_00, TEXT_EDIV),
     E0(0x12, CF_00, TEXT_MUL),
     E0(0x13, CF_00, TEXT_EMUL),
     E1(0x14, CF_00, TEXT_ORCC,  M_IM8),
     E1(0x15, CF_00, TEXT_JSR,   M_IDX),
-    E1(0x17, CF_00, TEXT_JSR,   M_DIR),
-    E1(0x16, CF_00, TEXT_JSR,   M_EXT),
+    E1(0x17, CF_00, flowBranch(TEXT_JSR), M_DIR),
+    E1(0x16, CF_00, flowBranch(TEXT_JSR), M_EXT),
     E1(0x19, CF_00, TEXT_LEAY,  M_DIDX),
     E1(0x1A, CF_00, TEXT_LEAX,  M_DIDX),
     E1(0x1B, CF_00, TEXT_LEAS,  M_DIDX),
     E2(0x4C, CF_00, TEXT_BSET,  M_DIR,  M_IM8),
     E2(0x4D, CF_00, TEXT_BCLR,  M_DIR,  M_IM8),
-    E3(0x4E, CF_00, TEXT_BRSET, M_DIR,  M_IM8, M_RL8),
-    E3(0x4F, CF_00, TEXT_BRCLR, M_DIR,  M_IM8, M_RL8),
+    E3(0x4E, CF_00, flowBranch(TEXT_BRSET), M_DIR,  M_IM8, M_RL8),
+    E3(0x4F, CF_00, flowBranch(TEXT_BRCLR), M_DIR,  M_IM8, M_RL8),
     E2(0x1C, CF_00, TEXT_BSET,  M_EXT, M_IM8),
     E2(0x1D, CF_00, TEXT_BCLR,  M_EXT, M_IM8),
-    E3(0x1E, CF_00, TEXT_BRSET, M_EXT, M_IM8, M_RL8),
-    E3(0x1F, CF_00, TEXT_BRCLR, M_EXT, M_IM8, M_RL8),
-    E1(0x20, CF_00, TEXT_BRA,   M_RL8),
+    E3(0x1E, CF_00, flowBranch(TEXT_BRSET), M_EXT, M_IM8, M_RL8),
+    E3(0x1F, CF_00, flowBranch(TEXT_BRCLR), M_EXT, M_IM8, M_RL8),
+    E1(0x20, CF_00, flowJump(TEXT_BRA),     M_RL8),
     E1(0x21, CF_00, TEXT_BRN,   M_RL8),
-    E1(0x22, CF_00, TEXT_BHI,   M_RL8),
-    E1(0x23, CF_00, TEXT_BLS,   M_RL8),
-    E1(0x24, CF_00, TEXT_BCC,   M_RL8),
-    E1(0x24, CF_00, TEXT_BHS,   M_RL8),
-    E1(0x25, CF_00, TEXT_BCS,   M_RL8),
-    E1(0x25, CF_00, TEXT_BLO,   M_RL8),
-    E1(0x26, CF_00, TEXT_BNE,   M_RL8),
-    E1(0x27, CF_00, TEXT_BEQ,   M_RL8),
-    E1(0x28, CF_00, TEXT_BVC,   M_RL8),
-    E1(0x29, CF_00, TEXT_BVS,   M_RL8),
-    E1(0x2A, CF_00, TEXT_BPL,   M_RL8),
-    E1(0x2B, CF_00, TEXT_BMI,   M_RL8),
-    E1(0x2C, CF_00, TEXT_BGE,   M_RL8),
-    E1(0x2D, CF_00, TEXT_BLT,   M_RL8),
-    E1(0x2E, CF_00, TEXT_BGT,   M_RL8),
-    E1(0x2F, CF_00, TEXT_BLE,   M_RL8),
+    E1(0x22, CF_00, flowBranch(TEXT_BHI), M_RL8),
+    E1(0x23, CF_00, flowBranch(TEXT_BLS), M_RL8),
+    E1(0x24, CF_00, flowBranch(TEXT_BCC), M_RL8),
+    E1(0x24, CF_00, flowBranch(TEXT_BHS), M_RL8),
+    E1(0x25, CF_00, flowBranch(TEXT_BCS), M_RL8),
+    E1(0x25, CF_00, flowBranch(TEXT_BLO), M_RL8),
+    E1(0x26, CF_00, flowBranch(TEXT_BNE), M_RL8),
+    E1(0x27, CF_00, flowBranch(TEXT_BEQ), M_RL8),
+    E1(0x28, CF_00, flowBranch(TEXT_BVC), M_RL8),
+    E1(0x29, CF_00, flowBranch(TEXT_BVS), M_RL8),
+    E1(0x2A, CF_00, flowBranch(TEXT_BPL), M_RL8),
+    E1(0x2B, CF_00, flowBranch(TEXT_BMI), M_RL8),
+    E1(0x2C, CF_00, flowBranch(TEXT_BGE), M_RL8),
+    E1(0x2D, CF_00, flowBranch(TEXT_BLT), M_RL8),
+    E1(0x2E, CF_00, flowBranch(TEXT_BGT), M_RL8),
+    E1(0x2F, CF_00, flowBranch(TEXT_BLE), M_RL8),
     E0(0x30, CF_00, TEXT_PULX),
     E0(0x31, CF_00, TEXT_PULY),
     E0(0x32, CF_00, TEXT_PULA),
@@ -94,7 +94,7 @@ constexpr Entry MC68HC12_TABLE[] PROGMEM = {
     E0(0x39, CF_00, TEXT_PSHC),
     E0(0x3A, CF_00, TEXT_PULD),
     E0(0x3B, CF_00, TEXT_PSHD),
-    E0(0x3D, CF_00, TEXT_RTS),
+    E0(0x3D, CF_00, flowEnd(TEXT_RTS)),
     E0(0x3E, CF_00, TEXT_WAI),
     E0(0x3F, CF_00, TEXT_SWI),
     E0(0x40, CF_00, TEXT_NEGA),
@@ -338,18 +338,18 @@ constexpr uint8_t MC68HC12_INDEX[] PROGMEM = {
 };
 
 constexpr Entry MC68HC12_P04[] PROGMEM = {
-    E2(0x00, CF_11, TEXT_DBEQ, M_R8L,  M_RL9),
-    E2(0x20, CF_11, TEXT_DBNE, M_R8L,  M_RL9),
-    E2(0x40, CF_11, TEXT_TBEQ, M_R8L,  M_RL9),
-    E2(0x60, CF_11, TEXT_TBNE, M_R8L,  M_RL9),
-    E2(0x80, CF_11, TEXT_IBEQ, M_R8L,  M_RL9),
-    E2(0xA0, CF_11, TEXT_IBNE, M_R8L,  M_RL9),
-    E2(0x04, CF_13, TEXT_DBEQ, M_R16L, M_RL9),
-    E2(0x24, CF_13, TEXT_DBNE, M_R16L, M_RL9),
-    E2(0x44, CF_13, TEXT_TBEQ, M_R16L, M_RL9),
-    E2(0x64, CF_13, TEXT_TBNE, M_R16L, M_RL9),
-    E2(0x84, CF_13, TEXT_IBEQ, M_R16L, M_RL9),
-    E2(0xA4, CF_13, TEXT_IBNE, M_R16L, M_RL9),
+    E2(0x00, CF_11, flowBranch(TEXT_DBEQ), M_R8L,  M_RL9),
+    E2(0x20, CF_11, flowBranch(TEXT_DBNE), M_R8L,  M_RL9),
+    E2(0x40, CF_11, flowBranch(TEXT_TBEQ), M_R8L,  M_RL9),
+    E2(0x60, CF_11, flowBranch(TEXT_TBNE), M_R8L,  M_RL9),
+    E2(0x80, CF_11, flowBranch(TEXT_IBEQ), M_R8L,  M_RL9),
+    E2(0xA0, CF_11, flowBranch(TEXT_IBNE), M_R8L,  M_RL9),
+    E2(0x04, CF_13, flowBranch(TEXT_DBEQ), M_R16L, M_RL9),
+    E2(0x24, CF_13, flowBranch(TEXT_DBNE), M_R16L, M_RL9),
+    E2(0x44, CF_13, flowBranch(TEXT_TBEQ), M_R16L, M_RL9),
+    E2(0x64, CF_13, flowBranch(TEXT_TBNE), M_R16L, M_RL9),
+    E2(0x84, CF_13, flowBranch(TEXT_IBEQ), M_R16L, M_RL9),
+    E2(0xA4, CF_13, flowBranch(TEXT_IBNE), M_R16L, M_RL9),
 };
 
 constexpr uint8_t MC68HC12_I04[] PROGMEM = {
@@ -454,24 +454,24 @@ constexpr Entry MC68HC12_P18[] PROGMEM = {
     E1(0x1D, CF_00, TEXT_MINM,  M_IDX),
     E1(0x1E, CF_00, TEXT_EMAXM, M_IDX),
     E1(0x1F, CF_00, TEXT_EMINM, M_IDX),
-    E1(0x20, CF_00, TEXT_LBRA,  M_RL16),
+    E1(0x20, CF_00, flowJump(TEXT_LBRA), M_RL16),
     E1(0x21, CF_00, TEXT_LBRN,  M_RL16),
-    E1(0x22, CF_00, TEXT_LBHI,  M_RL16),
-    E1(0x23, CF_00, TEXT_LBLS,  M_RL16),
-    E1(0x24, CF_00, TEXT_LBCC,  M_RL16),
-    E1(0x24, CF_00, TEXT_LBHS,  M_RL16),
-    E1(0x25, CF_00, TEXT_LBCS,  M_RL16),
-    E1(0x25, CF_00, TEXT_LBLO,  M_RL16),
-    E1(0x26, CF_00, TEXT_LBNE,  M_RL16),
-    E1(0x27, CF_00, TEXT_LBEQ,  M_RL16),
-    E1(0x28, CF_00, TEXT_LBVC,  M_RL16),
-    E1(0x29, CF_00, TEXT_LBVS,  M_RL16),
-    E1(0x2A, CF_00, TEXT_LBPL,  M_RL16),
-    E1(0x2B, CF_00, TEXT_LBMI,  M_RL16),
-    E1(0x2C, CF_00, TEXT_LBGE,  M_RL16),
-    E1(0x2D, CF_00, TEXT_LBLT,  M_RL16),
-    E1(0x2E, CF_00, TEXT_LBGT,  M_RL16),
-    E1(0x2F, CF_00, TEXT_LBLE,  M_RL16),
+    E1(0x22, CF_00, flowBranch(TEXT_LBHI), M_RL16),
+    E1(0x23, CF_00, flowBranch(TEXT_LBLS), M_RL16),
+    E1(0x24, CF_00, flowBranch(TEXT_LBCC), M_RL16),
+    E1(0x24, CF_00, flowBranch(TEXT_LBHS), M_RL16),
+    E1(0x25, CF_00, flowBranch(TEXT_LBCS), M_RL16),
+    E1(0x25, CF_00, flowBranch(TEXT_LBLO), M_RL16),
+    E1(0x26, CF_00, flowBranch(TEXT_LBNE), M_RL16),
+    E1(0x27, CF_00, flowBranch(TEXT_LBEQ), M_RL16),
+    E1(0x28, CF_00, flowBranch(TEXT_LBVC), M_RL16),
+    E1(0x29, CF_00, flowBranch(TEXT_LBVS), M_RL16),
+    E1(0x2A, CF_00, flowBranch(TEXT_LBPL), M_RL16),
+    E1(0x2B, CF_00, flowBranch(TEXT_LBMI), M_RL16),
+    E1(0x2C, CF_00, flowBranch(TEXT_LBGE), M_RL16),
+    E1(0x2D, CF_00, flowBranch(TEXT_LBLT), M_RL16),
+    E1(0x2E, CF_00, flowBranch(TEXT_LBGT), M_RL16),
+    E1(0x2F, CF_00, flowBranch(TEXT_LBLE), M_RL16),
     E0(0x3A, CF_00, TEXT_REV),
     E0(0x3B, CF_00, TEXT_REVW),
     E0(0x3C, CF_00, TEXT_WAV),
@@ -55,11 +55,11 @@ constexpr Entry MC68HC16_TABLE[] PROGMEM = {
     E1(0x35, CF_00, TEXT_PULM,  M_LIST),
     E1(0x35, CF_00, TEXT_PULM,  M_IXE),          // E,ix
     E2(0x35, CF_00, TEXT_PULM,  M_IXE,  M_LIST), // Emix,...
-    E1(0x36, CF_00, TEXT_BSR,   M_RL8),
+    E1(0x36, CF_00, flowBranch(TEXT_BSR), M_RL8),
     E2(0x38, CF_00, TEXT_BCLR,  M_EX16, M_IM8),
     E2(0x39, CF_00, TEXT_BSET,  M_EX16, M_IM8),
-    E3(0x3A, CF_00, TEXT_BRCLR, M_EX16, M_IM8, M_RL16),
-    E3(0x3B, CF_00, TEXT_BRSET, M_EX16, M_IM8, M_RL16),
+    E3(0x3A, CF_00, flowBranch(TEXT_BRCLR), M_EX16, M_IM8, M_RL16),
+    E3(0x3B, CF_00, flowBranch(TEXT_BRSET), M_EX16, M_IM8, M_RL16),
     E1(0x3C, CF_00, TEXT_AIX,  M_SIM8),
     E1(0x3D, CF_00, TEXT_AIY,  M_SIM8),
     E1(0x3E, CF_00, TEXT_AIZ,  M_SIM8),
@@ -75,7 +75,7 @@ constexpr Entry MC68HC16_TABLE[] PROGMEM = {
     E1(0x48, CF_30, TEXT_CMPA,  M_IX8),
     E1(0x49, CF_30, TEXT_BITA,  M_IX8),
     E1(0x4A, CF_30, TEXT_STAA,  M_IX8),
-    E1(0x4B, CF_30, TEXT_JMP,   M_IX20),
+    E1(0x4B, CF_30, flowJump(TEXT_JMP), M_IX20),
     E1(0x4C, CF_30, TEXT_CPX,   M_IX8),
     E1(0x4D, CF_30, TEXT_CPY,   M_IX8),
     E1(0x4E, CF_30, TEXT_CPZ,   M_IX8),
@@ -90,7 +90,7 @@ constexpr Entry MC68HC16_TABLE[] PROGMEM = {
     E1(0x77, CF_00, TEXT_ORAA,  M_IM8),
     E1(0x78, CF_00, TEXT_CMPA,  M_IM8),
     E1(0x79, CF_00, TEXT_BITA,  M_IM8),
-    E1(0x7A, CF_00, TEXT_JMP,   M_EX20),
+    E1(0x7A, CF_00, flowJump(TEXT_JMP), M_EX20),
     E2(0x7B, CF_00, TEXT_MAC,   M_IM4H, M_IM4L),
     E1(0x7C, CF_00, TEXT_ADDE,  M_SIM8),
     E1(0x80, CF_30, TEXT_SUBD,  M_IX8),
@@ -102,31 +102,31 @@ constexpr Entry MC68HC16_TABLE[] PROGMEM = {
     E1(0x86, CF_30, TEXT_ANDD,  M_IX8),
     E1(0x87, CF_30, TEXT_ORD,   M_IX8),
     E1(0x88, CF_30, TEXT_CPD,   M_IX8),
-    E1(0x89, CF_30, TEXT_JSR,   M_IX20),
+    E1(0x89, CF_30, flowBranch(TEXT_JSR), M_IX20),
     E1(0x8A, CF_30, TEXT_STD,   M_IX8),
-    E3(0x8B, CF_30, TEXT_BRSET, M_IX8, M_IM8, M_RL8),
+    E3(0x8B, CF_30, flowBranch(TEXT_BRSET), M_IX8, M_IM8, M_RL8),
     E1(0x8C, CF_30, TEXT_STX,   M_IX8),
     E1(0x8D, CF_30, TEXT_STY,   M_IX8),
     E1(0x8E, CF_30, TEXT_STZ,   M_IX8),
     E1(0x8F, CF_30, TEXT_STS,   M_IX8),
-    E1(0xB0, CF_00, TEXT_BRA,   M_RL8),
+    E1(0xB0, CF_00, flowJump(TEXT_BRA), M_RL8),
     E1(0xB1, CF_00, TEXT_BRN,   M_RL8),
-    E1(0xB2, CF_00, TEXT_BHI,   M_RL8),
-    E1(0xB3, CF_00, TEXT_BLS,   M_RL8),
-    E1(0xB4, CF_00, TEXT_BCC,   M_RL8),
-    E1(0xB5, CF_00, TEXT_BCS,   M_RL8),
-    E1(0xB4, CF_00, TEXT_BHS,   M_RL8),
-    E1(0xB5, CF_00, TEXT_BLO,   M_RL8),
-    E1(0xB6, CF_00, TEXT_BNE,   M_RL8),
-    E1(0xB7, CF_00, TEXT_BEQ,   M_RL8),
-    E1(0xB8, CF_00, TEXT_BVC,   M_RL8),
-    E1(0xB9, CF_00, TEXT_BVS,   M_RL8),
-    E1(0xBA, CF_00, TEXT_BPL,   M_RL8),
-    E1(0xBB, CF_00, TEXT_BMI,   M_RL8),
-    E1(0xBC, CF_00, TEXT_BGE,   M_RL8),
-    E1(0xBD, CF_00, TEXT_BLT,   M_RL8),
-    E1(0xBE, CF_00, TEXT_BGT,   M_RL8),
-    E1(0xBF, CF_00, TEXT_BLE,   M_RL8),
+    E1(0xB2, CF_00, flowBranch(TEXT_BHI), M_RL8),
+    E1(0xB3, CF_00, flowBranch(TEXT_BLS), M_RL8),
+    E1(0xB4, CF_00, flowBranch(TEXT_BCC), M_RL8),
+    E1(0xB5, CF_00, flowBranch(TEXT_BCS), M_RL8),
+    E1(0xB4, CF_00, flowBranch(TEXT_BHS), M_RL8),
+    E1(0xB5, CF_00, flowBranch(TEXT_BLO), M_RL8),
+    E1(0xB6, CF_00, flowBranch(TEXT_BNE), M_RL8),
+    E1(0xB7, CF_00, flowBranch(TEXT_BEQ), M_RL8),
+    E1(0xB8, CF_00, flowBranch(TEXT_BVC), M_RL8),
+    E1(0xB9, CF_00, flowBranch(TEXT_BVS), M_RL8),
+    E1(0xBA, CF_00, flowBranch(TEXT_BPL), M_RL8),
+    E1(0xBB, CF_00, flowBranch(TEXT_BMI), M_RL8),
+    E1(0xBC, CF_00, flowBranch(TEXT_BGE), M_RL8),
+    E1(0xBD, CF_00, flowBranch(TEXT_BLT), M_RL8),
+    E1(0xBE, CF_00, flowBranch(TEXT_BGT), M_RL8),
+    E1(0xBF, CF_00, flowBranch(TEXT_BLE), M_RL8),
     E1(0xC0, CF_30, TEXT_SUBB,  M_IX8),
     E1(0xC1, CF_30, TEXT_ADDB,  M_IX8),
     E1(0xC2, CF_30, TEXT_SBCB,  M_IX8),
@@ -138,7 +138,7 @@ constexpr Entry MC68HC16_TABLE[] PROGMEM = {
     E1(0xC8, CF_30, TEXT_CMPB,  M_IX8),
     E1(0xC9, CF_30, TEXT_BITB,  M_IX8),
     E1(0xCA, CF_30, TEXT_STAB,  M_IX8),
-    E3(0xCB, CF_30, TEXT_BRCLR, M_IX8, M_IM8, M_RL8),
+    E3(0xCB, CF_30, flowBranch(TEXT_BRCLR), M_IX8, M_IM8, M_RL8),
     E1(0xCC, CF_30, TEXT_LDX,   M_IX8),
     E1(0xCD, CF_30, TEXT_LDY,   M_IX8),
     E1(0xCE, CF_30, TEXT_LDZ,   M_IX8),
@@ -153,7 +153,7 @@ constexpr Entry MC68HC16_TABLE[] PROGMEM = {
     E1(0xF7, CF_00, TEXT_ORAB,  M_IM8),
     E1(0xF8, CF_00, TEXT_CMPB,  M_IM8),
     E1(0xF9, CF_00, TEXT_BITB,  M_IM8),
-    E1(0xFA, CF_00, TEXT_JSR,   M_EX20),
+    E1(0xFA, CF_00, flowBranch(TEXT_JSR), M_EX20),
     E2(0xFB, CF_00, TEXT_RMAC,  M_IM4H, M_IM4L),
     E1(0xFC, CF_00, TEXT_ADDD,  M_SIM8),
 };
@@ -536,7 +536,7 @@ constexpr Entry MC68HC16_P27[] PROGMEM = {
     E0(0x74, CF_00, TEXT_LSLE),
     E0(0x75, CF_00, TEXT_CLRE),
     E0(0x76, CF_00, TEXT_TSTE),
-    E0(0x77, CF_00, TEXT_RTI),
+    E0(0x77, CF_00, flowEnd(TEXT_RTI)),
     E0(0x78, CF_00, TEXT_ADE),
     E0(0x79, CF_00, TEXT_SDE),
     E0(0x7A, CF_00, TEXT_XGDE),
@@ -586,9 +586,9 @@ constexpr Entry MC68HC16_P27[] PROGMEM = {
     E0(0xF4, CF_00, TEXT_LSLD),
     E0(0xF5, CF_00, TEXT_CLRD),
     E0(0xF6, CF_00, TEXT_TSTD),
-    E0(0xF7, CF_00, TEXT_RTS),
+    E0(0xF7, CF_00, flowEnd(TEXT_RTS)),
     E0(0xF8, CF_00, TEXT_SXT),
-    E1(0xF9, CF_00, TEXT_LBSR,  M_RL16),
+    E1(0xF9, CF_00, flowBranch(TEXT_LBSR), M_RL16),
     E0(0xFA, CF_00, TEXT_TBEK),
     E0(0xFB, CF_00, TEXT_TED),
     E0(0xFC, CF_00, TEXT_ROLD),
@@ -817,26 +817,26 @@ constexpr Entry MC68HC16_P37[] PROGMEM = {
     E1(0x7D, CF_00, TEXT_CPY,   M_IM16),
     E1(0x7E, CF_00, TEXT_CPZ,   M_IM16),
     E1(0x7F, CF_00, TEXT_CPS,   M_IM16),
-    E1(0x80, CF_00, TEXT_LBRA,  M_RL16),
+    E1(0x80, CF_00, flowJump(TEXT_LBRA), M_RL16),
     E1(0x81, CF_00, TEXT_LBRN,  M_RL16),
-    E1(0x82, CF_00, TEXT_LBHI,  M_RL16),
-    E1(0x83, CF_00, TEXT_LBLS,  M_RL16),
-    E1(0x84, CF_00, TEXT_LBCC,  M_RL16),
-    E1(0x85, CF_00, TEXT_LBCS,  M_RL16),
-    E1(0x84, CF_00, TEXT_LBHS,  M_RL16),
-    E1(0x85, CF_00, TEXT_LBLO,  M_RL16),
-    E1(0x86, CF_00, TEXT_LBNE,  M_RL16),
-    E1(0x87, CF_00, TEXT_LBEQ,  M_RL16),
-    E1(0x88, CF_00, TEXT_LBVC,  M_RL16),
-    E1(0x89, CF_00, TEXT_LBVS,  M_RL16),
-    E1(0x8A, CF_00, TEXT_LBPL,  M_RL16),
-    E1(0x8B, CF_00, TEXT_LBMI,  M_RL16),
-    E1(0x8C, CF_00, TEXT_LBGE,  M_RL16),
-    E1(0x8D, CF_00, TEXT_LBLT,  M_RL16),
-    E1(0x8E, CF_00, TEXT_LBGT,  M_RL16),
-    E1(0x8F, CF_00, TEXT_LBLE,  M_RL16),
-    E1(0x90, CF_00, TEXT_LBMV,  M_RL16),
-    E1(0x91, CF_00, TEXT_LBEV,  M_RL16),
+    E1(0x82, CF_00, flowBranch(TEXT_LBHI), M_RL16),
+    E1(0x83, CF_00, flowBranch(TEXT_LBLS), M_RL16),
+    E1(0x84, CF_00, flowBranch(TEXT_LBCC), M_RL16),
+    E1(0x85, CF_00, flowBranch(TEXT_LBCS), M_RL16),
+    E1(0x84, CF_00, flowBranch(TEXT_LBHS), M_RL16),
+    E1(0x85, CF_00, flowBranch(TEXT_LBLO), M_RL16),
+    E1(0x86, CF_00, flowBranch(TEXT_LBNE), M_RL16),
+    E1(0x87, CF_00, flowBranch(TEXT_LBEQ), M_RL16),
+    E1(0x88, CF_00, flowBranch(TEXT_LBVC), M_RL16),
+    E1(0x89, CF_00, flowBranch(TEXT_LBVS), M_RL16),
+    E1(0x8A, CF_00, flowBranch(TEXT_LBPL), M_RL16),
+    E1(0x8B, CF_00, flowBranch(TEXT_LBMI), M_RL16),
+    E1(0x8C, CF_00, flowBranch(TEXT_LBGE), M_RL16),
+    E1(0x8D, CF_00, flowBranch(TEXT_LBLT), M_RL16),
+    E1(0x8E, CF_00, flowBranch(TEXT_LBGT), M_RL16),
+    E1(0x8F, CF_00, flowBranch(TEXT_LBLE), M_RL16),
+    E1(0x90, CF_00, flowBranch(TEXT_LBMV), M_RL16),
+    E1(0x91, CF_00, flowBranch(TEXT_LBEV), M_RL16),
     E0(0x9C, CF_00, TEXT_TBXK),
     E0(0x9D, CF_00, TEXT_TBYK),
     E0(0x9E, CF_00, TEXT_TBZK),
@@ -1069,8 +1069,8 @@ constexpr uint8_t MC68HC16_I37[] PROGMEM = {
 constexpr Entry MC68HC16_IX16_TABLE[] PROGMEM = {
     E2(0x08, CF_30, TEXT_BCLR,  M_IX16, M_IM8),
     E2(0x09, CF_30, TEXT_BSET,  M_IX16, M_IM8),
-    E3(0x0A, CF_30, TEXT_BRCLR, M_IX16, M_IM8, M_RL16),
-    E3(0x0B, CF_30, TEXT_BRSET, M_IX16, M_IM8, M_RL16),
+    E3(0x0A, CF_30, flowBranch(TEXT_BRCLR), M_IX16, M_IM8, M_RL16),
+    E3(0x0B, CF_30, flowBranch(TEXT_BRSET), M_IX16, M_IM8, M_RL16),
 };
 
 constexpr uint8_t MC68HC16_IX16_INDEX[] PROGMEM = {
@@ -33,8 +33,8 @@ namespace mos6502 {
 // clang-format off
 constexpr Entry MOS6502_TABLE[] PROGMEM = {
     E0(0x00, TEXT_BRK),
-    E0(0x40, TEXT_RTI),
-    E0(0x60, TEXT_RTS),
+    E0(0x40, flowEnd(TEXT_RTI)),
+    E0(0x60, flowEnd(TEXT_RTS)),
     E0(0xEA, TEXT_NOP),
     E0(0x08, TEXT_PHP),
     E0(0x28, TEXT_PLP),
@@ -132,8 +132,8 @@ constexpr Entry MOS6502_TABLE[] PROGMEM = {
     E1(0x2E, TEXT_ROL, M_ABS),
     E1(0x4E, TEXT_LSR, M_ABS),
     E1(0x6E, TEXT_ROR, M_ABS),
-    E1(0x4C, TEXT_JMP, M_ABS),
-    E1(0x20, TEXT_JSR, M_ABS),
+    E1(0x4C, flowJump(TEXT_JMP),   M_ABS),
+    E1(0x20, flowBranch(TEXT_JSR), M_ABS),
     E2(0x1D, TEXT_ORA, M_ABS, M_REGX),
     E2(0x3D, TEXT_AND, M_ABS, M_REGX),
     E2(0x5D, TEXT_EOR, M_ABS, M_REGX),
@@ -158,7 +158,7 @@ constexpr Entry MOS6502_TABLE[] PROGMEM = {
     E2(0x3E, TEXT_ROL, M_ABS, M_REGX),
     E2(0x5E, TEXT_LSR, M_ABS, M_REGX),
     E2(0x7E, TEXT_ROR, M_ABS, M_REGX),
-    E1(0x6C, TEXT_JMP, I_ABS),
+    E1(0x6C, flowEnd(TEXT_JMP), I_ABS),
     E2(0x01, TEXT_ORA, I_DPG, I_REGX),
     E2(0x21, TEXT_AND, I_DPG, I_REGX),
     E2(0x41, TEXT_EOR, I_DPG, I_REGX),
@@ -175,14 +175,14 @@ constexpr Entry MOS6502_TABLE[] PROGMEM = {
     E2(0xB1, TEXT_LDA, I_DPG, M_REGY),
     E2(0xD1, TEXT_CMP, I_DPG, M_REGY),
     E2(0xF1, TEXT_SBC, I_DPG, M_REGY),
-    E1(0x10, TEXT_BPL, M_REL),
-    E1(0x30, TEXT_BMI, M_REL),
-    E1(0x50, TEXT_BVC, M_REL),
-    E1(0x70, TEXT_BVS, M_REL),
-    E1(0x90, TEXT_BCC, M_REL),
-    E1(0xB0, TEXT_BCS, M_REL),
-    E1(0xD0, TEXT_BNE, M_REL),
-    E1(0xF0, TEXT_BEQ, M_REL),
+    E1(0x10, flowBranch(TEXT_BPL), M_REL),
+    E1(0x30, flowBranch(TEXT_BMI), M_REL),
+    E1(0x50, flowBranch(TEXT_BVC), M_REL),
+    E1(0x70, flowBranch(TEXT_BVS), M_REL),
+    E1(0x90, flowBranch(TEXT_BCC), M_REL),
+    E1(0xB0, flowBranch(TEXT_BCS), M_REL),
+    E1(0xD0, flowBranch(TEXT_BNE), M_REL),
+    E1(0xF0, flowBranch(TEXT_BEQ), M_REL),
 };
 
 constexpr uint8_t MOS6502_INDEX[] PROGMEM = {
@@ -357,7 +357,7 @@ constexpr Entry G65SC02_TABLE[] PROGMEM = {
     E1(0x9C, TEXT_STZ, M_ABS),
     E2(0x3C, TEXT_BIT, M_ABS, M_REGX),
     E2(0x9E, TEXT_STZ, M_ABS, M_REGX),
-    E2(0x7C, TEXT_JMP, I_ABS, I_REGX),
+    E2(0x7C, flowEnd(TEXT_JMP), I_ABS, I_REGX),
     E1(0x12, TEXT_ORA, I_DPG),
     E1(0x32, TEXT_AND, I_DPG),
     E1(0x52, TEXT_EOR, I_DPG),
@@ -366,7 +366,7 @@ constexpr Entry G65SC02_TABLE[] PROGMEM = {
     E1(0xB2, TEXT_LDA, I_DPG),
     E1(0xD2, TEXT_CMP, I_DPG),
     E1(0xF2, TEXT_SBC, I_DPG),
-    E1(0x80, TEXT_BRA, M_REL),
+    E1(0x80, flowJump(TEXT_BRA), M_REL),
 };
 
 constexpr uint8_t G65SC02_INDEX[] PROGMEM = {
@@ -400,22 +400,22 @@ constexpr uint8_t G65SC02_INDEX[] PROGMEM = {
 };
 
 constexpr Entry R65C02_TABLE[] PROGMEM = {
-    E2(0x0F, TEXT_BBR0, M_DPG, M_REL),
-    E2(0x1F, TEXT_BBR1, M_DPG, M_REL),
-    E2(0x2F, TEXT_BBR2, M_DPG, M_REL),
-    E2(0x3F, TEXT_BBR3, M_DPG, M_REL),
-    E2(0x4F, TEXT_BBR4, M_DPG, M_REL),
-    E2(0x5F, TEXT_BBR5, M_DPG, M_REL),
-    E2(0x6F, TEXT_BBR6, M_DPG, M_REL),
-    E2(0x7F, TEXT_BBR7, M_DPG, M_REL),
-    E2(0x8F, TEXT_BBS0, M_DPG, M_REL),
-    E2(0x9F, TEXT_BBS1, M_DPG, M_REL),
-    E2(0xAF, TEXT_BBS2, M_DPG, M_REL),
-    E2(0xBF, TEXT_BBS3, M_DPG, M_REL),
-    E2(0xCF, TEXT_BBS4, M_DPG, M_REL),
-    E2(0xDF, TEXT_BBS5, M_DPG, M_REL),
-    E2(0xEF, TEXT_BBS6, M_DPG, M_REL),
-    E2(0xFF, TEXT_BBS7, M_DPG, M_REL),
+    E2(0x0F, flowBranch(TEXT_BBR0), M_DPG, M_REL),
+    E2(0x1F, flowBranch(TEXT_BBR1), M_DPG, M_REL),
+    E2(0x2F, flowBranch(TEXT_BBR2), M_DPG, M_REL),
+    E2(0x3F, flowBranch(TEXT_BBR3), M_DPG, M_REL),
+    E2(0x4F, flowBranch(TEXT_BBR4), M_DPG, M_REL),
+    E2(0x5F, flowBranch(TEXT_BBR5), M_DPG, M_REL),
+    E2(0x6F, flowBranch(TEXT_BBR6), M_DPG, M_REL),
+    E2(0x7F, flowBranch(TEXT_BBR7), M_DPG, M_REL),
+    E2(0x8F, flowBranch(TEXT_BBS0), M_DPG, M_REL),
+    E2(0x9F, flowBranch(TEXT_BBS1), M_DPG, M_REL),
+    E2(0xAF, flowBranch(TEXT_BBS2), M_DPG, M_REL),
+    E2(0xBF, flowBranch(TEXT_BBS3), M_DPG, M_REL),
+    E2(0xCF, flowBranch(TEXT_BBS4), M_DPG, M_REL),
+    E2(0xDF, flowBranch(TEXT_BBS5), M_DPG, M_REL),
+    E2(0xEF, flowBranch(TEXT_BBS6), M_DPG, M_REL),
+    E2(0xFF, flowBranch(TEXT_BBS7), M_DPG, M_REL),
     E1(0x07, TEXT_RMB0, M_DPG),
     E1(0x17, TEXT_RMB1, M_DPG),
     E1(0x27, TEXT_RMB2, M_DPG),
@@ -486,7 +486,7 @@ constexpr Entry W65C816_TABLE[] PROGMEM = {
     E0(0x3B, TEXT_TSC),
     E0(0x4B, TEXT_PHK),
     E0(0x5B, TEXT_TCD),
-    E0(0x6B, TEXT_RTL),
+    E0(0x6B, flowEnd(TEXT_RTL)),
     E0(0x7B, TEXT_TDC),
     E0(0x8B, TEXT_PHB),
     E0(0x9B, TEXT_TXY),
@@ -498,12 +498,12 @@ constexpr Entry W65C816_TABLE[] PROGMEM = {
     E1(0x42, TEXT_WDM, M_IM8),
     E1(0xC2, TEXT_REP, M_IM8),
     E1(0xE2, TEXT_SEP, M_IM8),
-    E1(0x5C, TEXT_JMP, M_ABSL),
-    E1(0xDC, TEXT_JMP, L_ABS),
+    E1(0x5C, flowJump(TEXT_JMP),   M_ABSL),
+    E1(0xDC, flowEnd(TEXT_JMP),    L_ABS),
     E2(0xFC, TEXT_JSR, I_ABS,  I_REGX),
-    E1(0x22, TEXT_JSL, M_ABSL),
+    E1(0x22, flowBranch(TEXT_JSL), M_ABSL),
     E1(0x62, TEXT_PER, M_LREL),
-    E1(0x82, TEXT_BRL, M_LREL),
+    E1(0x82, flowJump(TEXT_BRL), M_LREL),
     E1(0xD4, TEXT_PEI, I_DPG),
     E1(0xF4, TEXT_PEA, M_ABS),
     E2(0x44, TEXT_MVP, M_BANK, M_BANK),
@@ -556,7 +556,7 @@ constexpr Entry W65C816_TABLE[] PROGMEM = {
     E2(0xF7, TEXT_SBC, L_DPG,  M_REGY),
     E1(0xEF, TEXT_SBC, M_ABSL),
     E2(0xFF, TEXT_SBC, M_ABSL, M_REGX),
-    E1(0xDC, TEXT_JMPL, I_ABS),
+    E1(0xDC, flowEnd(TEXT_JMPL), I_ABS),
     E1(0x07, TEXT_ORAL, I_DPG),
     E2(0x17, TEXT_ORAL, I_DPG, M_REGY),
     E1(0x27, TEXT_ANDL, I_DPG),
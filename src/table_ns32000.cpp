@@ -39,21 +39,21 @@ namespace ns32000 {
 // clang-format off
 // Format 0: |cond|1010|
 constexpr Entry FORMAT_0[] PROGMEM = {
-    E1(0x0A, TEXT_BEQ, SZ_NONE, M_REL, P_DISP),
-    E1(0x1A, TEXT_BNE, SZ_NONE, M_REL, P_DISP),
-    E1(0x2A, TEXT_BCS, SZ_NONE, M_REL, P_DISP),
-    E1(0x3A, TEXT_BCC, SZ_NONE, M_REL, P_DISP),
-    E1(0x4A, TEXT_BHI, SZ_NONE, M_REL, P_DISP),
-    E1(0x5A, TEXT_BLS, SZ_NONE, M_REL, P_DISP),
-    E1(0x6A, TEXT_BGT, SZ_NONE, M_REL, P_DISP),
-    E1(0x7A, TEXT_BLE, SZ_NONE, M_REL, P_DISP),
-    E1(0x8A, TEXT_BFS, SZ_NONE, M_REL, P_DISP),
-    E1(0x9A, TEXT_BFC, SZ_NONE, M_REL, P_DISP),
-    E1(0xAA, TEXT_BLO, SZ_NONE, M_REL, P_DISP),
-    E1(0xBA, TEXT_BHS, SZ_NONE, M_REL, P_DISP),
-    E1(0xCA, TEXT_BLT, SZ_NONE, M_REL, P_DISP),
-    E1(0xDA, TEXT_BGE, SZ_NONE, M_REL, P_DISP),
-    E1(0xEA, TEXT_BR,  SZ_NONE, M_REL, P_DISP),
+    E1(0x0A, flowBranch(TEXT_BEQ), SZ_NONE, M_REL, P_DISP),
+    E1(0x1A, flowBranch(TEXT_BNE), SZ_NONE, M_REL, P_DISP),
+    E1(0x2A, flowBranch(TEXT_BCS), SZ_NONE, M_REL, P_DISP),
+    E1(0x3A, flowBranch(TEXT_BCC), SZ_NONE, M_REL, P_DISP),
+    E1(0x4A, flowBranch(TEXT_BHI), SZ_NONE, M_REL, P_DISP),
+    E1(0x5A, flowBranch(TEXT_BLS), SZ_NONE, M_REL, P_DISP),
+    E1(0x6A, flowBranch(TEXT_BGT), SZ_NONE, M_REL, P_DISP),
+    E1(0x7A, flowBranch(TEXT_BLE), SZ_NONE, M_REL, P_DISP),
+    E1(0x8A, flowBranch(TEXT_BFS), SZ_NONE, M_REL, P_DISP),
+    E1(0x9A, flowBranch(TEXT_BFC), SZ_NONE, M_REL, P_DISP),
+    E1(0xAA, flowBranch(TEXT_BLO), SZ_NONE, M_REL, P_DISP),
+    E1(0xBA, flowBranch(TEXT_BHS), SZ_NONE, M_REL, P_DISP),
+    E1(0xCA, flowBranch(TEXT_BLT), SZ_NONE, M_REL, P_DISP),
+    E1(0xDA, flowBranch(TEXT_BGE), SZ_NONE, M_REL, P_DISP),
+    E1(0xEA, flowJump(TEXT_BR),    SZ_NONE, M_REL, P_DISP),
 };
 constexpr uint8_t INDEX_0[] PROGMEM = {
       3,  // TEXT_BCC
@@ -75,12 +75,12 @@ constexpr uint8_t INDEX_0[] PROGMEM = {
 
 // Format 1: |_op_|0010|
 constexpr Entry FORMAT_1[] PROGMEM = {
-    E1(0x02, TEXT_BSR,     SZ_NONE,   M_REL, P_DISP),
-    E1(0x12, TEXT_RET,     SZ_NONE,   M_DISP, P_DISP),
+    E1(0x02, flowBranch(TEXT_BSR), SZ_NONE,   M_REL, P_DISP),
+    E1(0x12, flowEnd(TEXT_RET),    SZ_NONE,   M_DISP, P_DISP),
     E1(0x22, TEXT_CXP,     SZ_NONE,   M_DISP, P_DISP),
-    E1(0x32, TEXT_RXP,     SZ_NONE,   M_DISP, P_DISP),
-    E1(0x42, TEXT_RETT,    SZ_NONE,   M_DISP, P_DISP),
-    E0(0x52, TEXT_RETI),
+    E1(0x32, flowEnd(TEXT_RXP),  SZ_NONE,   M_DISP, P_DISP),
+    E1(0x42, flowEnd(TEXT_RETT), SZ_NONE,   M_DISP, P_DISP),
+    E0(0x52, flowEnd(TEXT_RETI)),
     E1(0x62, TEXT_SAVE,    SZ_NONE,   M_RLST, P_IMPL),
     E1(0x72, TEXT_RESTORE, SZ_QUAD, M_RLST, P_IMPL),
     E2(0x82, TEXT_ENTER,   SZ_NONE,   M_RLST, M_DISP, P_IMPL, P_DISP),
@@ -196,9 +196,9 @@ constexpr Entry FORMAT_2_0[] PROGMEM = {
     E2(0x2C, TEXT_SPRB,  SZ_BYTE, M_PREG, M_GENW, P_SHORT, P_GEN1),
     E2(0x2D, TEXT_SPRW,  SZ_WORD, M_PREG, M_GENW, P_SHORT, P_GEN1),
     E2(0x2F, TEXT_SPRD,  SZ_QUAD, M_PREG, M_GENW, P_SHORT, P_GEN1),
-    E3(0x4C, TEXT_ACBB,  SZ_BYTE, M_INT4, M_GENW, P_SHORT, P_GEN1, M_REL, P_DISP),
-    E3(0x4D, TEXT_ACBW,  SZ_WORD, M_INT4, M_GENW, P_SHORT, P_GEN1, M_REL, P_DISP),
-    E3(0x4F, TEXT_ACBD,  SZ_QUAD, M_INT4, M_GENW, P_SHORT, P_GEN1, M_REL, P_DISP),
+    E3(0x4C, flowBranch(TEXT_ACBB), SZ_BYTE, M_INT4, M_GENW, P_SHORT, P_GEN1, M_REL, P_DISP),
+    E3(0x4D, flowBranch(TEXT_ACBW), SZ_WORD, M_INT4, M_GENW, P_SHORT, P_GEN1, M_REL, P_DISP),
+    E3(0x4F, flowBranch(TEXT_ACBD), SZ_QUAD, M_INT4, M_GENW, P_SHORT, P_GEN1, M_REL, P_DISP),
     E2(0x5C, TEXT_MOVQB, SZ_BYTE, M_INT4, M_GENW, P_SHORT, P_GEN1),
     E2(0x5D, TEXT_MOVQW, SZ_WORD, M_INT4, M_GENW, P_SHORT, P_GEN1),
     E2(0x5F, TEXT_MOVQD, SZ_QUAD, M_INT4, M_GENW, P_SHORT, P_GEN1),
@@ -341,20 +341,20 @@ constexpr Entry FORMAT_3_1[] PROGMEM = {
     E1(0x01, TEXT_BICPSRB, SZ_BYTE, M_GENR, P_GEN1),
     E1(0x03, TEXT_BISPSRB, SZ_BYTE, M_GENR, P_GEN1),
     E1(0x05, TEXT_ADJSPB,  SZ_BYTE, M_GENR, P_GEN1),
-    E1(0x07, TEXT_CASEB,   SZ_BYTE, M_GENR, P_GEN1),
+    E1(0x07, flowEnd(TEXT_CASEB), SZ_BYTE, M_GENR, P_GEN1),
 };
 constexpr Entry FORMAT_3_2[] PROGMEM = {
     E1(0x01, TEXT_BICPSRW, SZ_WORD, M_GENR, P_GEN1),
     E1(0x03, TEXT_BISPSRW, SZ_WORD, M_GENR, P_GEN1),
     E1(0x05, TEXT_ADJSPW,  SZ_WORD, M_GENR, P_GEN1),
-    E1(0x07, TEXT_CASEW,   SZ_WORD, M_GENR, P_GEN1),
+    E1(0x07, flowEnd(TEXT_CASEW), SZ_WORD, M_GENR, P_GEN1),
 };
 constexpr Entry FORMAT_3_3[] PROGMEM = {
     E1(0x00, TEXT_CXPD,   SZ_QUAD, M_GENA, P_GEN1),
-    E1(0x02, TEXT_JUMP,   SZ_QUAD, M_GENA, P_GEN1),
+    E1(0x02, flowJump(TEXT_JUMP), SZ_QUAD, M_GENA, P_GEN1),
     E1(0x05, TEXT_ADJSPD, SZ_QUAD, M_GENR, P_GEN1),
-    E1(0x06, TEXT_JSR,    SZ_QUAD, M_GENA, P_GEN1),
-    E1(0x07, TEXT_CASED,  SZ_QUAD, M_GENR, P_GEN1),
+    E1(0x06, flowBranch(TEXT_JSR), SZ_QUAD, M_GENA, P_GEN1),
+    E1(0x07, flowEnd(TEXT_CASED),  SZ_QUAD, M_GENR, P_GEN1),
 };
 constexpr uint8_t INDEX_3_1[] PROGMEM = {
       2,  // TEXT_ADJSPB
@@ -44,7 +44,7 @@ constexpr Entry TABLE_BASE[] PROGMEM = {
     E2(0060000, SZ_INTG, TEXT_ADD,   M_GENS, P_7700, M_GEND, P_0077),
     E2(0160000, SZ_INTG, TEXT_SUB,   M_GENS, P_7700, M_GEND, P_0077),
     E2(0074000, SZ_WORD, TEXT_XOR,   M_GENR, P_0700, M_GEND, P_0077),
-    E1(0000100, SZ_WORD, TEXT_JMP,   M_GENA, P_0077),
+    E1(0000100, SZ_WORD, flowJump(TEXT_JMP), M_GENA, P_0077),
     E1(0000300, SZ_WORD, TEXT_SWAB,  M_GEND, P_0077),
     E1(0005000, SZ_WORD, TEXT_CLR,   M_GEND, P_0077),
     E1(0105000, SZ_BYTE, TEXT_CLRB,  M_GEND, P_0077),
@@ -73,32 +73,32 @@ constexpr Entry TABLE_BASE[] PROGMEM = {
     E1(0106400, SZ_BYTE, TEXT_MTPS,  M_GENS, P_0077),
     E1(0006700, SZ_WORD, TEXT_SXT,   M_GEND, P_0077),
     E1(0106700, SZ_BYTE, TEXT_MFPS,  M_GEND, P_0077),
-    E1(0000400, SZ_NONE, TEXT_BR,    M_REL8, P_0377),
-    E1(0001000, SZ_NONE, TEXT_BNE,   M_REL8, P_0377),
-    E1(0001400, SZ_NONE, TEXT_BEQ,   M_REL8, P_0377),
-    E1(0002000, SZ_NONE, TEXT_BGE,   M_REL8, P_0377),
-    E1(0002400, SZ_NONE, TEXT_BLT,   M_REL8, P_0377),
-    E1(0003000, SZ_NONE, TEXT_BGT,   M_REL8, P_0377),
-    E1(0003400, SZ_NONE, TEXT_BLE,   M_REL8, P_0377),
-    E1(0100000, SZ_NONE, TEXT_BPL,   M_REL8, P_0377),
-    E1(0100400, SZ_NONE, TEXT_BMI,   M_REL8, P_0377),
-    E1(0101000, SZ_NONE, TEXT_BHI,   M_REL8, P_0377),
-    E1(0101400, SZ_NONE, TEXT_BLOS,  M_REL8, P_0377),
-    E1(0102000, SZ_NONE, TEXT_BVC,   M_REL8, P_0377),
-    E1(0102400, SZ_NONE, TEXT_BVS,   M_REL8, P_0377),
-    E1(0103000, SZ_NONE, TEXT_BCC,   M_REL8, P_0377),
-    E1(0103400, SZ_NONE, TEXT_BCS,   M_REL8, P_0377),
-    E1(0103000, SZ_NONE, TEXT_BHIS,  M_REL8, P_0377),
-    E1(0103400, SZ_NONE, TEXT_BLO,   M_REL8, P_0377),
-    E2(0077000, SZ_NONE, TEXT_SOB,   M_GENR, P_0700, M_REL6, P_0077),
-    E2(0004000, SZ_WORD, TEXT_JSR,   M_GENR, P_0700, M_GENA, P_0077),
-    E1(0000200, SZ_NONE, TEXT_RTS,   M_GENR, P_0007),
+    E1(0000400, SZ_NONE, flowJump(TEXT_BR),     M_REL8, P_0377),
+    E1(0001000, SZ_NONE, flowBranch(TEXT_BNE),  M_REL8, P_0377),
+    E1(0001400, SZ_NONE, flowBranch(TEXT_BEQ),  M_REL8, P_0377),
+    E1(0002000, SZ_NONE, flowBranch(TEXT_BGE),  M_REL8, P_0377),
+    E1(0002400, SZ_NONE, flowBranch(TEXT_BLT),  M_REL8, P_0377),
+    E1(0003000, SZ_NONE, flowBranch(TEXT_BGT),  M_REL8, P_0377),
+    E1(0003400, SZ_NONE, flowBranch(TEXT_BLE),  M_REL8, P_0377),
+    E1(0100000, SZ_NONE, flowBranch(TEXT_BPL),  M_REL8, P_0377),
+    E1(0100400, SZ_NONE, flowBranch(TEXT_BMI),  M_REL8, P_0377),
+    E1(0101000, SZ_NONE, flowBranch(TEXT_BHI),  M_REL8, P_0377),
+    E1(0101400, SZ_NONE, flowBranch(TEXT_BLOS), M_REL8, P_0377),
+    E1(0102000, SZ_NONE, flowBranch(TEXT_BVC),  M_REL8, P_0377),
+    E1(0102400, SZ_NONE, flowBranch(TEXT_BVS),  M_REL8, P_0377),
+    E1(0103000, SZ_NONE, flowBranch(TEXT_BCC),  M_REL8, P_0377),
+    E1(0103400, SZ_NONE, flowBranch(TEXT_BCS),  M_REL8, P_0377),
+    E1(0103000, SZ_NONE, flowBranch(TEXT_BHIS), M_REL8, P_0377),
+    E1(0103400, SZ_NONE, flowBranch(TEXT_BLO),  M_REL8, P_0377),
+    E2(0077000, SZ_NONE, flowBranch(TEXT_SOB),  M_GENR, P_0700, M_REL6, P_0077),
+    E2(0004000, SZ_WORD, flowBranch(TEXT_JSR),  M_GENR, P_0700, M_GENA, P_0077),
+    E1(0000200, SZ_NONE, flowEnd(TEXT_RTS),     M_GENR, P_0007),
     E1(0104000, SZ_NONE, TEXT_EMT,   M_IMM8, P_0377),
     E1(0104400, SZ_NONE, TEXT_TRAP,  M_IMM8, P_0377),
-    E0(0000002, SZ_NONE, TEXT_RTI),
+    E0(0000002, SZ_NONE, flowEnd(TEXT_RTI)),
     E0(0000003, SZ_NONE, TEXT_BPT),
     E0(0000004, SZ_NONE, TEXT_IOT),
-    E0(0000006, SZ_NONE, TEXT_RTT),
+    E0(0000006, SZ_NONE, flowEnd(TEXT_RTT)),
     E0(0000000, SZ_NONE, TEXT_HALT),
     E0(0000001, SZ_NONE, TEXT_WAIT),
     E0(0000005, SZ_NONE, TEXT_RESET),
@@ -233,7 +233,7 @@ constexpr uint8_t INDEX_MFPMTP[] PROGMEM = {
 };
 
 constexpr Entry TABLE_J11[] PROGMEM = {
-    E1(0006400, SZ_NONE, TEXT_MARK,  M_IMM6, P_0077),
+    E1(0006400, SZ_NONE, flowEnd(TEXT_MARK), M_IMM6, P_0077),
     E1(0007000, SZ_WORD, TEXT_CSM,   M_GENS, P_0077),
     E1(0000230, SZ_NONE, TEXT_SPL,   M_IMM3, P_0007),
     E1(0007200, SZ_WORD, TEXT_TSTSET, M_GENA, P_0077),
@@ -38,18 +38,18 @@ constexpr Entry TABLE_2650[] PROGMEM = {
     E2(0x0C, CF_03, TEXT_LODA, M_REGN, M_AB13),
     E0(0x12, CF_00, TEXT_SPSU),
     E0(0x13, CF_00, TEXT_SPSL),
-    E1(0x14, CF_03, TEXT_RETC, M_CCVN),
-    E2(0x18, CF_03, TEXT_BCTR, M_CCVN, M_REL7),
-    E2(0x1C, CF_03, TEXT_BCTA, M_CCVN, M_AB15),
+    E1(0x14, CF_03, flowEnd(TEXT_RETC),  M_CCVN),
+    E2(0x18, CF_03, flowJump(TEXT_BCTR), M_CCVN, M_REL7),
+    E2(0x1C, CF_03, flowJump(TEXT_BCTA), M_CCVN, M_AB15),
     E1(0x20, CF_03, TEXT_EORZ, M_REGN),
     E2(0x24, CF_03, TEXT_EORI, M_REGN, M_IMM8),
     E2(0x28, CF_03, TEXT_EORR, M_REGN, M_REL7),
     E2(0x2C, CF_03, TEXT_EORA, M_REG0, M_IX13),
     E2(0x2C, CF_03, TEXT_EORA, M_REGN, M_AB13),
     E1(0x30, CF_03, TEXT_REDC, M_REGN),
-    E1(0x34, CF_03, TEXT_RETE, M_CCVN),
-    E2(0x38, CF_03, TEXT_BSTR, M_CCVN, M_REL7),
-    E2(0x3C, CF_03, TEXT_BSTA, M_CCVN, M_AB15),
+    E1(0x34, CF_03, flowEnd(TEXT_RETE),    M_CCVN),
+    E2(0x38, CF_03, flowBranch(TEXT_BSTR), M_CCVN, M_REL7),
+    E2(0x3C, CF_03, flowBranch(TEXT_BSTA), M_CCVN, M_AB15),
     E0(0x40, CF_00, TEXT_HALT),
     E1(0x40, CF_03, TEXT_ANDZ, M_R123),
     E2(0x44, CF_03, TEXT_ANDI, M_REGN, M_IMM8),
@@ -58,8 +58,8 @@ constexpr Entry TABLE_2650[] PROGMEM = {
     E2(0x4C, CF_03, TEXT_ANDA, M_REGN, M_AB13),
     E1(0x50, CF_03, TEXT_RRR,  M_REGN),
     E2(0x54, CF_03, TEXT_REDE, M_REGN, M_IMM8),
-    E2(0x58, CF_03, TEXT_BRNR, M_REGN, M_REL7),
-    E2(0x5C, CF_03, TEXT_BRNA, M_REGN, M_AB15),
+    E2(0x58, CF_03, flowBranch(TEXT_BRNR), M_REGN, M_REL7),
+    E2(0x5C, CF_03, flowBranch(TEXT_BRNA), M_REGN, M_AB15),
     E1(0x60, CF_00, TEXT_LODZ, M_REG0),
     E1(0x60, CF_03, TEXT_IORZ, M_REGN),
     E2(0x64, CF_03, TEXT_IORI, M_REGN, M_IMM8),
@@ -71,8 +71,8 @@ constexpr Entry TABLE_2650[] PROGMEM = {
     E1(0x75, CF_00, TEXT_CPSL, M_IMM8),
     E1(0x76, CF_00, TEXT_PPSU, M_IMM8),
     E1(0x77, CF_00, TEXT_PPSL, M_IMM8),
-    E2(0x78, CF_03, TEXT_BSNR, M_REGN, M_REL7),
-    E2(0x7C, CF_03, TEXT_BSNA, M_REGN, M_AB15),
+    E2(0x78, CF_03, flowBranch(TEXT_BSNR), M_REGN, M_REL7),
+    E2(0x7C, CF_03, flowBranch(TEXT_BSNA), M_REGN, M_AB15),
     E1(0x80, CF_03, TEXT_ADDZ, M_REGN),
     E2(0x84, CF_03, TEXT_ADDI, M_REGN, M_IMM8),
     E2(0x88, CF_03, TEXT_ADDR, M_REGN, M_REL7),
@@ -81,10 +81,10 @@ constexpr Entry TABLE_2650[] PROGMEM = {
     E0(0x92, CF_00, TEXT_LPSU),
     E0(0x93, CF_00, TEXT_LPSL),
     E1(0x94, CF_03, TEXT_DAR,  M_REGN),
-    E1(0x9B, CF_00, TEXT_ZBRR, M_ABS7),
-    E2(0x98, CF_03, TEXT_BCFR, M_C012, M_REL7),
-    E1(0x9F, CF_00, TEXT_BXA,  M_IX15),
-    E2(0x9C, CF_03, TEXT_BCFA, M_C012, M_AB15),
+    E1(0x9B, CF_00, flowJump(TEXT_ZBRR),   M_ABS7),
+    E2(0x98, CF_03, flowBranch(TEXT_BCFR), M_C012, M_REL7),
+    E1(0x9F, CF_00, flowEnd(TEXT_BXA),     M_IX15),
+    E2(0x9C, CF_03, flowBranch(TEXT_BCFA), M_C012, M_AB15),
     E1(0xA0, CF_03, TEXT_SUBZ, M_REGN),
     E2(0xA4, CF_03, TEXT_SUBI, M_REGN, M_IMM8),
     E2(0xA8, CF_03, TEXT_SUBR, M_REGN, M_REL7),
@@ -93,10 +93,10 @@ constexpr Entry TABLE_2650[] PROGMEM = {
     E1(0xB0, CF_03, TEXT_WRTC, M_REGN),
     E1(0xB4, CF_00, TEXT_TPSU, M_IMM8),
     E1(0xB5, CF_00, TEXT_TPSL, M_IMM8),
-    E1(0xBB, CF_00, TEXT_ZBSR, M_ABS7),
-    E2(0xB8, CF_03, TEXT_BSFR, M_C012, M_REL7),
+    E1(0xBB, CF_00, flowBranch(TEXT_ZBSR), M_ABS7),
+    E2(0xB8, CF_03, flowBranch(TEXT_BSFR), M_C012, M_REL7),
     E1(0xBF, CF_00, TEXT_BSXA, M_IX15),
-    E2(0xBC, CF_03, TEXT_BSFA, M_C012, M_AB15),
+    E2(0xBC, CF_03, flowBranch(TEXT_BSFA), M_C012, M_AB15),
     E0(0xC0, CF_00, TEXT_NOP),
     E1(0xC0, CF_03, TEXT_STRZ, M_R123),
     E2(0xC8, CF_03, TEXT_STRR, M_REGN, M_REL7),
@@ -104,8 +104,8 @@ constexpr Entry TABLE_2650[] PROGMEM = {
     E2(0xCC, CF_03, TEXT_STRA, M_REGN, M_AB13),
     E1(0xD0, CF_03, TEXT_RRL,  M_REGN),
     E2(0xD4, CF_03, TEXT_WRTE, M_REGN, M_IMM8),
-    E2(0xD8, CF_03, TEXT_BIRR, M_REGN, M_REL7),
-    E2(0xDC, CF_03, TEXT_BIRA, M_REGN, M_AB15),
+    E2(0xD8, CF_03, flowBranch(TEXT_BIRR), M_REGN, M_REL7),
+    E2(0xDC, CF_03, flowBranch(TEXT_BIRA), M_REGN, M_AB15),
     E1(0xE0, CF_03, TEXT_COMZ, M_REGN),
     E2(0xE4, CF_03, TEXT_COMI, M_REGN, M_IMM8),
     E2(0xE8, CF_03, TEXT_COMR, M_REGN, M_REL7),
@@ -113,8 +113,8 @@ constexpr Entry TABLE_2650[] PROGMEM = {
     E2(0xEC, CF_03, TEXT_COMA, M_REGN, M_AB13),
     E1(0xF0, CF_03, TEXT_WRTD, M_REGN),
     E2(0xF4, CF_03, TEXT_TMI,  M_REGN, M_IMM8),
-    E2(0xF8, CF_03, TEXT_BDRR, M_REGN, M_REL7),
-    E2(0xFC, CF_03, TEXT_BDRA, M_REGN, M_AB15),
+    E2(0xF8, CF_03, flowBranch(TEXT_BDRR), M_REGN, M_REL7),
+    E2(0xFC, CF_03, flowBranch(TEXT_BDRA), M_REGN, M_AB15),
 };
 
 constexpr uint8_t INDEX_2650[] PROGMEM = {
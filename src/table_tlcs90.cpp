@@ -51,14 +51,14 @@ constexpr Entry TABLE_TLCS90[] PROGMEM = {
     E2(0x13, CF_00, TEXT_DIV,  R_HL,    M_IMM8),
     E2(0x17, CF_00, TEXT_LDAR, R_HL,    M_REL16),
     E2(0x14, CF_03, TEXT_ADD,  M_REGIX, M_IMM16),
-    E1(0x18, CF_00, TEXT_DJNZ, M_REL8),
-    E2(0x19, CF_00, TEXT_DJNZ, R_BC,    M_REL8),
-    E1(0x1A, CF_00, TEXT_JP,   M_IMM16),
-    E1(0x1B, CF_00, TEXT_JRL,  M_REL16),
-    E1(0x1C, CF_00, TEXT_CALL, M_IMM16),
-    E1(0x1D, CF_00, TEXT_CALR, M_REL16),
-    E0(0x1E, CF_00, TEXT_RET),
-    E0(0x1F, CF_00, TEXT_RETI),
+    E1(0x18, CF_00, flowBranch(TEXT_DJNZ), M_REL8),
+    E2(0x19, CF_00, flowBranch(TEXT_DJNZ), R_BC,    M_REL8),
+    E1(0x1A, CF_00, flowJump(TEXT_JP),     M_IMM16),
+    E1(0x1B, CF_00, flowJump(TEXT_JRL),    M_REL16),
+    E1(0x1C, CF_00, flowBranch(TEXT_CALL), M_IMM16),
+    E1(0x1D, CF_00, flowBranch(TEXT_CALR), M_REL16),
+    E0(0x1E, CF_00, flowEnd(TEXT_RET)),
+    E0(0x1F, CF_00, flowEnd(TEXT_RETI)),
     E2(0x27, CF_00, TEXT_LD,   R_A,     M_DIR),
     E2(0x20, CF_07, TEXT_LD,   R_A,     M_REG8),
     E2(0x2F, CF_00, TEXT_LD,   M_DIR,   R_A),
@@ -124,8 +124,8 @@ constexpr Entry TABLE_TLCS90[] PROGMEM = {
     E2(0xA8, CF_07, TEXT_BIT,  M_BIT,   M_DIR),
     E2(0xB0, CF_07, TEXT_RES,  M_BIT,   M_DIR),
     E2(0xB8, CF_07, TEXT_SET,  M_BIT,   M_DIR),
-    E1(0xC8, CF_00, TEXT_JR,   M_REL8),
-    E2(0xC0, CF_0F, TEXT_JR,   M_CC,    M_REL8),
+    E1(0xC8, CF_00, flowJump(TEXT_JR), M_REL8),
+    E2(0xC0, CF_0F, flowJump(TEXT_JR), M_CC,    M_REL8),
     E0(0xFF, CF_00, TEXT_SWI),
 };
 
@@ -444,10 +444,10 @@ constexpr uint8_t INDEX_LDA[] PROGMEM = {
 };
 
 constexpr Entry TABLE_JMP[] PROGMEM = {
-    E2(0xC0, CF_0F, TEXT_JP,   M_CC,    M_SRC),
-    E1(0xC8, CF_00, TEXT_JP,   M_DST),
-    E2(0xD0, CF_0F, TEXT_CALL, M_CC,    M_SRC),
-    E1(0xD8, CF_00, TEXT_CALL, M_DST),
+    E2(0xC0, CF_0F, flowJump(TEXT_JP),     M_CC,    M_SRC),
+    E1(0xC8, CF_00, flowJump(TEXT_JP),     M_DST),
+    E2(0xD0, CF_0F, flowBranch(TEXT_CALL), M_CC,    M_SRC),
+    E1(0xD8, CF_00, flowBranch(TEXT_CALL), M_DST),
 };
 
 constexpr uint8_t INDEX_JMP[] PROGMEM = {
@@ -458,8 +458,8 @@ constexpr uint8_t INDEX_JMP[] PROGMEM = {
 };
 
 constexpr Entry TABLE_COND[] PROGMEM = {
-    E0(0xD8, CF_00, TEXT_RET),
-    E1(0xD0, CF_0F, TEXT_RET,  M_CC),
+    E0(0xD8, CF_00, flowEnd(TEXT_RET)),
+    E1(0xD0, CF_0F, flowEnd(TEXT_RET), M_CC),
 };
 
 constexpr uint8_t INDEX_COND[] PROGMEM = {
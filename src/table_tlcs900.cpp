@@ -40,16 +40,16 @@ constexpr Entry TABLE_OPC[] PROGMEM = {
     E1(0x03,  CF_00, TEXT_POP,   SM_ANY, R_SR),                 // POP SR
     E0(0x05,  CF_00, TEXT_HALT,  SM_ANY),                       // HALT
     E1(0x06,  CF_00, TEXT_EI,    SM_ANY, M_INTLVL),             // EI #
-    E0(0x07,  CF_00, TEXT_RETI,  SM_ANY),                       // RETI
+    E0(0x07,  CF_00, flowEnd(TEXT_RETI), SM_ANY),               // RETI
     E2(0x08,  CF_00, TEXT_LD,    SM_ANY, M_ABS8,   M_IMM8),     // LD (n),#
     E1(0x09,  CF_00, TEXT_PUSH,  SM_ANY, M_IMM8),               // PUSH #
     E2(0x0A,  CF_00, TEXT_LDW,   SM_ANY, M_ABS8,   M_IMM16),    // LDW (n),#
     E1(0x0B,  CF_00, TEXT_PUSHW, SM_ANY, M_IMM16),              // PUSHW #
     E0(0x0C,  CF_00, TEXT_INCF,  SM_ANY),                       // INCF
     E0(0x0D,  CF_00, TEXT_DECF,  SM_ANY),                       // DECF
-    E0(0x0E,  CF_00, TEXT_RET,   SM_ANY),                       // RET
-    E1(0x0E,  CF_00, TEXT_RET,   SM_ANY, M_CCT),                // RET T
-    E1(0x0F,  CF_00, TEXT_RETD,  SM_ANY, M_IMM16),              // RETD #
+    E0(0x0E,  CF_00, flowEnd(TEXT_RET),  SM_ANY),               // RET
+    E1(0x0E,  CF_00, flowEnd(TEXT_RET),  SM_ANY, M_CCT),        // RET T
+    E1(0x0F,  CF_00, flowEnd(TEXT_RETD), SM_ANY, M_IMM16),      // RETD #
     E0(0x10,  CF_00, TEXT_RCF,   SM_ANY),                       // RCF
     E0(0x11,  CF_00, TEXT_SCF,   SM_ANY),                       // SCF
     E0(0x12,  CF_00, TEXT_CCF,   SM_ANY),                       // CCF
@@ -60,15 +60,15 @@ constexpr Entry TABLE_OPC[] PROGMEM = {
     E1(0x17,  CF_00, TEXT_LDF,   SM_ANY, M_LDF),                // LDF #
     E1(0x18,  CF_00, TEXT_PUSH,  SM_ANY, R_F),                  // PUSH F
     E1(0x19,  CF_00, TEXT_POP,   SM_ANY, R_F),                  // POP F
-    E1(0x1A,  CF_00, TEXT_JP,    SM_ANY, M_ABS16),              // JP (nn)
-    E1(0x1B,  CF_00, TEXT_JP,    SM_ANY, M_ABS24),              // JP (nnn)
-    E1(0x1C,  CF_00, TEXT_CALL,  SM_ANY, M_ABS16),              // CALL (nn)
-    E1(0x1D,  CF_00, TEXT_CALL,  SM_ANY, M_ABS24),              // CALL (nnn)
-    E2(0x1A,  CF_00, TEXT_JP,    SM_ANY, M_CCT,    M_ABS16),    // JP T,(nn)
-    E2(0x1B,  CF_00, TEXT_JP,    SM_ANY, M_CCT,    M_ABS24),    // JP T,(nnn)
-    E2(0x1C,  CF_00, TEXT_CALL,  SM_ANY, M_CCT,    M_ABS16),    // CALL T,(nn)
-    E2(0x1D,  CF_00, TEXT_CALL,  SM_ANY, M_CCT,    M_ABS24),    // CALL T,(nnn)
-    E1(0x1E,  CF_00, TEXT_CALR,  SM_ANY, M_REL16),              // CALR $
+    E1(0x1A,  CF_00, flowJump(TEXT_JP),     SM_ANY, M_ABS16),   // JP (nn)
+    E1(0x1B,  CF_00, flowJump(TEXT_JP),     SM_ANY, M_ABS24),   // JP (nnn)
+    E1(0x1C,  CF_00, flowBranch(TEXT_CALL), SM_ANY, M_ABS16),   // CALL (nn)
+    E1(0x1D,  CF_00, flowBranch(TEXT_CALL), SM_ANY, M_ABS24),   // CALL (nnn)
+    E2(0x1A,  CF_00, flowJump(TEXT_JP),     SM_ANY, M_CCT,    M_ABS16),  // JP T,(nn)
+    E2(0x1B,  CF_00, flowJump(TEXT_JP),     SM_ANY, M_CCT,    M_ABS24),  // JP T,(nnn)
+    E2(0x1C,  CF_00, flowBranch(TEXT_CALL), SM_ANY, M_CCT,    M_ABS16),  // CALL T,(nn)
+    E2(0x1D,  CF_00, flowBranch(TEXT_CALL), SM_ANY, M_CCT,    M_ABS24),  // CALL T,(nnn)
+    E1(0x1E,  CF_00, flowBranch(TEXT_CALR), SM_ANY, M_REL16),   // CALR $
     E2(0x20,  CF_07, TEXT_LD,    SM_ANY, M_REG8,   M_IMM8),     // LD r,#
     E1(0x28,  CF_07, TEXT_PUSH,  SM_ANY, M_REG16),              // PUSH r
     E2(0x30,  CF_07, TEXT_LD,    SM_ANY, M_REG16,  M_IMM16),    // LD r,#
@@ -76,8 +76,8 @@ constexpr Entry TABLE_OPC[] PROGMEM = {
     E2(0x40,  CF_07, TEXT_LD,    SM_ANY, M_REG32,  M_IMM32),    // LD r,#
     E1(0x48,  CF_07, TEXT_POP,   SM_ANY, M_REG16),              // POP r
     E1(0x58,  CF_07, TEXT_POP,   SM_ANY, M_REG32),              // POP r
-    E2(0x60,  CF_0F, TEXT_JR,    SM_ANY, M_CC,     M_REL8),     // JR cc,$
-    E2(0x70,  CF_0F, TEXT_JRL,   SM_ANY, M_CC,     M_REL16),    // JRL cc,$
+    E2(0x60,  CF_0F, flowJump(TEXT_JR),  SM_ANY, M_CC,     M_REL8),  // JR cc,$
+    E2(0x70,  CF_0F, flowJump(TEXT_JRL), SM_ANY, M_CC,     M_REL16),  // JRL cc,$
     E1(0xF8,  CF_07, TEXT_SWI,   SM_ANY, M_SWI),                // SWI #v
     E0(0xFF,  CF_00, TEXT_SWI,   SM_ANY),                       // SWI
     E1(0x06,  CF_00, TEXT_EI,    SM_ANY, M_ZERO),               // EI
@@ -166,7 +166,7 @@ constexpr Entry TABLE_SRC_REG[] PROGMEM = {
     E1(0x14,  CF_00, TEXT_PAA,   SM_WL,  M_SRC),                // PAA (mem)
     E1(0x16,  CF_00, TEXT_MIRR,  SM_W,   M_SRC),                // MIRR (mem)
     E1(0x19,  CF_00, TEXT_MULA,  SM_ANY, M_R32SRC),             // MULA xrr
-    E2(0x1C,  CF_00, TEXT_DJNZ,  SM_BW,  M_SRC,    M_REL8),     // DJNZ (mem),$
+    E2(0x1C,  CF_00, flowBranch(TEXT_DJNZ), SM_BW,  M_SRC,    M_REL8),  // DJNZ (mem),$
     E2(0x20,  CF_00, TEXT_ANDCF, SM_BW,  M_BIT,    M_SRC),      // ANDCF b,(mem)
     E2(0x21,  CF_00, TEXT_ORCF,  SM_BW,  M_BIT,    M_SRC),      // ORCF b,(mem)
     E2(0x22,  CF_00, TEXT_XORCF, SM_BW,  M_BIT,    M_SRC),      // XORCF b,(mem)
@@ -488,8 +488,8 @@ constexpr Entry TABLE_DST_MEM[] PROGMEM = {
     E2(0xB8,  CF_07, TEXT_SET,   SM_B,   M_BIT,    M_DST),      // SET b,R
     E2(0xC0,  CF_07, TEXT_CHG,   SM_B,   M_BIT,    M_DST),      // CHG b,R
     E2(0xC8,  CF_07, TEXT_BIT,   SM_B,   M_BIT,    M_DST),      // BIT b,R
-    E2(0xD0,  CF_0F, TEXT_JP,    SM_ANY, M_CC,     M_DST),      // JP cc,R
-    E2(0xE0,  CF_0F, TEXT_CALL,  SM_ANY, M_CC,     M_DST),      // CALL cc,R
+    E2(0xD0,  CF_0F, flowJump(TEXT_JP),     SM_ANY, M_CC,     M_DST),  // JP cc,R
+    E2(0xE0,  CF_0F, flowBranch(TEXT_CALL), SM_ANY, M_CC,     M_DST),  // CALL cc,R
 };
 constexpr uint8_t INDEX_DST_MEM[] PROGMEM = {
      11,  // TEXT_ANDCF
@@ -591,7 +591,7 @@ constexpr uint8_t INDEX_BLOCK[] PROGMEM = {
 };
 
 constexpr Entry TABLE_RETCC[] PROGMEM = {
-    E1(0xF0,  CF_0F, TEXT_RET,   SM_ANY, M_CC),                 // RET cc
+    E1(0xF0,  CF_0F, flowEnd(TEXT_RET), SM_ANY, M_CC),          // RET cc
 };
 
 constexpr uint8_t INDEX_RETCC[] PROGMEM = {
@@ -38,8 +38,8 @@ constexpr Entry TMS370_TABLE[] PROGMEM = {
     E0(0xF8, TEXT_SETC),
     E1(0xFC, TEXT_POP,   M_ST),
     E0(0xFE, TEXT_STSP),
-    E0(0xF9, TEXT_RTS),
-    E0(0xFA, TEXT_RTI),
+    E0(0xF9, flowEnd(TEXT_RTS)),
+    E0(0xFA, flowEnd(TEXT_RTI)),
     E0(0xFD, TEXT_LDSP),
     E1(0xFB, TEXT_PUSH,  M_ST),
     E2(0xC0, TEXT_MOV,   M_A,    M_B),
@@ -49,8 +49,8 @@ constexpr Entry TMS370_TABLE[] PROGMEM = {
     E2(0x63, TEXT_AND,   M_B,    M_A),
     E2(0x64, TEXT_OR,    M_B,    M_A),
     E2(0x65, TEXT_XOR,   M_B,    M_A),
-    E3(0x66, TEXT_BTJO,  M_B,    M_A,   M_REL),
-    E3(0x67, TEXT_BTJZ,  M_B,    M_A,   M_REL),
+    E3(0x66, flowBranch(TEXT_BTJO), M_B,    M_A,   M_REL),
+    E3(0x67, flowBranch(TEXT_BTJZ), M_B,    M_A,   M_REL),
     E2(0x68, TEXT_ADD,   M_B,    M_A),
     E2(0x69, TEXT_ADC,   M_B,    M_A),
     E2(0x6A, TEXT_SUB,   M_B,    M_A),
@@ -64,8 +64,8 @@ constexpr Entry TMS370_TABLE[] PROGMEM = {
     E2(0x13, TEXT_AND,   M_RN,   M_A),
     E2(0x14, TEXT_OR,    M_RN,   M_A),
     E2(0x15, TEXT_XOR,   M_RN,   M_A),
-    E3(0x16, TEXT_BTJO,  M_RN,   M_A,   M_REL),
-    E3(0x17, TEXT_BTJZ,  M_RN,   M_A,   M_REL),
+    E3(0x16, flowBranch(TEXT_BTJO), M_RN,   M_A,   M_REL),
+    E3(0x17, flowBranch(TEXT_BTJZ), M_RN,   M_A,   M_REL),
     E2(0x18, TEXT_ADD,   M_RN,   M_A),
     E2(0x19, TEXT_ADC,   M_RN,   M_A),
     E2(0x1A, TEXT_SUB,   M_RN,   M_A),
@@ -80,8 +80,8 @@ constexpr Entry TMS370_TABLE[] PROGMEM = {
     E2(0x23, TEXT_AND,   M_IM8,  M_A),
     E2(0x24, TEXT_OR,    M_IM8,  M_A),
     E2(0x25, TEXT_XOR,   M_IM8,  M_A),
-    E3(0x26, TEXT_BTJO,  M_IM8,  M_A,   M_REL),
-    E3(0x27, TEXT_BTJZ,  M_IM8,  M_A,   M_REL),
+    E3(0x26, flowBranch(TEXT_BTJO), M_IM8,  M_A,   M_REL),
+    E3(0x27, flowBranch(TEXT_BTJZ), M_IM8,  M_A,   M_REL),
     E2(0x28, TEXT_ADD,   M_IM8,  M_A),
     E2(0x29, TEXT_ADC,   M_IM8,  M_A),
     E2(0x2A, TEXT_SUB,   M_IM8,  M_A),
@@ -94,8 +94,8 @@ constexpr Entry TMS370_TABLE[] PROGMEM = {
     E2(0x33, TEXT_AND,   M_RN,   M_B),
     E2(0x34, TEXT_OR,    M_RN,   M_B),
     E2(0x35, TEXT_XOR,   M_RN,   M_B),
-    E3(0x36, TEXT_BTJO,  M_RN,   M_B,   M_REL),
-    E3(0x37, TEXT_BTJZ,  M_RN,   M_B,   M_REL),
+    E3(0x36, flowBranch(TEXT_BTJO), M_RN,   M_B,   M_REL),
+    E3(0x37, flowBranch(TEXT_BTJZ), M_RN,   M_B,   M_REL),
     E2(0x38, TEXT_ADD,   M_RN,   M_B),
     E2(0x39, TEXT_ADC,   M_RN,   M_B),
     E2(0x3A, TEXT_SUB,   M_RN,   M_B),
@@ -108,8 +108,8 @@ constexpr Entry TMS370_TABLE[] PROGMEM = {
     E2(0x43, TEXT_AND,   M_RN,   M_RN),
     E2(0x44, TEXT_OR,    M_RN,   M_RN),
     E2(0x45, TEXT_XOR,   M_RN,   M_RN),
-    E3(0x46, TEXT_BTJO,  M_RN,   M_RN,  M_REL),
-    E3(0x47, TEXT_BTJZ,  M_RN,   M_RN,  M_REL),
+    E3(0x46, flowBranch(TEXT_BTJO), M_RN,   M_RN,  M_REL),
+    E3(0x47, flowBranch(TEXT_BTJZ), M_RN,   M_RN,  M_REL),
     E2(0x48, TEXT_ADD,   M_RN,   M_RN),
     E2(0x49, TEXT_ADC,   M_RN,   M_RN),
     E2(0x4A, TEXT_SUB,   M_RN,   M_RN),
@@ -122,8 +122,8 @@ constexpr Entry TMS370_TABLE[] PROGMEM = {
     E2(0x53, TEXT_AND,   M_IM8,  M_B),
     E2(0x54, TEXT_OR,    M_IM8,  M_B),
     E2(0x55, TEXT_XOR,   M_IM8,  M_B),
-    E3(0x56, TEXT_BTJO,  M_IM8,  M_B,   M_REL),
-    E3(0x57, TEXT_BTJZ,  M_IM8,  M_B,   M_REL),
+    E3(0x56, flowBranch(TEXT_BTJO), M_IM8,  M_B,   M_REL),
+    E3(0x57, flowBranch(TEXT_BTJZ), M_IM8,  M_B,   M_REL),
     E2(0x58, TEXT_ADD,   M_IM8,  M_B),
     E2(0x59, TEXT_ADC,   M_IM8,  M_B),
     E2(0x5A, TEXT_SUB,   M_IM8,  M_B),
@@ -137,8 +137,8 @@ constexpr Entry TMS370_TABLE[] PROGMEM = {
     E2(0x73, TEXT_AND,   M_IM8,  M_RN),
     E2(0x74, TEXT_OR,    M_IM8,  M_RN),
     E2(0x75, TEXT_XOR,   M_IM8,  M_RN),
-    E3(0x76, TEXT_BTJO,  M_IM8,  M_RN,   M_REL),
-    E3(0x77, TEXT_BTJZ,  M_IM8,  M_RN,   M_REL),
+    E3(0x76, flowBranch(TEXT_BTJO), M_IM8,  M_RN,   M_REL),
+    E3(0x77, flowBranch(TEXT_BTJZ), M_IM8,  M_RN,   M_REL),
     E2(0x78, TEXT_ADD,   M_IM8,  M_RN),
     E2(0x79, TEXT_ADC,   M_IM8,  M_RN),
     E2(0x7A, TEXT_SUB,   M_IM8,  M_RN),
@@ -156,26 +156,26 @@ constexpr Entry TMS370_TABLE[] PROGMEM = {
     E2(0x83, TEXT_AND,   M_A,    M_PN),
     E2(0x84, TEXT_OR,    M_A,    M_PN),
     E2(0x85, TEXT_XOR,   M_A,    M_PN),
-    E3(0x86, TEXT_BTJO,  M_A,    M_PN,  M_REL),
-    E3(0x87, TEXT_BTJZ,  M_A,    M_PN,  M_REL),
+    E3(0x86, flowBranch(TEXT_BTJO), M_A,    M_PN,  M_REL),
+    E3(0x87, flowBranch(TEXT_BTJZ), M_A,    M_PN,  M_REL),
     E2(0x88, TEXT_MOVW,  M_IM16, M_RN),
-    E1(0x89, TEXT_JMPL,  M_LREL),
+    E1(0x89, flowJump(TEXT_JMPL), M_LREL),
     E2(0x8A, TEXT_MOV,   M_ABS,  M_A),
     E2(0x8B, TEXT_MOV,   M_A,    M_ABS),
-    E1(0x8C, TEXT_BR,    M_ABS),
+    E1(0x8C, flowJump(TEXT_BR), M_ABS),
     E2(0x8D, TEXT_CMP,   M_ABS,  M_A),
-    E1(0x8E, TEXT_CALL,  M_ABS),
-    E1(0x8F, TEXT_CALLR, M_LREL),
+    E1(0x8E, flowBranch(TEXT_CALL),  M_ABS),
+    E1(0x8F, flowBranch(TEXT_CALLR), M_LREL),
     E2(0x93, TEXT_AND,   M_B,    M_PN),
     E2(0x94, TEXT_OR,    M_B,    M_PN),
     E2(0x95, TEXT_XOR,   M_B,    M_PN),
-    E3(0x96, TEXT_BTJO,  M_B,    M_PN,  M_REL),
-    E3(0x97, TEXT_BTJZ,  M_B,    M_PN,  M_REL),
+    E3(0x96, flowBranch(TEXT_BTJO), M_B,    M_PN,  M_REL),
+    E3(0x97, flowBranch(TEXT_BTJZ), M_B,    M_PN,  M_REL),
     E2(0x98, TEXT_MOVW,  M_RN,   M_RN),
-    E1(0x99, TEXT_JMPL,  M_IDIR),
+    E1(0x99, flowEnd(TEXT_JMPL), M_IDIR),
     E2(0x9A, TEXT_MOV,   M_IDIR, M_A),
     E2(0x9B, TEXT_MOV,   M_A,    M_IDIR),
-    E1(0x9C, TEXT_BR,    M_IDIR),
+    E1(0x9C, flowEnd(TEXT_BR), M_IDIR),
     E2(0x9D, TEXT_CMP,   M_IDIR, M_A),
     E1(0x9E, TEXT_CALL,  M_IDIR),
     E1(0x9F, TEXT_CALLR, M_IDIR),
@@ -183,13 +183,13 @@ constexpr Entry TMS370_TABLE[] PROGMEM = {
     E2(0xA3, TEXT_AND,   M_IM8,  M_PN),
     E2(0xA4, TEXT_OR,    M_IM8,  M_PN),
     E2(0xA5, TEXT_XOR,   M_IM8,  M_PN),
-    E3(0xA6, TEXT_BTJO,  M_IM8,  M_PN,  M_REL),
-    E3(0xA7, TEXT_BTJZ,  M_IM8,  M_PN,  M_REL),
+    E3(0xA6, flowBranch(TEXT_BTJO), M_IM8,  M_PN,  M_REL),
+    E3(0xA7, flowBranch(TEXT_BTJZ), M_IM8,  M_PN,  M_REL),
     E2(0xA8, TEXT_MOVW,  M_BIMM, M_RN),
-    E1(0xA9, TEXT_JMPL,  M_BREL),
+    E1(0xA9, flowEnd(TEXT_JMPL), M_BREL),
     E2(0xAA, TEXT_MOV,   M_BIDX, M_A),
     E2(0xAB, TEXT_MOV,   M_A,    M_BIDX),
-    E1(0xAC, TEXT_BR,    M_BIDX),
+    E1(0xAC, flowEnd(TEXT_BR), M_BIDX),
     E2(0xAD, TEXT_CMP,   M_BIDX, M_A),
     E1(0xAE, TEXT_CALL,  M_BIDX),
     E1(0xAF, TEXT_CALLR, M_BREL),
@@ -203,7 +203,7 @@ constexpr Entry TMS370_TABLE[] PROGMEM = {
     E1(0xB7, TEXT_SWAP,  M_A),
     E1(0xB8, TEXT_PUSH,  M_A),
     E1(0xB9, TEXT_POP,   M_A),
-    E2(0xBA, TEXT_DJNZ,  M_A,    M_REL),
+    E2(0xBA, flowBranch(TEXT_DJNZ), M_A,    M_REL),
     E1(0xBB, TEXT_COMPL, M_A),
     E1(0xBC, TEXT_RR,    M_A),
     E1(0xBD, TEXT_RRC,   M_A),
@@ -218,7 +218,7 @@ constexpr Entry TMS370_TABLE[] PROGMEM = {
     E1(0xC7, TEXT_SWAP,  M_B),
     E1(0xC8, TEXT_PUSH,  M_B),
     E1(0xC9, TEXT_POP,   M_B),
-    E2(0xCA, TEXT_DJNZ,  M_B,    M_REL),
+    E2(0xCA, flowBranch(TEXT_DJNZ), M_B,    M_REL),
     E1(0xCB, TEXT_COMPL, M_B),
     E1(0xCC, TEXT_RR,    M_B),
     E1(0xCD, TEXT_RRC,   M_B),
@@ -232,30 +232,30 @@ constexpr Entry TMS370_TABLE[] PROGMEM = {
     E1(0xD7, TEXT_SWAP,  M_RN),
     E1(0xD8, TEXT_PUSH,  M_RN),
     E1(0xD9, TEXT_POP,   M_RN),
-    E2(0xDA, TEXT_DJNZ,  M_RN,   M_REL),
+    E2(0xDA, flowBranch(TEXT_DJNZ), M_RN,   M_REL),
     E1(0xDB, TEXT_COMPL, M_RN),
     E1(0xDC, TEXT_RR,    M_RN),
     E1(0xDD, TEXT_RRC,   M_RN),
     E1(0xDE, TEXT_RL,    M_RN),
     E1(0xDF, TEXT_RLC,   M_RN),
-    E1(0x00, TEXT_JMP,   M_REL),
-    E1(0x01, TEXT_JN,    M_REL),
-    E1(0x02, TEXT_JZ,    M_REL),
-    E1(0x02, TEXT_JEQ,   M_REL),
-    E1(0x03, TEXT_JC,    M_REL),
-    E1(0x04, TEXT_JP,    M_REL),
-    E1(0x05, TEXT_JPZ,   M_REL),
-    E1(0x06, TEXT_JNZ,   M_REL),
-    E1(0x06, TEXT_JNE,   M_REL),
-    E1(0x07, TEXT_JNC,   M_REL),
-    E1(0x08, TEXT_JV,    M_REL),
-    E1(0x09, TEXT_JL,    M_REL),
-    E1(0x0A, TEXT_JLE,   M_REL),
-    E1(0x0B, TEXT_JHS,   M_REL),
-    E1(0x0C, TEXT_JNV,   M_REL),
-    E1(0x0D, TEXT_JGE,   M_REL),
-    E1(0x0E, TEXT_JG,    M_REL),
-    E1(0x0F, TEXT_JLO,   M_REL),
+    E1(0x00, flowJump(TEXT_JMP),   M_REL),
+    E1(0x01, flowBranch(TEXT_JN),  M_REL),
+    E1(0x02, flowBranch(TEXT_JZ),  M_REL),
+    E1(0x02, flowBranch(TEXT_JEQ), M_REL),
+    E1(0x03, flowBranch(TEXT_JC),  M_REL),
+    E1(0x04, flowBranch(TEXT_JP),  M_REL),
+    E1(0x05, flowBranch(TEXT_JPZ), M_REL),
+    E1(0x06, flowBranch(TEXT_JNZ), M_REL),
+    E1(0x06, flowBranch(TEXT_JNE), M_REL),
+    E1(0x07, flowBranch(TEXT_JNC), M_REL),
+    E1(0x08, flowBranch(TEXT_JV),  M_REL),
+    E1(0x09, flowBranch(TEXT_JL),  M_REL),
+    E1(0x0A, flowBranch(TEXT_JLE), M_REL),
+    E1(0x0B, flowBranch(TEXT_JHS), M_REL),
+    E1(0x0C, flowBranch(TEXT_JNV), M_REL),
+    E1(0x0D, flowBranch(TEXT_JGE), M_REL),
+    E1(0x0E, flowBranch(TEXT_JG),  M_REL),
+    E1(0x0F, flowBranch(TEXT_JLO), M_REL),
     E1(0xE0, TEXT_TRAP,  M_TVEC),
 };
 
@@ -493,8 +493,8 @@ constexpr Entry TMS370_TF4[] PROGMEM = {
     E2(0xEB, TEXT_MOV,   M_A,    M_RIDX),
     E2(0xED, TEXT_CMP,   M_RIDX, M_A),
     E2(0xF8, TEXT_DIV,   M_RN,   M_A),
-    E1(0xE9, TEXT_JMPL,  M_RIDX),
-    E1(0xEC, TEXT_BR,    M_RIDX),
+    E1(0xE9, flowEnd(TEXT_JMPL), M_RIDX),
+    E1(0xEC, flowEnd(TEXT_BR),   M_RIDX),
     E1(0xEE, TEXT_CALL,  M_RIDX),
     E1(0xEF, TEXT_CALLR, M_RIDX),
 };
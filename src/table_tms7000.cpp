@@ -39,8 +39,8 @@ constexpr Entry TMS7000_TABLE[] PROGMEM = {
 	E0(0x07, TEXT_SETC),
 	E1(0x08, TEXT_POP,   M_ST),
 	E0(0x09, TEXT_STSP),
-	E0(0x0A, TEXT_RETS),
-	E0(0x0B, TEXT_RETI),
+	E0(0x0A, flowEnd(TEXT_RETS)),
+	E0(0x0B, flowEnd(TEXT_RETI)),
 	E0(0x0D, TEXT_LDSP),
 	E1(0x0E, TEXT_PUSH,  M_ST),
 	E2(0xC0, TEXT_MOV,   M_A,    M_B),
@@ -50,8 +50,8 @@ constexpr Entry TMS7000_TABLE[] PROGMEM = {
 	E2(0x63, TEXT_AND,   M_B,    M_A),
 	E2(0x64, TEXT_OR,    M_B,    M_A),
 	E2(0x65, TEXT_XOR,   M_B,    M_A),
-	E3(0x66, TEXT_BTJO,  M_B,    M_A,   M_REL),
-	E3(0x67, TEXT_BTJZ,  M_B,    M_A,   M_REL),
+	E3(0x66, flowBranch(TEXT_BTJO), M_B,    M_A,   M_REL),
+	E3(0x67, flowBranch(TEXT_BTJZ), M_B,    M_A,   M_REL),
 	E2(0x68, TEXT_ADD,   M_B,    M_A),
 	E2(0x69, TEXT_ADC,   M_B,    M_A),
 	E2(0x6A, TEXT_SUB,   M_B,    M_A),
@@ -64,8 +64,8 @@ constexpr Entry TMS7000_TABLE[] PROGMEM = {
 	E2(0x13, TEXT_AND,   M_RN,   M_A),
 	E2(0x14, TEXT_OR,    M_RN,   M_A),
 	E2(0x15, TEXT_XOR,   M_RN,   M_A),
-	E3(0x16, TEXT_BTJO,  M_RN,   M_A,   M_REL),
-	E3(0x17, TEXT_BTJZ,  M_RN,   M_A,   M_REL),
+	E3(0x16, flowBranch(TEXT_BTJO), M_RN,   M_A,   M_REL),
+	E3(0x17, flowBranch(TEXT_BTJZ), M_RN,   M_A,   M_REL),
 	E2(0x18, TEXT_ADD,   M_RN,   M_A),
 	E2(0x19, TEXT_ADC,   M_RN,   M_A),
 	E2(0x1A, TEXT_SUB,   M_RN,   M_A),
@@ -78,8 +78,8 @@ constexpr Entry TMS7000_TABLE[] PROGMEM = {
 	E2(0x23, TEXT_AND,   M_IM8,  M_A),
 	E2(0x24, TEXT_OR,    M_IM8,  M_A),
 	E2(0x25, TEXT_XOR,   M_IM8,  M_A),
-	E3(0x26, TEXT_BTJO,  M_IM8,  M_A,   M_REL),
-	E3(0x27, TEXT_BTJZ,  M_IM8,  M_A,   M_REL),
+	E3(0x26, flowBranch(TEXT_BTJO), M_IM8,  M_A,   M_REL),
+	E3(0x27, flowBranch(TEXT_BTJZ), M_IM8,  M_A,   M_REL),
 	E2(0x28, TEXT_ADD,   M_IM8,  M_A),
 	E2(0x29, TEXT_ADC,   M_IM8,  M_A),
 	E2(0x2A, TEXT_SUB,   M_IM8,  M_A),
@@ -92,8 +92,8 @@ constexpr Entry TMS7000_TABLE[] PROGMEM = {
 	E2(0x33, TEXT_AND,   M_RN,   M_B),
 	E2(0x34, TEXT_OR,    M_RN,   M_B),
 	E2(0x35, TEXT_XOR,   M_RN,   M_B),
-	E3(0x36, TEXT_BTJO,  M_RN,   M_B,   M_REL),
-	E3(0x37, TEXT_BTJZ,  M_RN,   M_B,   M_REL),
+	E3(0x36, flowBranch(TEXT_BTJO), M_RN,   M_B,   M_REL),
+	E3(0x37, flowBranch(TEXT_BTJZ), M_RN,   M_B,   M_REL),
 	E2(0x38, TEXT_ADD,   M_RN,   M_B),
 	E2(0x39, TEXT_ADC,   M_RN,   M_B),
 	E2(0x3A, TEXT_SUB,   M_RN,   M_B),
@@ -106,8 +106,8 @@ constexpr Entry TMS7000_TABLE[] PROGMEM = {
 	E2(0x43, TEXT_AND,   M_RN,   M_RN),
 	E2(0x44, TEXT_OR,    M_RN,   M_RN),
 	E2(0x45, TEXT_XOR,   M_RN,   M_RN),
-	E3(0x46, TEXT_BTJO,  M_RN,   M_RN,  M_REL),
-	E3(0x47, TEXT_BTJZ,  M_RN,   M_RN,  M_REL),
+	E3(0x46, flowBranch(TEXT_BTJO), M_RN,   M_RN,  M_REL),
+	E3(0x47, flowBranch(TEXT_BTJZ), M_RN,   M_RN,  M_REL),
 	E2(0x48, TEXT_ADD,   M_RN,   M_RN),
 	E2(0x49, TEXT_ADC,   M_RN,   M_RN),
 	E2(0x4A, TEXT_SUB,   M_RN,   M_RN),
@@ -120,8 +120,8 @@ constexpr Entry TMS7000_TABLE[] PROGMEM = {
 	E2(0x53, TEXT_AND,   M_IM8,  M_B),
 	E2(0x54, TEXT_OR,    M_IM8,  M_B),
 	E2(0x55, TEXT_XOR,   M_IM8,  M_B),
-	E3(0x56, TEXT_BTJO,  M_IM8,  M_B,   M_REL),
-	E3(0x57, TEXT_BTJZ,  M_IM8,  M_B,   M_REL),
+	E3(0x56, flowBranch(TEXT_BTJO), M_IM8,  M_B,   M_REL),
+	E3(0x57, flowBranch(TEXT_BTJZ), M_IM8,  M_B,   M_REL),
 	E2(0x58, TEXT_ADD,   M_IM8,  M_B),
 	E2(0x59, TEXT_ADC,   M_IM8,  M_B),
 	E2(0x5A, TEXT_SUB,   M_IM8,  M_B),
@@ -134,8 +134,8 @@ constexpr Entry TMS7000_TABLE[] PROGMEM = {
 	E2(0x73, TEXT_AND,   M_IM8,  M_RN),
 	E2(0x74, TEXT_OR,    M_IM8,  M_RN),
 	E2(0x75, TEXT_XOR,   M_IM8,  M_RN),
-	E3(0x76, TEXT_BTJO,  M_IM8,  M_RN,   M_REL),
-	E3(0x77, TEXT_BTJZ,  M_IM8,  M_RN,   M_REL),
+	E3(0x76, flowBranch(TEXT_BTJO), M_IM8,  M_RN,   M_REL),
+	E3(0x77, flowBranch(TEXT_BTJZ), M_IM8,  M_RN,   M_REL),
 	E2(0x78, TEXT_ADD,   M_IM8,  M_RN),
 	E2(0x79, TEXT_ADC,   M_IM8,  M_RN),
 	E2(0x7A, TEXT_SUB,   M_IM8,  M_RN),
@@ -149,37 +149,37 @@ constexpr Entry TMS7000_TABLE[] PROGMEM = {
 	E2(0x83, TEXT_ANDP,  M_A,    M_PN),
 	E2(0x84, TEXT_ORP,   M_A,    M_PN),
 	E2(0x85, TEXT_XORP,  M_A,    M_PN),
-	E3(0x86, TEXT_BTJOP, M_A,    M_PN,  M_REL),
-	E3(0x87, TEXT_BTJZP, M_A,    M_PN,  M_REL),
+	E3(0x86, flowBranch(TEXT_BTJOP), M_A,    M_PN,  M_REL),
+	E3(0x87, flowBranch(TEXT_BTJZP), M_A,    M_PN,  M_REL),
 	E2(0x88, TEXT_MOVD,  M_IM16,  M_RN),
 	E1(0x8A, TEXT_LDA,   M_ABS),
 	E1(0x8B, TEXT_STA,   M_ABS),
-	E1(0x8C, TEXT_BR,    M_ABS),
+	E1(0x8C, flowJump(TEXT_BR), M_ABS),
 	E1(0x8D, TEXT_CMPA,  M_ABS),
-	E1(0x8E, TEXT_CALL,  M_ABS),
+	E1(0x8E, flowBranch(TEXT_CALL), M_ABS),
 	E2(0x91, TEXT_MOVP,  M_PN,   M_B),
 	E2(0x92, TEXT_MOVP,  M_B,    M_PN),
 	E2(0x93, TEXT_ANDP,  M_B,    M_PN),
 	E2(0x94, TEXT_ORP,   M_B,    M_PN),
 	E2(0x95, TEXT_XORP,  M_B,    M_PN),
-	E3(0x96, TEXT_BTJOP, M_B,    M_PN,  M_REL),
-	E3(0x97, TEXT_BTJZP, M_B,    M_PN,  M_REL),
+	E3(0x96, flowBranch(TEXT_BTJOP), M_B,    M_PN,  M_REL),
+	E3(0x97, flowBranch(TEXT_BTJZP), M_B,    M_PN,  M_REL),
 	E2(0x98, TEXT_MOVD,  M_RN,   M_RN),
 	E1(0x9A, TEXT_LDA,   M_IDIR),
 	E1(0x9B, TEXT_STA,   M_IDIR),
-	E1(0x9C, TEXT_BR,    M_IDIR),
+	E1(0x9C, flowEnd(TEXT_BR), M_IDIR),
 	E1(0x9D, TEXT_CMPA,  M_IDIR),
 	E1(0x9E, TEXT_CALL,  M_IDIR),
 	E2(0xA2, TEXT_MOVP,  M_IM8,  M_PN),
 	E2(0xA3, TEXT_ANDP,  M_IM8,  M_PN),
 	E2(0xA4, TEXT_ORP,   M_IM8,  M_PN),
 	E2(0xA5, TEXT_XORP,  M_IM8,  M_PN),
-	E3(0xA6, TEXT_BTJOP, M_IM8,  M_PN,  M_REL),
-	E3(0xA7, TEXT_BTJZP, M_IM8,  M_PN,  M_REL),
+	E3(0xA6, flowBranch(TEXT_BTJOP), M_IM8,  M_PN,  M_REL),
+	E3(0xA7, flowBranch(TEXT_BTJZP), M_IM8,  M_PN,  M_REL),
 	E2(0xA8, TEXT_MOVD,  M_BIMM, M_RN),
 	E1(0xAA, TEXT_LDA,   M_BIDX),
 	E1(0xAB, TEXT_STA,   M_BIDX),
-	E1(0xAC, TEXT_BR,    M_BIDX),
+	E1(0xAC, flowEnd(TEXT_BR), M_BIDX),
 	E1(0xAD, TEXT_CMPA,  M_BIDX),
 	E1(0xAE, TEXT_CALL,  M_BIDX),
 	E0(0xB0, TEXT_TSTA),
@@ -192,7 +192,7 @@ constexpr Entry TMS7000_TABLE[] PROGMEM = {
 	E1(0xB7, TEXT_SWAP,  M_A),
 	E1(0xB8, TEXT_PUSH,  M_A),
 	E1(0xB9, TEXT_POP,   M_A),
-	E2(0xBA, TEXT_DJNZ,  M_A,    M_REL),
+	E2(0xBA, flowBranch(TEXT_DJNZ), M_A,    M_REL),
 	E1(0xBB, TEXT_DECD,  M_A),
 	E1(0xBC, TEXT_RR,    M_A),
 	E1(0xBD, TEXT_RRC,   M_A),
@@ -207,7 +207,7 @@ constexpr Entry TMS7000_TABLE[] PROGMEM = {
 	E1(0xC7, TEXT_SWAP,  M_B),
 	E1(0xC8, TEXT_PUSH,  M_B),
 	E1(0xC9, TEXT_POP,   M_B),
-	E2(0xCA, TEXT_DJNZ,  M_B,    M_REL),
+	E2(0xCA, flowBranch(TEXT_DJNZ), M_B,    M_REL),
 	E1(0xCB, TEXT_DECD,  M_B),
 	E1(0xCC, TEXT_RR,    M_B),
 	E1(0xCD, TEXT_RRC,   M_B),
@@ -221,27 +221,27 @@ constexpr Entry TMS7000_TABLE[] PROGMEM = {
 	E1(0xD7, TEXT_SWAP,  M_RN),
 	E1(0xD8, TEXT_PUSH,  M_RN),
 	E1(0xD9, TEXT_POP,   M_RN),
-	E2(0xDA, TEXT_DJNZ,  M_RN,   M_REL),
+	E2(0xDA, flowBranch(TEXT_DJNZ), M_RN,   M_REL),
 	E1(0xDB, TEXT_DECD,  M_RN),
 	E1(0xDC, TEXT_RR,    M_RN),
 	E1(0xDD, TEXT_RRC,   M_RN),
 	E1(0xDE, TEXT_RL,    M_RN),
 	E1(0xDF, TEXT_RLC,   M_RN),
-	E1(0xE0, TEXT_JMP,   M_REL),
-	E1(0xE1, TEXT_JN,    M_REL),
-	E1(0xE1, TEXT_JLT,   M_REL),
-	E1(0xE2, TEXT_JZ,    M_REL),
-	E1(0xE2, TEXT_JEQ,   M_REL),
-	E1(0xE3, TEXT_JC,    M_REL),
-	E1(0xE3, TEXT_JHS,   M_REL),
-	E1(0xE4, TEXT_JP,    M_REL),
-	E1(0xE4, TEXT_JGT,   M_REL),
-	E1(0xE5, TEXT_JPZ,   M_REL),
-	E1(0xE5, TEXT_JGE,   M_REL),
-	E1(0xE6, TEXT_JNZ,   M_REL),
-	E1(0xE6, TEXT_JNE,   M_REL),
-	E1(0xE7, TEXT_JNC,   M_REL),
-	E1(0xE7, TEXT_JL,    M_REL),
+	E1(0xE0, flowJump(TEXT_JMP),   M_REL),
+	E1(0xE1, flowBranch(TEXT_JN),  M_REL),
+	E1(0xE1, flowBranch(TEXT_JLT), M_REL),
+	E1(0xE2, flowBranch(TEXT_JZ),  M_REL),
+	E1(0xE2, flowBranch(TEXT_JEQ), M_REL),
+	E1(0xE3, flowBranch(TEXT_JC),  M_REL),
+	E1(0xE3, flowBranch(TEXT_JHS), M_REL),
+	E1(0xE4, flowBranch(TEXT_JP),  M_REL),
+	E1(0xE4, flowBranch(TEXT_JGT), M_REL),
+	E1(0xE5, flowBranch(TEXT_JPZ), M_REL),
+	E1(0xE5, flowBranch(TEXT_JGE), M_REL),
+	E1(0xE6, flowBranch(TEXT_JNZ), M_REL),
+	E1(0xE6, flowBranch(TEXT_JNE), M_REL),
+	E1(0xE7, flowBranch(TEXT_JNC), M_REL),
+	E1(0xE7, flowBranch(TEXT_JL),  M_REL),
 	E1(0xE8, TEXT_TRAP,  M_TRAP),
 };
 
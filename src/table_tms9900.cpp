@@ -42,12 +42,12 @@ constexpr Entry TABLE_TMS9900[] PROGMEM = {
     E1(0x0300, CF_0000, TEXT_LIMI, M_IMM),
     E0(0x0340, CF_0000, TEXT_IDLE),
     E0(0x0360, CF_0000, TEXT_RSET),
-    E0(0x0380, CF_0000, TEXT_RTWP),
+    E0(0x0380, CF_0000, flowEnd(TEXT_RTWP)),
     E0(0x03A0, CF_0000, TEXT_CKON),
     E0(0x03C0, CF_0000, TEXT_CKOF),
     E0(0x03E0, CF_0000, TEXT_LREX),
     E1(0x0400, CF_003F, TEXT_BLWP, M_SRC),
-    E1(0x0440, CF_003F, TEXT_B,    M_SRC),
+    E1(0x0440, CF_003F, flowJump(TEXT_B), M_SRC),
     E1(0x0480, CF_003F, TEXT_X,    M_SRC),
     E1(0x04C0, CF_003F, TEXT_CLR,  M_SRC),
     E1(0x0500, CF_003F, TEXT_NEG,  M_SRC),
@@ -56,7 +56,7 @@ constexpr Entry TABLE_TMS9900[] PROGMEM = {
     E1(0x05C0, CF_003F, TEXT_INCT, M_SRC),
     E1(0x0600, CF_003F, TEXT_DEC,  M_SRC),
     E1(0x0640, CF_003F, TEXT_DECT, M_SRC),
-    E1(0x0680, CF_003F, TEXT_BL,   M_SRC),
+    E1(0x0680, CF_003F, flowBranch(TEXT_BL), M_SRC),
     E1(0x06C0, CF_003F, TEXT_SWPB, M_SRC),
     E1(0x0700, CF_003F, TEXT_SETO, M_SRC),
     E1(0x0740, CF_003F, TEXT_ABS,  M_SRC),
@@ -64,19 +64,19 @@ constexpr Entry TABLE_TMS9900[] PROGMEM = {
     E2(0x0900, CF_00FF, TEXT_SRL,  M_REG,  M_SCNT),
     E2(0x0A00, CF_00FF, TEXT_SLA,  M_REG,  M_SCNT),
     E2(0x0B00, CF_00FF, TEXT_SRC,  M_REG,  M_SCNT),
-    E1(0x1000, CF_00FF, TEXT_JMP,  M_REL),
-    E1(0x1100, CF_00FF, TEXT_JLT,  M_REL),
-    E1(0x1200, CF_00FF, TEXT_JLE,  M_REL),
-    E1(0x1300, CF_00FF, TEXT_JEQ,  M_REL),
-    E1(0x1400, CF_00FF, TEXT_JHE,  M_REL),
-    E1(0x1500, CF_00FF, TEXT_JGT,  M_REL),
-    E1(0x1600, CF_00FF, TEXT_JNE,  M_REL),
-    E1(0x1700, CF_00FF, TEXT_JNC,  M_REL),
-    E1(0x1800, CF_00FF, TEXT_JOC,  M_REL),
-    E1(0x1900, CF_00FF, TEXT_JNO,  M_REL),
-    E1(0x1A00, CF_00FF, TEXT_JL,   M_REL),
-    E1(0x1B00, CF_00FF, TEXT_JH,   M_REL),
-    E1(0x1C00, CF_00FF, TEXT_JOP,  M_REL),
+    E1(0x1000, CF_00FF, flowJump(TEXT_JMP),   M_REL),
+    E1(0x1100, CF_00FF, flowBranch(TEXT_JLT), M_REL),
+    E1(0x1200, CF_00FF, flowBranch(TEXT_JLE), M_REL),
+    E1(0x1300, CF_00FF, flowBranch(TEXT_JEQ), M_REL),
+    E1(0x1400, CF_00FF, flowBranch(TEXT_JHE), M_REL),
+    E1(0x1500, CF_00FF, flowBranch(TEXT_JGT), M_REL),
+    E1(0x1600, CF_00FF, flowBranch(TEXT_JNE), M_REL),
+    E1(0x1700, CF_00FF, flowBranch(TEXT_JNC), M_REL),
+    E1(0x1800, CF_00FF, flowBranch(TEXT_JOC), M_REL),
+    E1(0x1900, CF_00FF, flowBranch(TEXT_JNO), M_REL),
+    E1(0x1A00, CF_00FF, flowBranch(TEXT_JL),  M_REL),
+    E1(0x1B00, CF_00FF, flowBranch(TEXT_JH),  M_REL),
+    E1(0x1C00, CF_00FF, flowBranch(TEXT_JOP), M_REL),
     E1(0x1D00, CF_00FF, TEXT_SBO,  M_CRU),
     E1(0x1E00, CF_00FF, TEXT_SBZ,  M_CRU),
     E1(0x1F00, CF_00FF, TEXT_TB,   M_CRU),
@@ -100,7 +100,7 @@ constexpr Entry TABLE_TMS9900[] PROGMEM = {
     B2(0xD000, CF_0FFF, TEXT_MOVB, M_SRC,  M_DST),
     E2(0xE000, CF_0FFF, TEXT_SOC,  M_SRC,  M_DST),
     B2(0xF000, CF_0FFF, TEXT_SOCB, M_SRC,  M_DST),
-    E0(0x045B, CF_0000, TEXT_RT),
+    E0(0x045B, CF_0000, flowEnd(TEXT_RT)),
     E0(0x1000, CF_0000, TEXT_NOP),
 };
 
@@ -197,18 +197,18 @@ constexpr Entry TABLE_TMS99105[] PROGMEM = {
     E2(0x001D, CF_0000, TEXT_SLAM, M_SRC2, M_CNT4),
     E2(0x0029, CF_0000, TEXT_SM,   M_SRC2, M_DST4),
     E2(0x002A, CF_0000, TEXT_AM,   M_SRC2, M_DST4),
-    E2(0x00B0, CF_000F, TEXT_BLSK, M_REG,  M_IMM),
-    E2(0x00B0, CF_000F, TEXT_BLSK, M_REG,  M_SYBL),
-    E1(0x0140, CF_003F, TEXT_BIND, M_SRC),
+    E2(0x00B0, CF_000F, flowBranch(TEXT_BLSK), M_REG,  M_IMM),
+    E2(0x00B0, CF_000F, flowBranch(TEXT_BLSK), M_REG,  M_SYBL),
+    E1(0x0140, CF_003F, flowEnd(TEXT_BIND),    M_SRC),
     E2(0x0C09, CF_0000, TEXT_TMB,  M_SRC2, M_BIT0),
     E2(0x0C0A, CF_0000, TEXT_TCMB, M_SRC2, M_BIT0),
     E2(0x0C0B, CF_0000, TEXT_TSMB, M_SRC2, M_BIT0),
     E1(0x0100, CF_003F, TEXT_EVAD, M_SRC),
-    E1(0x0380, CF_0000, TEXT_RTWP, M_RTWP),
+    E1(0x0380, CF_0000, flowEnd(TEXT_RTWP), M_RTWP),
     // Extra
-    E1(0x0381, CF_0000, TEXT_RTWP, M_RTWP),
-    E1(0x0382, CF_0000, TEXT_RTWP, M_RTWP),
-    E1(0x0384, CF_0000, TEXT_RTWP, M_RTWP),
+    E1(0x0381, CF_0000, flowEnd(TEXT_RTWP), M_RTWP),
+    E1(0x0382, CF_0000, flowEnd(TEXT_RTWP), M_RTWP),
+    E1(0x0384, CF_0000, flowEnd(TEXT_RTWP), M_RTWP),
 };
 
 constexpr uint8_t INDEX_TMS99105[] PROGMEM = {
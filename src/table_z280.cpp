@@ -110,7 +110,7 @@ constexpr Entry TABLE_Z280_EXT[] PROGMEM = {
     E1(0xCA, 0060, TEXT_DIVW,   M_R16),
     E1(0xCB, 0060, TEXT_DIVUW,  M_R16),
     E1(0xCE, 0060, TEXT_SUBW,   M_R16),
-    E0(0x55, 0000, TEXT_RETIL),
+    E0(0x55, 0000, flowEnd(TEXT_RETIL)),
     E1(0x64, 0000, TEXT_EXTS,   R_A),
     E0(0x64, 0000, TEXT_EXTS),
     E0(0x65, 0000, TEXT_PCACHE),
@@ -255,8 +255,8 @@ constexpr Entry TABLE_Z280_IX[] PROGMEM = {
     E1(0x05, 0030, TEXT_DEC,  M_BIXH),
     E2(0x06, 0030, TEXT_LD,   M_BIXH,  M_IM8),
     E1(0x0B, 0020, TEXT_DECW, M_MPTR),
-    E1(0x20, 0000, TEXT_JAR,  M_REL8),
-    E1(0x28, 0000, TEXT_JAF,  M_REL8),
+    E1(0x20, 0000, flowBranch(TEXT_JAR), M_REL8),
+    E1(0x28, 0000, flowBranch(TEXT_JAF), M_REL8),
     E2(0x31, 0000, TEXT_LDW,  M_REL16, M_IM16),
     E1(0x33, 0000, TEXT_INCW, M_REL16),
     E1(0x3B, 0000, TEXT_DECW, M_REL16),
@@ -298,10 +298,10 @@ constexpr Entry TABLE_Z280_IX[] PROGMEM = {
     E1(0xB8, 0003, TEXT_CP,   M_BIXL),
     E1(0xBF, 0000, TEXT_CP,   M_ABS),
     E1(0xC1, 0020, TEXT_POP,  M_MPTR),
-    E2(0xC2, 0070, TEXT_JP,   M_CC8,   I_HL),
-    E2(0xC4, 0070, TEXT_CALL, M_CC8,   I_HL),
+    E2(0xC2, 0070, flowBranch(TEXT_JP),   M_CC8,   I_HL),
+    E2(0xC4, 0070, flowBranch(TEXT_CALL), M_CC8,   I_HL),
     E1(0xC5, 0020, TEXT_PUSH, M_MPTR),
-    E1(0xCD, 0000, TEXT_CALL, I_HL),
+    E1(0xCD, 0000, flowBranch(TEXT_CALL), I_HL),
     E1(0xF1, 0000, TEXT_POP,  M_REL16),
     E1(0xF5, 0000, TEXT_PUSH, M_REL16),
 };
@@ -389,10 +389,10 @@ constexpr Entry TABLE_Z280_IY[] PROGMEM = {
     E1(0xA8, 0003, TEXT_XOR,  M_PIXL),
     E1(0xB0, 0003, TEXT_OR,   M_PIXL),
     E1(0xB8, 0003, TEXT_CP,   M_PIXL),
-    E2(0xC2, 0070, TEXT_JP,   M_CC8,  M_REL16),
-    E1(0xC3, 0000, TEXT_JP,   M_REL16),
-    E2(0xC4, 0070, TEXT_CALL, M_CC8,  M_REL16),
-    E1(0xCD, 0000, TEXT_CALL, M_REL16),
+    E2(0xC2, 0070, flowBranch(TEXT_JP),   M_CC8,  M_REL16),
+    E1(0xC3, 0000, flowJump(TEXT_JP),     M_REL16),
+    E2(0xC4, 0070, flowBranch(TEXT_CALL), M_CC8,  M_REL16),
+    E1(0xCD, 0000, flowBranch(TEXT_CALL), M_REL16),
     E1(0xF5, 0000, TEXT_PUSH, M_IM16),
 };
 
@@ -28,9 +28,9 @@ constexpr Entry TABLE_Z380[] PROGMEM = {
     E1(0x0B, 0060, TEXT_DECW, M_R16),
     E1(0x03, 0060, TEXT_INCW, M_R16),
     E1(0x2F, 0000, TEXT_CPL,  R_A),
-    E1(0x10, 0000, TEXT_DJNZ, M_REL16),
-    E1(0x18, 0000, TEXT_JR,   M_REL16),
-    E2(0x20, 0030, TEXT_JR,   M_CC4,  M_REL16),
+    E1(0x10, 0000, flowBranch(TEXT_DJNZ), M_REL16),
+    E1(0x18, 0000, flowJump(TEXT_JR),     M_REL16),
+    E2(0x20, 0030, flowBranch(TEXT_JR),   M_CC4,  M_REL16),
     D2(0x22, 0000, TEXT_LDW,  M_DABS, R_HL),
     D2(0x2A, 0000, TEXT_LDW,  R_HL,   M_DABS),
     E1(0x80, 0007, TEXT_ADD,  M_SRC),
@@ -64,8 +64,8 @@ constexpr uint8_t INDEX_Z380[] PROGMEM = {
 
 // Z380 ED:xx
 constexpr Entry TABLE_Z380_EXT[] PROGMEM = {
-    E2(0xC4, 0070, TEXT_CALR,  M_CC8,   M_REL8),
-    E1(0xCD, 0000, TEXT_CALR,  M_REL8),
+    E2(0xC4, 0070, flowBranch(TEXT_CALR), M_CC8,   M_REL8),
+    E1(0xCD, 0000, flowBranch(TEXT_CALR), M_REL8),
     L2(0x05, 0000, TEXT_EX,    R_BC,    R_DE),
     L2(0x05, 0000, TEXT_EX,    R_DE,    R_BC),
     E2(0x07, 0070, TEXT_EX,    R_A,     M_DST),
@@ -126,11 +126,11 @@ constexpr Entry TABLE_Z380_EXT[] PROGMEM = {
     L2(0xC8, 0000, TEXT_LDCTL, R_SR,    R_HL),
     I2(0xC6, 0000, TEXT_ADD,   R_HL,    M_XABS),
     I2(0xD6, 0000, TEXT_SUB,   R_HL,    M_XABS),
-    E2(0xC4, 0070, TEXT_CALR,  M_CC8,   M_REL24),
-    E1(0xCD, 0000, TEXT_CALR,  M_REL24),
+    E2(0xC4, 0070, flowBranch(TEXT_CALR), M_CC8,   M_REL24),
+    E1(0xCD, 0000, flowBranch(TEXT_CALR), M_REL24),
     E1(0xF7, 0000, TEXT_SETC,  M_LW),
     E1(0xFF, 0000, TEXT_RESC,  M_LW),
-    E0(0x55, 0000, TEXT_RETB),
+    E0(0x55, 0000, flowEnd(TEXT_RETB)),
     E0(0x8B, 0000, TEXT_OTDM),
     E0(0x9B, 0000, TEXT_OTDMR),
     E0(0xCF, 0000, TEXT_BTEST),
@@ -516,11 +516,11 @@ constexpr uint8_t INDEX_Z380_IDX[] PROGMEM = {
 
 // Z380 DD:xx
 constexpr Entry TABLE_Z380_IX[] PROGMEM = {
-    E2(0x20, 0030, TEXT_JR,    M_CC4,   M_REL16),
-    E1(0x18, 0000, TEXT_JR,    M_REL16),
-    E2(0xC4, 0070, TEXT_CALR,  M_CC8,   M_REL16),
-    E1(0xCD, 0000, TEXT_CALR,  M_REL16),
-    E1(0x10, 0000, TEXT_DJNZ,  M_REL16),
+    E2(0x20, 0030, flowBranch(TEXT_JR),   M_CC4,   M_REL16),
+    E1(0x18, 0000, flowJump(TEXT_JR),     M_REL16),
+    E2(0xC4, 0070, flowBranch(TEXT_CALR), M_CC8,   M_REL16),
+    E1(0xCD, 0000, flowBranch(TEXT_CALR), M_REL16),
+    E1(0x10, 0000, flowBranch(TEXT_DJNZ), M_REL16),
     L2(0x02, 0020, TEXT_LDW,   R_PTRH, R_DE),
     L2(0x32, 0000, TEXT_LDW,   R_HL,   R_DE),
     L2(0x0C, 0021, TEXT_LDW,   R_PTRH, I_PTRL),
@@ -609,12 +609,12 @@ constexpr uint8_t INDEX_Z380_IX[] PROGMEM = {
 
 // Z380 FD:xx
 constexpr Entry TABLE_Z380_IY[] PROGMEM = {
-    E2(0x20, 0030, TEXT_JR,    M_CC4,   M_REL24),
-    E1(0x18, 0000, TEXT_JR,    M_REL24),
-    E2(0xC4, 0070, TEXT_CALR,  M_CC8,   M_REL24),
-    E1(0xCD, 0000, TEXT_CALR,  M_REL24),
-    E2(0x20, 0030, TEXT_JR,    M_CC4,  M_REL24),
-    E1(0x10, 0000, TEXT_DJNZ,  M_REL24),
+    E2(0x20, 0030, flowBranch(TEXT_JR),   M_CC4,   M_REL24),
+    E1(0x18, 0000, flowJump(TEXT_JR),     M_REL24),
+    E2(0xC4, 0070, flowBranch(TEXT_CALR), M_CC8,   M_REL24),
+    E1(0xCD, 0000, flowBranch(TEXT_CALR), M_REL24),
+    E2(0x20, 0030, flowBranch(TEXT_JR),   M_CC4,  M_REL24),
+    E1(0x10, 0000, flowBranch(TEXT_DJNZ), M_REL24),
     L2(0x02, 0020, TEXT_LDW,   R_PTRH, R_HL),
     L2(0x27, 0000, TEXT_LDW,   R_IY,   R_IX),
     L2(0x32, 0000, TEXT_LDW,   R_HL,   R_HL),
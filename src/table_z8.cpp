@@ -41,12 +41,12 @@ constexpr Entry TABLE_COMMON[] PROGMEM = {
     E2(0xE5, TEXT_LD,   PF_NONE, M_R,   M_IR, OP_BYT2, OP_BYT1),
     E2(0xE6, TEXT_LD,   PF_NONE, M_R,   M_IM, OP_BYT1, OP_BYT2),
     E2(0xF5, TEXT_LD,   PF_NONE, M_IR,  M_R,  OP_BYT2, OP_BYT1),
-    E2(0x0A, TEXT_DJNZ, PF_NONE, M_r,   M_RA, OP_CODE, OP_BYT1),
-    E1(0x8B, TEXT_JR,   PF_NONE, M_RA,  OP_BYT1),
-    E2(0x0B, TEXT_JR,   PF_NONE, M_cc,  M_RA, OP_CODE, OP_BYT1),
-    E1(0x8D, TEXT_JP,   PF_NONE, M_DA,  OP_W1BE),
-    E2(0x0D, TEXT_JP,   PF_NONE, M_cc,  M_DA, OP_CODE, OP_W1BE),
-    E1(0x30, TEXT_JP,   PF_NONE, M_IRR, OP_BYT1),
+    E2(0x0A, flowBranch(TEXT_DJNZ), PF_NONE, M_r,   M_RA, OP_CODE, OP_BYT1),
+    E1(0x8B, flowJump(TEXT_JR),     PF_NONE, M_RA,  OP_BYT1),
+    E2(0x0B, flowBranch(TEXT_JR),   PF_NONE, M_cc,  M_RA, OP_CODE, OP_BYT1),
+    E1(0x8D, flowJump(TEXT_JP),     PF_NONE, M_DA,  OP_W1BE),
+    E2(0x0D, flowBranch(TEXT_JP),   PF_NONE, M_cc,  M_DA, OP_CODE, OP_W1BE),
+    E1(0x30, flowEnd(TEXT_JP),      PF_NONE, M_IRR, OP_BYT1),
     E2(0x02, TEXT_ADD,  PF_NONE, M_r,   M_r,  OP_B1HI, OP_B1LO),
     E2(0x03, TEXT_ADD,  PF_NONE, M_r,   M_Ir, OP_B1HI, OP_B1LO),
     E2(0x04, TEXT_ADD,  PF_NONE, M_R,   M_R,  OP_BYT2, OP_BYT1),
@@ -130,8 +130,8 @@ constexpr Entry TABLE_COMMON[] PROGMEM = {
     E1(0xF1, TEXT_SWAP, PF_NONE, M_IR,  OP_BYT1),
     E0(0x8F, TEXT_DI,   PF_NONE),
     E0(0x9F, TEXT_EI,   PF_NONE),
-    E0(0xAF, TEXT_RET,  PF_NONE),
-    E0(0xBF, TEXT_IRET, PF_NONE),
+    E0(0xAF, flowEnd(TEXT_RET),  PF_NONE),
+    E0(0xBF, flowEnd(TEXT_IRET), PF_NONE),
     E0(0xCF, TEXT_RCF,  PF_NONE),
     E0(0xDF, TEXT_SCF,  PF_NONE),
     E0(0xEF, TEXT_CCF,  PF_NONE),
@@ -268,7 +268,7 @@ constexpr Entry TABLE_Z8[] PROGMEM = {
     E2(0xD2, TEXT_LDC,  PF_NONE, M_Irr, M_r,   OP_B1LO, OP_B1HI),
     E2(0xC3, TEXT_LDCI, PF_NONE, M_Ir,  M_Irr, OP_B1HI, OP_B1LO),
     E2(0xD3, TEXT_LDCI, PF_NONE, M_Irr, M_Ir,  OP_B1LO, OP_B1HI),
-    E1(0xD6, TEXT_CALL, PF_NONE, M_DA,  OP_W1BE),
+    E1(0xD6, flowBranch(TEXT_CALL), PF_NONE, M_DA,  OP_W1BE),
     E1(0xD4, TEXT_CALL, PF_NONE, M_IRR, OP_BYT1),
 };
 
@@ -312,13 +312,13 @@ constexpr uint8_t INDEX_Z86C[] PROGMEM = {
 };
 
 constexpr Entry TABLE_SUPER8[] PROGMEM = {
-    E0(0x0F, TEXT_NEXT,   PF_NONE),
-    E0(0x1F, TEXT_ENTER,  PF_NONE),
-    E0(0x2F, TEXT_EXIT,   PF_NONE),
+    E0(0x0F, flowEnd(TEXT_NEXT),  PF_NONE),
+    E0(0x1F, flowEnd(TEXT_ENTER), PF_NONE),
+    E0(0x2F, flowEnd(TEXT_EXIT),  PF_NONE),
     E0(0x3F, TEXT_WFI,    PF_NONE),
     E0(0x4F, TEXT_SB0,    PF_NONE),
     E0(0x5F, TEXT_SB1,    PF_NONE),
-    E1(0xF6, TEXT_CALL,   PF_NONE, M_DA,  OP_W1BE),
+    E1(0xF6, flowBranch(TEXT_CALL), PF_NONE, M_DA,  OP_W1BE),
     E1(0xF4, TEXT_CALL,   PF_NONE, M_IRR, OP_BYT1),
     E1(0xD4, TEXT_CALL,   PF_NONE, M_IA,  OP_BYT1),
     E2(0x87, TEXT_LD,     PF_NONE, M_r,   M_X,   OP_B1HI, OP_BYT2), // x: OP_B1LO
@@ -339,8 +339,8 @@ constexpr Entry TABLE_SUPER8[] PROGMEM = {
     E2(0x83, TEXT_PUSHUI, PF_NONE, M_IR,  M_R,   OP_BYT1, OP_BYT2),
     E2(0x92, TEXT_POPUD,  PF_NONE, M_R,   M_IR,  OP_BYT2, OP_BYT1),
     E2(0x93, TEXT_POPUI,  PF_NONE, M_R,   M_IR,  OP_BYT2, OP_BYT1),
-    E3(0xC2, TEXT_CPIJE,  PF_NONE, M_r,   M_Ir,  M_RA, OP_B1LO, OP_B1HI, OP_BYT2),
-    E3(0xD2, TEXT_CPIJNE, PF_NONE, M_r,   M_Ir,  M_RA, OP_B1LO, OP_B1HI, OP_BYT2),
+    E3(0xC2, flowBranch(TEXT_CPIJE),  PF_NONE, M_r,   M_Ir,  M_RA, OP_B1LO, OP_B1HI, OP_BYT2),
+    E3(0xD2, flowBranch(TEXT_CPIJNE), PF_NONE, M_r,   M_Ir,  M_RA, OP_B1LO, OP_B1HI, OP_BYT2),
 };
 
 constexpr uint8_t INDEX_SUPER8[] PROGMEM = {
@@ -415,8 +415,8 @@ constexpr Entry TABLE_SUPER8_POST[] PROGMEM {
     E3(0x47, TEXT_LDB,   PF1_1, M_R,   M_IMb, M_r,   OP_BYT2, OP_B1LO, OP_B1HI),
     E3(0x67, TEXT_BAND,  PF1_0, M_r,   M_R,   M_IMb, OP_B1HI, OP_BYT2, OP_B1LO),
     E3(0x67, TEXT_BAND,  PF1_1, M_R,   M_IMb, M_r,   OP_BYT2, OP_B1LO, OP_B1HI),
-    E3(0x37, TEXT_BTJRF, PF1_0, M_RA,  M_r,   M_IMb, OP_BYT2, OP_B1HI, OP_B1LO),
-    E3(0x37, TEXT_BTJRT, PF1_1, M_RA,  M_r,   M_IMb, OP_BYT2, OP_B1HI, OP_B1LO),
+    E3(0x37, flowBranch(TEXT_BTJRF), PF1_0, M_RA,  M_r,   M_IMb, OP_BYT2, OP_B1HI, OP_B1LO),
+    E3(0x37, flowBranch(TEXT_BTJRT), PF1_1, M_RA,  M_r,   M_IMb, OP_BYT2, OP_B1HI, OP_B1LO),
 };
 
 constexpr uint8_t INDEX_SUPER8_POST[] PROGMEM {
@@ -87,11 +87,11 @@ constexpr Entry TABLE_Z80[] PROGMEM = {
     L1(0xC1, 0020, TEXT_POP,  R_PTRH),
     L1(0xE1, 0000, TEXT_POP,  R_HL),
     L1(0xF1, 0000, TEXT_POP,  R_AF),
-    E0(0xC9, 0000, TEXT_RET),
+    E0(0xC9, 0000, flowEnd(TEXT_RET)),
     L2(0xF9, 0000, TEXT_LD,   R_SP,  R_HL),
-    I2(0xC2, 0070, TEXT_JP,   M_CC8, M_JABS),
-    I1(0xC3, 0000, TEXT_JP,   M_JABS),
-    E1(0xE9, 0000, TEXT_JP,   I_HL),
+    I2(0xC2, 0070, flowBranch(TEXT_JP), M_CC8, M_JABS),
+    I1(0xC3, 0000, flowJump(TEXT_JP),   M_JABS),
+    E1(0xE9, 0000, flowJump(TEXT_JP),   I_HL),
     E2(0xD3, 0000, TEXT_OUT,  M_IOA, R_A),
     E2(0xDB, 0000, TEXT_IN,   R_A,   M_IOA),
     L2(0xE3, 0000, TEXT_EX,   I_SP,  R_HL),
@@ -100,11 +100,11 @@ constexpr Entry TABLE_Z80[] PROGMEM = {
     L2(0xEB, 0000, TEXT_EX,   R_HL,  R_DE),
     E0(0xF3, 0000, TEXT_DI),
     E0(0xFB, 0000, TEXT_EI),
-    I2(0xC4, 0070, TEXT_CALL, M_CC8, M_JABS),
+    I2(0xC4, 0070, flowBranch(TEXT_CALL), M_CC8, M_JABS),
     L1(0xC5, 0020, TEXT_PUSH, R_PTRH),
     L1(0xE5, 0000, TEXT_PUSH, R_HL),
     L1(0xF5, 0000, TEXT_PUSH, R_AF),
-    I1(0xCD, 0000, TEXT_CALL, M_JABS),
+    I1(0xCD, 0000, flowBranch(TEXT_CALL), M_JABS),
     E2(0xC6, 0000, TEXT_ADD,  R_A,   M_IM8),
     E2(0xCE, 0000, TEXT_ADC,  R_A,   M_IM8),
     E2(0xD6, 0000, TEXT_SUB,  R_A,   M_IM8),
@@ -115,9 +115,9 @@ constexpr Entry TABLE_Z80[] PROGMEM = {
     E2(0xFE, 0000, TEXT_CP,   R_A,   M_IM8),
     E1(0xC7, 0070, TEXT_RST,  M_VEC),
     E2(0x08, 0000, TEXT_EX,   R_AF,  R_ALT),
-    E1(0x10, 0000, TEXT_DJNZ, M_REL8),
-    E2(0x20, 0030, TEXT_JR,   M_CC4, M_REL8),
-    E1(0x18, 0000, TEXT_JR,   M_REL8),
+    E1(0x10, 0000, flowBranch(TEXT_DJNZ), M_REL8),
+    E2(0x20, 0030, flowBranch(TEXT_JR),   M_CC4, M_REL8),
+    E1(0x18, 0000, flowJump(TEXT_JR),     M_REL8),
     E0(0xD9, 0000, TEXT_EXX),
 };
 
@@ -241,8 +241,8 @@ constexpr Entry TABLE_Z80_EXT[] PROGMEM = {
     D2(0x4B, 0020, TEXT_LD,   R_PTRH, M_DABS),
     D2(0x7B, 0000, TEXT_LD,   R_SP,   M_DABS),
     E0(0x44, 0000, TEXT_NEG),
-    E0(0x45, 0000, TEXT_RETN),
-    E0(0x4D, 0000, TEXT_RETI),
+    E0(0x45, 0000, flowEnd(TEXT_RETN)),
+    E0(0x4D, 0000, flowEnd(TEXT_RETI)),
     E1(0x46, 0030, TEXT_IM,   M_IMMD),
     E2(0x47, 0000, TEXT_LD,   R_I,    R_A),
     E2(0x4F, 0000, TEXT_LD,   R_R,    R_A),
@@ -332,7 +332,7 @@ constexpr Entry TABLE_Z80_IDX[] PROGMEM = {
     I1(0xBE, 0000, TEXT_CP,   M_IDX8),
     I2(0xBE, 0000, TEXT_CP,   R_A,    M_IDX8),
     L1(0xE1, 0000, TEXT_POP,  R_IDX),
-    E1(0xE9, 0000, TEXT_JP,   I_IDX),
+    E1(0xE9, 0000, flowJump(TEXT_JP), I_IDX),
     L2(0xF9, 0000, TEXT_LD,   R_SP,   R_IDX),
     L2(0xE3, 0000, TEXT_EX,   I_SP,   R_IDX),
     L2(0xE3, 0000, TEXT_EX,   R_IDX,  I_SP),
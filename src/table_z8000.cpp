@@ -38,11 +38,11 @@ namespace z8000 {
 // clang-format off
 constexpr Entry TABLE_Z8000[] PROGMEM = {
     E2(0xC000, TEXT_LDB,    CF_0FFF, SZ_BYTE, M_R,    M_IM8,  OP_C8, OP_C0),
-    E1(0xD000, TEXT_CALR,   CF_0FFF, SZ_NONE, M_RA12,         OP_C0),
-    E2(0xE000, TEXT_JR,     CF_0FFF, SZ_NONE, M_CC,   M_RA8,  OP_C8, OP_C0),
-    E1(0xE800, TEXT_JR,     CF_00FF, SZ_NONE, M_RA8,          OP_C0),
-    E2(0xF000, TEXT_DBJNZ,  CF_0F7F, SZ_BYTE, M_R,    M_RA7,  OP_C8, OP_C0),
-    E2(0xF080, TEXT_DJNZ,   CF_0F7F, SZ_WORD, M_R,    M_RA7,  OP_C8, OP_C0),
+    E1(0xD000, flowBranch(TEXT_CALR),  CF_0FFF, SZ_NONE, M_RA12,         OP_C0),
+    E2(0xE000, flowJump(TEXT_JR),      CF_0FFF, SZ_NONE, M_CC,   M_RA8,  OP_C8, OP_C0),
+    E1(0xE800, flowJump(TEXT_JR),      CF_00FF, SZ_NONE, M_RA8,          OP_C0),
+    E2(0xF000, flowBranch(TEXT_DBJNZ), CF_0F7F, SZ_BYTE, M_R,    M_RA7,  OP_C8, OP_C0),
+    E2(0xF080, flowBranch(TEXT_DJNZ),  CF_0F7F, SZ_WORD, M_R,    M_RA7,  OP_C8, OP_C0),
     E2(0x3000, TEXT_LDRB,   CF_000F, SZ_BYTE, M_R,    M_RA,   OP_C0, OP_NO),
     E2(0x3000, TEXT_LDB,    CF_00FF, SZ_BYTE, M_R,    M_BA,   OP_C0, OP_C4),
     E2(0x3100, TEXT_LDR,    CF_000F, SZ_WORD, M_R,    M_RA,   OP_C0, OP_NO),
@@ -66,7 +66,7 @@ constexpr Entry TABLE_Z8000[] PROGMEM = {
     E2(0x7600, TEXT_LDA,    CF_00FF, SZ_ADDR, M_R,    M_GENA, OP_C0, OP_C4),
     X2(0x7700, TEXT_LDL,    CF_00FF, SZ_QUAD, M_BX,   M_R,    OP_C4, OP_C0, PF_0X00),
     E0(0x7A00, TEXT_HALT,   CF_0000),
-    E0(0x7B00, TEXT_IRET,   CF_0000),
+    E0(0x7B00, flowEnd(TEXT_IRET), CF_0000),
     E0(0x7B08, TEXT_MSET,   CF_0000),
     E0(0x7B09, TEXT_MRES,   CF_0000),
     E0(0x7B0A, TEXT_MBIT,   CF_0000),
@@ -89,7 +89,7 @@ constexpr Entry TABLE_Z8000[] PROGMEM = {
     E1(0x8D03, TEXT_RESFLG, CF_00F0, SZ_NONE, M_FLAG,         OP_C4),
     E1(0x8D05, TEXT_COMFLG, CF_00F0, SZ_NONE, M_FLAG,         OP_C4),
     E0(0x8D07, TEXT_NOP,    CF_0000),
-    E1(0x9E00, TEXT_RET,    CF_000F, SZ_NONE, M_CC,           OP_C0),
+    E1(0x9E00, flowEnd(TEXT_RET), CF_000F, SZ_NONE, M_CC,           OP_C0),
     E2(0xAE00, TEXT_TCCB,   CF_00FF, SZ_BYTE, M_CC,   M_R,    OP_C0, OP_C4),
     E1(0xAE08, TEXT_TCCB,   CF_00F0, SZ_BYTE, M_R,            OP_C4),
     E2(0xAF00, TEXT_TCC,    CF_00FF, SZ_WORD, M_CC,   M_R,    OP_C0, OP_C4),
@@ -167,9 +167,9 @@ constexpr Entry TABLE_Z8000[] PROGMEM = {
     E1(0x1C08, TEXT_TESTL,  CF_C0F0, SZ_QUAD, M_GEND,         OP_C4),
     X3(0x1C09, TEXT_LDM,    CF_C0F0, SZ_WORD, M_GENA, M_R,    OP_C4, OP_P8, M_CNT, PF_0X0X),
     E2(0x1D00, TEXT_LDL,    CF_C0FF, SZ_QUAD, M_GENA, M_R,    OP_C4, OP_C0),
-    E2(0x1E00, TEXT_JP,     CF_C0FF, SZ_WORD, M_CC,   M_GENA, OP_C0, OP_C4),
-    E1(0x1E08, TEXT_JP,     CF_C0F0, SZ_WORD, M_GENA,         OP_C4),
-    E1(0x1F00, TEXT_CALL,   CF_C0FF, SZ_WORD, M_GENA,         OP_C4),
+    E2(0x1E00, flowJump(TEXT_JP),     CF_C0FF, SZ_WORD, M_CC,   M_GENA, OP_C0, OP_C4),
+    E1(0x1E08, flowJump(TEXT_JP),     CF_C0F0, SZ_WORD, M_GENA,         OP_C4),
+    E1(0x1F00, flowBranch(TEXT_CALL), CF_C0FF, SZ_WORD, M_GENA,         OP_C4),
     E2(0x2000, TEXT_LDB,    CF_C0FF, SZ_BYTE, M_R,    M_GENI, OP_C0, OP_C4),
     E2(0x2100, TEXT_LD,     CF_C0FF, SZ_WORD, M_R,    M_GENI, OP_C0, OP_C4),
     X2(0x2200, TEXT_RESB,   CF_000F, SZ_BYTE, M_R,    M_WR07, OP_P8, OP_C0, PF_0X00),
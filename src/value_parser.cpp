@@ -17,6 +17,7 @@
 #include "value_parser.h"
 #include "config_base.h"
 #include "stack.h"
+#include "stats.h"
 
 namespace libasm {
 
@@ -153,15 +154,25 @@ struct OperatorStack : Stack<Operator, 8> {
     Operator &top() { return _contents[_size - 1]; }
 };
 
-Value ValueParser::eval(StrScanner &scan, ErrorAt &error, ParserContext &context) const {
+Value ValueParser::eval(StrScanner &scan, ErrorAt &error, ParserContext &context,
+        ValueRecorder *recorder) const {
+    stats::count(stats::VALUE_EVAL);
     const auto start = scan.skipSpaces();
-    const auto value = _eval(scan, error, context);
+    const auto value = _eval(scan, error, context, recorder);
     if (scan.str() == start.str())
         error.setErrorIf(start, NOT_AN_EXPECTED);
     return value;
 }
 
-Value ValueParser::_eval(StrScanner &scan, ErrorAt &error, ParserContext &context) const {
+Error ValueParser::evalOperator(const Operator &opr, ValueStack &vstack, ParserContext &context,
+        ValueRecorder *recorder, int_fast8_t argc) {
+    if (recorder)
+        recorder->evalOperator(opr, argc);
+    return opr.eval(vstack, context, argc);
+}
+
+Value ValueParser::_eval(StrScanner &scan, ErrorAt &error, ParserContext &context,
+        ValueRecorder *recorder) const {
     ValueStack vstack;
     OperatorStack ostack;
     char end_of_expr = context.delimitor;
@@ -183,13 +194,16 @@ Value ValueParser::_eval(StrScanner &scan, ErrorAt &error, ParserContext &contex
         if (maybe_prefix) {
             // Prefix operator may consist of alpha numeric text. Check operator before handling
             // symbols.
+            const auto size = vstack.size();
             opr = _operators.readPrefix(scan, vstack, context);
             if (error.hasError())
                 return Value();
+            if (recorder && vstack.size() != size)
+                recorder->unrecordable();
         }
         if (maybe_prefix && opr == nullptr) {
             Value val;
-            auto err = parseConstant(scan, val, context);
+            auto err = parseConstant(scan, val, context, recorder);
             if (err == OK) {
                 if (vstack.full()) {
                     error.setErrorIf(at, TOO_COMPLEX_EXPRESSION);
@@ -231,6 +245,8 @@ Value ValueParser::_eval(StrScanner &scan, ErrorAt &error, ParserContext &contex
                     error.setErrorIf(at, TOO_COMPLEX_EXPRESSION);
                     return Value();
                 }
+                if (recorder)
+                    recorder->pushSymbol(symbol);
                 const auto *value =
                         context.symbolTable ? context.symbolTable->lookupSymbol(symbol) : nullptr;
                 if (value) {
@@ -245,6 +261,7 @@ Value ValueParser::_eval(StrScanner &scan, ErrorAt &error, ParserContext &contex
         }
 
         if (opr == nullptr) {
+            const auto size = vstack.size();
             if (maybe_prefix) {
                 opr = _operators.readPrefix(scan, vstack, context);
             } else {
@@ -252,6 +269,8 @@ Value ValueParser::_eval(StrScanner &scan, ErrorAt &error, ParserContext &contex
             }
             if (error.hasError())
                 return Value();
+            if (recorder && vstack.size() != size)
+                recorder->unrecordable();
         }
         if (opr) {
             while (!ostack.empty()) {
@@ -264,7 +283,7 @@ Value ValueParser::_eval(StrScanner &scan, ErrorAt &error, ParserContext &contex
                 if (!top.isHigher(*opr))
                     break;
                 const auto op = ostack.pop();
-                const auto err = op.eval(vstack, context);
+                const auto err = evalOperator(op, vstack, context, recorder);
                 if (err) {
                     error.setErrorIf(op, err);
                     return Value();
@@ -284,7 +303,7 @@ Value ValueParser::_eval(StrScanner &scan, ErrorAt &error, ParserContext &contex
             // non-zero |in_fn_args| ensures the existence of open parenthesis in |ostack|.
             while (!ostack.top().isOpenParen()) {
                 const auto op = ostack.pop();
-                const auto err = op.eval(vstack, context);
+                const auto err = evalOperator(op, vstack, context, recorder);
                 if (err) {
                     error.setErrorIf(op, err);
                     return Value();
@@ -317,7 +336,7 @@ Value ValueParser::_eval(StrScanner &scan, ErrorAt &error, ParserContext &contex
         if (_operators.isCloseExpr(scan)) {
             while (!ostack.empty() && !ostack.top().isOpenParen()) {
                 const auto op = ostack.pop();
-                const auto err = op.eval(vstack, context);
+                const auto err = evalOperator(op, vstack, context, recorder);
                 if (err) {
                     error.setErrorIf(op, err);
                     return Value();
@@ -331,7 +350,7 @@ Value ValueParser::_eval(StrScanner &scan, ErrorAt &error, ParserContext &contex
             if (!ostack.empty() && ostack.top().isFunction()) {
                 const auto argc = vstack.size() - openParen.stackPosition();
                 const auto fn = ostack.pop();
-                const auto err = fn.eval(vstack, context, argc);
+                const auto err = evalOperator(fn, vstack, context, recorder, argc);
                 if (err) {
                     error.setErrorIf(fn, err);
                     return Value();
@@ -354,7 +373,7 @@ Value ValueParser::_eval(StrScanner &scan, ErrorAt &error, ParserContext &contex
             error.setErrorIf(op, MISSING_CLOSING_PAREN);
             return Value();
         }
-        const auto err = op.eval(vstack, context);
+        const auto err = evalOperator(op, vstack, context, recorder);
         if (err) {
             error.setErrorIf(op, err);
             return Value();
@@ -363,7 +382,8 @@ Value ValueParser::_eval(StrScanner &scan, ErrorAt &error, ParserContext &contex
     return vstack.pop();
 }
 
-Error ValueParser::parseConstant(StrScanner &scan, Value &val, ParserContext &context) const {
+Error ValueParser::parseConstant(
+        StrScanner &scan, Value &val, ParserContext &context, ValueRecorder *recorder) const {
     auto p = scan;
 
     char letter;
@@ -371,7 +391,7 @@ Error ValueParser::parseConstant(StrScanner &scan, Value &val, ParserContext &co
     if (err == OK) {
         val.setUnsigned(static_cast<uint8_t>(letter));
         scan = p;
-        return OK;
+        return recordValue(val, recorder);
     }
     if (err != NOT_AN_EXPECTED)
         return err;
@@ -381,11 +401,11 @@ Error ValueParser::parseConstant(StrScanner &scan, Value &val, ParserContext &co
     const auto ferr = _number.parseFloat(fp, p, val, err, context.delimitor);
     if (ferr != NOT_AN_EXPECTED) {
         scan = fp;
-        return ferr;
+        return ferr ? ferr : recordValue(val, recorder);
     }
     if (err != NOT_AN_EXPECTED) {
         scan = p;
-        return err;
+        return err ? err : recordValue(val, recorder);
     }
 
     // Motorola-style number fallback: $hex, %bin, @oct. Skip any prefix char
@@ -406,19 +426,27 @@ Error ValueParser::parseConstant(StrScanner &scan, Value &val, ParserContext &co
         if (motoErr != NOT_AN_EXPECTED) {
             val = motoVal;
             scan = q;
-            return motoErr;
+            return motoErr ? motoErr : recordValue(val, recorder);
         }
     }
 
     if (_symbol.locationSymbol(p)) {
         val.setUnsigned(context.currentLocation);
         scan = p;
+        if (recorder)
+            recorder->pushLocation();
         return OK;
     }
 
     return NOT_AN_EXPECTED;
 }
 
+Error ValueParser::recordValue(const Value &val, ValueRecorder *recorder) {
+    if (recorder)
+        recorder->pushValue(val);
+    return OK;
+}
+
 Error ValueParser::readSymbol(StrScanner &scan, StrScanner &symbol) const {
     symbol = scan;
     if (_symbol.symbolLetter(*symbol++, true)) {
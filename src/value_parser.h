@@ -39,6 +39,22 @@ struct ParserContext final {
     Radix defaultRadix;
 };
 
+/**
+ * Receiver of evaluation steps of an expression in postfix order.
+ */
+struct ValueRecorder {
+    /** |value| is pushed onto value stack. */
+    virtual void pushValue(const Value &value) = 0;
+    /** Value of |symbol| is pushed onto value stack. */
+    virtual void pushSymbol(const StrScanner &symbol) = 0;
+    /** Current location is pushed onto value stack. */
+    virtual void pushLocation() = 0;
+    /** |opr| is evaluated with |argc| arguments on value stack. */
+    virtual void evalOperator(const Operator &opr, int_fast8_t argc) = 0;
+    /** The expression has a step which can't be recorded. */
+    virtual void unrecordable() = 0;
+};
+
 struct ValueParser {
     struct Plugins {
         virtual const NumberParser &number() const;
@@ -100,9 +116,10 @@ struct ValueParser {
     /**
      * Parse |scan| text using |context| and return expression valu|.  Undefined
      * symbol reference in expression will be checked by UNDEFINED_SYMBOL in
-     * |error|.
+     * |error|. Evaluation steps are notified to |recorder| if any.
      */
-    Value eval(StrScanner &scan, ErrorAt &error, ParserContext &context) const;
+    Value eval(StrScanner &scan, ErrorAt &error, ParserContext &context,
+            ValueRecorder *recorder = nullptr) const;
 
     /**
      * Parse |scan| text and return letter constant.
@@ -131,8 +148,13 @@ private:
     const OperatorParser &_operators;
     const FunctionTable &_function;
 
-    Value _eval(StrScanner &scan, ErrorAt &error, ParserContext &context) const;
-    Error parseConstant(StrScanner &scan, Value &val, ParserContext &context) const;
+    Value _eval(StrScanner &scan, ErrorAt &error, ParserContext &context,
+            ValueRecorder *recorder) const;
+    Error parseConstant(
+            StrScanner &scan, Value &val, ParserContext &context, ValueRecorder *recorder) const;
+    static Error recordValue(const Value &val, ValueRecorder *recorder);
+    static Error evalOperator(const Operator &opr, ValueStack &vstack, ParserContext &context,
+            ValueRecorder *recorder, int_fast8_t argc = 0);
     Error readFunctionName(StrScanner &scan, StrScanner &name) const;
 };
 
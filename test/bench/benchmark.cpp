@@ -0,0 +1,348 @@
+/*
+ * Copyright 2026 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "asm_driver.h"
+#include "asm_list.h"
+#include "bin_decoder.h"
+#include "bin_memory.h"
+#include "dis_driver.h"
+#include "dis_list.h"
+#include "file_reader.h"
+#include "file_sources.h"
+#include "stored_printer.h"
+#include "version.h"
+
+#include <libgen.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace libasm;
+using namespace libasm::cli;
+using namespace libasm::driver;
+
+namespace {
+
+AsmDriver asmDriver{asmDirectives()};
+DisDriver disDriver{disassemblers()};
+
+/** An instruction decoded from a binary, which is encoded again */
+struct Line {
+    uint32_t address;
+    std::string text;
+};
+
+/** Benchmark results of a reference source and its binary */
+struct Result {
+    std::string name;
+    std::string cpu;
+    /** Number of listing lines */
+    size_t lines = 0;
+    /** Number of bytes in the binary */
+    size_t bytes = 0;
+    /** Number of instructions decoded from the binary */
+    size_t insns = 0;
+    /** Number of errors while assembling the source */
+    int errors = 0;
+    /** Number of decoded instructions which can't be encoded again */
+    size_t encodeErrors = 0;
+    /** Listing lines per second of |AsmDriver| */
+    double assemble = 0;
+    /** Instructions per second of |DisDriver| */
+    double disassemble = 0;
+    /** Instructions per second of |Assembler::encode| */
+    double encode = 0;
+    /** Instructions per second of |Disassembler::decode| */
+    double decode = 0;
+};
+
+/** Run |func| repeatedly for at least |minTime| seconds, and return seconds per run. */
+template <typename F>
+double measure(F func, double minTime) {
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+    size_t runs = 0;
+    std::chrono::duration<double> elapsed;
+    do {
+        func();
+        runs++;
+        elapsed = clock::now() - start;
+    } while (elapsed.count() < minTime);
+    return elapsed.count() / runs;
+}
+
+/** Assemble |name| with as many passes as the asm command does, and return the errors. */
+int assemble(const std::string &name, SourceCache &cache, BinMemory &memory,
+        StoredPrinter &listout) {
+    BinMemory prev;
+    StoredPrinter errorout;
+    int errors = 0;
+    auto reportError = false;
+    asmDriver.clearSymbols();
+    do {
+        FileSources sources{cache};
+        if (sources.open(StrScanner{name.c_str()}))
+            return -1;
+        prev.swap(memory);
+        asmDriver.symbols().resetChanges();
+        memory.clear();
+        listout.clear();
+        errorout.clear();
+        asmDriver.restore();
+        errors = asmDriver.assemble(sources, memory, listout, errorout, reportError);
+        if (!reportError && asmDriver.resolveFixups(sources, memory, &listout))
+            break;
+        reportError = true;
+    } while (errorout.size() == 0 && (asmDriver.symbols().changed() || memory != prev));
+    return errors;
+}
+
+bool readBinary(const std::string &name, BinMemory &memory) {
+    FileReader input(name);
+    if (!input.open())
+        return false;
+    return BinDecoder::decode(input, memory) > 0;
+}
+
+/**
+ * Decode all instructions in |memory| by |Disassembler::decode| with operands, and return the
+ * number of them. Instructions decoded without error are appended to |lines| unless it is
+ * nullptr.
+ */
+size_t decode(Disassembler &dis, const BinMemory &memory, std::vector<Line> *lines) {
+    char operands[Disassembler::MAX_OPERANDS];
+    size_t count = 0;
+    for (auto block = memory.begin(); block != nullptr; block = block->next()) {
+        auto reader = block->reader();
+        const auto unit = dis.config().addressUnit();
+        Insn insn(0);
+        // A pending continuation re-decodes the bytes of the previous instruction.
+        while (insn.hasContinue() || reader.hasNext()) {
+            const auto at = reader.address();
+            if (!insn.hasContinue())
+                insn.reset(at / unit);
+            dis.decode(reader, insn, operands, sizeof(operands));
+            count++;
+            if (lines && insn.isOK()) {
+                std::string line{insn.name()};
+                if (*operands) {
+                    line += ' ';
+                    line += operands;
+                }
+                lines->push_back(Line{insn.address(), line});
+            }
+            // An instruction which reads no byte stops decoding the block.
+            if (reader.address() == at && !insn.hasContinue())
+                break;
+        }
+    }
+    return count;
+}
+
+/** Encode |lines| and return the number of errors. */
+size_t encode(Assembler &assembler, const std::vector<Line> &lines) {
+    size_t errors = 0;
+    for (const auto &line : lines) {
+        Insn insn(line.address);
+        if (assembler.encode(line.text.c_str(), insn) != OK)
+            errors++;
+    }
+    return errors;
+}
+
+bool bench(const char *input, double minTime, Result &result) {
+    std::string name{input};
+    const auto dot = name.find_last_of('.');
+    const auto base = dot == std::string::npos ? name : name.substr(0, dot);
+    const auto slash = base.find_last_of('/');
+    result.name = slash == std::string::npos ? base : base.substr(slash + 1);
+
+    SourceCache cache;
+    BinMemory memory;
+    StoredPrinter listout;
+    asmDriver.reset();
+    asmDriver.save();
+    result.errors = assemble(name, cache, memory, listout);
+    if (result.errors < 0) {
+        fprintf(stderr, "%s: Can't open input file\n", input);
+        return false;
+    }
+    result.cpu = asmDriver.current()->cpu_P();
+    result.lines = listout.size();
+    // Encode with CPU and options which the source has set.
+    std::unique_ptr<Assembler> encoder{asmDriver.current()->assembler().clone()};
+    result.assemble =
+            result.lines / measure([&]() { assemble(name, cache, memory, listout); }, minTime);
+
+    BinMemory binary;
+    for (const auto *suffix : {".hex", ".s19", ".s28", ".s37"}) {
+        if (readBinary(base + suffix, binary))
+            break;
+    }
+    if (binary.begin() == nullptr) {
+        fprintf(stderr, "%s: No binary file\n", input);
+        return true;
+    }
+    auto *dis = disDriver.setCpu(result.cpu.c_str());
+    if (dis == nullptr) {
+        fprintf(stderr, "%s: Unknown CPU %s\n", input, result.cpu.c_str());
+        return true;
+    }
+    for (auto block = binary.begin(); block != nullptr; block = block->next())
+        result.bytes += block->size();
+
+    std::vector<Line> lines;
+    result.insns = decode(*dis, binary, &lines);
+    result.decode = result.insns / measure([&]() { decode(*dis, binary, nullptr); }, minTime);
+    result.encodeErrors = encode(*encoder, lines);
+    result.encode = lines.size() / measure([&]() { encode(*encoder, lines); }, minTime);
+    StoredPrinter output, errorout;
+    const auto disassemble = [&]() {
+        output.clear();
+        listout.clear();
+        errorout.clear();
+        disDriver.disassemble(binary, input, output, listout, errorout);
+    };
+    result.disassemble = result.insns / measure(disassemble, minTime);
+    return true;
+}
+
+void printCsv(FILE *out, const std::vector<Result> &results) {
+    fprintf(out,
+            "name,cpu,lines,bytes,insns,errors,encode_errors,assemble,disassemble,encode,"
+            "decode\n");
+    for (const auto &r : results) {
+        fprintf(out, "%s,%s,%zu,%zu,%zu,%d,%zu,%.0f,%.0f,%.0f,%.0f\n", r.name.c_str(),
+                r.cpu.c_str(), r.lines, r.bytes, r.insns, r.errors, r.encodeErrors, r.assemble,
+                r.disassemble, r.encode, r.decode);
+    }
+}
+
+void printJson(FILE *out, const std::vector<Result> &results) {
+    fprintf(out, "{\n  \"version\": \"%s\",\n  \"results\": [", LIBASM_VERSION_STRING);
+    const char *sep = "\n";
+    for (const auto &r : results) {
+        fprintf(out,
+                "%s    {\"name\": \"%s\", \"cpu\": \"%s\", \"lines\": %zu, \"bytes\": %zu, "
+                "\"insns\": %zu, \"errors\": %d, \"encode_errors\": %zu, \"assemble\": %.0f, "
+                "\"disassemble\": %.0f, \"encode\": %.0f, \"decode\": %.0f}",
+                sep, r.name.c_str(), r.cpu.c_str(), r.lines, r.bytes, r.insns, r.errors,
+                r.encodeErrors, r.assemble, r.disassemble, r.encode, r.decode);
+        sep = ",\n";
+    }
+    fprintf(out, "\n  ]\n}\n");
+}
+
+bool print(const char *name, void (*printer)(FILE *, const std::vector<Result> &),
+        const std::vector<Result> &results) {
+    auto *out = fopen(name, "w");
+    if (out == nullptr) {
+        fprintf(stderr, "Can't open output file %s\n", name);
+        return false;
+    }
+    printer(out, results);
+    fclose(out);
+    return true;
+}
+
+int usage(const char *prog) {
+    fprintf(stderr,
+            R"(libasm benchmark (version %s)
+usage: %s [-t <msec>] [-c <csv>] [-j <json>] <input>...
+  -t <msec>         : minimum time of each measurement (default 100)
+  -c <csv>          : output CSV file
+  -j <json>         : output JSON file
+  -v                : print progress verbosely
+  <input>           : assembler source, which has a binary file of the same
+                      name with .hex, .s19, .s28, or .s37 suffix
+Results are listing lines per second of "assemble", and instructions per
+second of "disassemble", "encode", and "decode". Results are printed to
+stdout in CSV format unless -c or -j is specified.
+)",
+            LIBASM_VERSION_STRING, prog);
+    return 2;
+}
+
+}  // namespace
+
+int main(int argc, const char **argv) {
+    const auto prog = basename(const_cast<char *>(argv[0]));
+    double minTime = 0.1;
+    const char *csv = nullptr;
+    const char *json = nullptr;
+    auto verbose = false;
+    std::vector<const char *> inputs;
+    for (auto i = 1; i < argc; i++) {
+        const auto *opt = argv[i];
+        if (*opt == '-') {
+            switch (*++opt) {
+            case 't':
+                if (++i >= argc)
+                    return usage(prog);
+                minTime = strtod(argv[i], nullptr) / 1000;
+                break;
+            case 'c':
+                if (++i >= argc)
+                    return usage(prog);
+                csv = argv[i];
+                break;
+            case 'j':
+                if (++i >= argc)
+                    return usage(prog);
+                json = argv[i];
+                break;
+            case 'v':
+                verbose = true;
+                break;
+            default:
+                fprintf(stderr, "unknown option: %s\n", opt);
+                return usage(prog);
+            }
+        } else {
+            inputs.push_back(opt);
+        }
+    }
+    if (inputs.empty())
+        return usage(prog);
+
+    std::vector<Result> results;
+    for (const auto *input : inputs) {
+        if (verbose)
+            fprintf(stderr, "%s\n", input);
+        Result result;
+        if (bench(input, minTime, result))
+            results.push_back(result);
+    }
+
+    if (csv == nullptr && json == nullptr)
+        printCsv(stdout, results);
+    if (csv && !print(csv, printCsv, results))
+        return 1;
+    if (json && !print(json, printJson, results))
+        return 1;
+    return 0;
+}
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -332,6 +332,32 @@ ins8060:19:16: error: Missing function arguments: "CONS    ; missing"
 )");
 }
 
+void test_function_program() {
+    PREP_ASM(mc6809::AsmMc6809, MotorolaDirective);
+
+    driver.setUpperHex(true);
+
+    ASM("mc6809",
+            R"(        org   $1000
+offset  .function v, v+base-*
+twice   .function v, offset(v)*2
+        fdb   offset(1)
+        fdb   offset(2)
+        fdb   twice(3)
+        fdb   twice(4)
+base    equ   $10
+)",
+            R"(       1000 :                            org   $1000
+       1000 :                    offset  .function v, v+base-*
+       1000 :                    twice   .function v, offset(v)*2
+       1000 : F0 11                      fdb   offset(1)
+       1002 : F0 10                      fdb   offset(2)
+       1004 : E0 1E                      fdb   twice(3)
+       1006 : E0 1C                      fdb   twice(4)
+       1008 : =10                base    equ   $10
+)");
+}
+
 void test_forward_labels() {
     PREP_ASM(mc6809::AsmMc6809, MotorolaDirective);
 
@@ -361,6 +387,67 @@ label5  equ   4
 )");
 }
 
+void test_fixups() {
+    PREP_ASM(mc6809::AsmMc6809, MotorolaDirective);
+
+    driver.setUpperHex(true);
+
+    TestReader source("mc6809");
+    sources.add(source.add(R"(        org   $1000
+        ldx   #data
+        jmp   >label1
+        fcb   label1-*
+label1: rts
+data:   fdb   label1
+)"));
+    sources.open(source.name().c_str());
+    driver.reset();
+    options.set(driver);
+    driver.setCpu("mc6809");
+    BinMemory memory;
+    StoredPrinter list, error;
+    driver.assemble(sources, memory, list, error, false);
+    TRUE("resolved", driver.resolveFixups(sources, memory, &list));
+    TestReader expected("expected");
+    expected.add(R"(       1000 :                            org   $1000
+       1000 : 8E 10 08                   ldx   #data
+       1003 : 7E 10 07                   jmp   >label1
+       1006 : 01                         fcb   label1-*
+       1007 : 39                 label1: rts
+       1008 : 10 07              data:   fdb   label1
+)");
+    for (size_t lineno = 1; lineno <= list.size(); lineno++)
+        EQ("line", expected.readLine(), list.line(lineno));
+    EQ("line eor", nullptr, expected.readLine());
+
+    // A smart branch changes its length after forward label is resolved.
+    driver.clearSymbols();
+    options.set("smart-branch", "on");
+    source.clear("mc6809").add(R"(        org   $1000
+        jmp   label1
+label1: rts
+)");
+    sources.open(source.name().c_str());
+    driver.reset();
+    options.set(driver);
+    driver.setCpu("mc6809");
+    memory.clear();
+    list.clear();
+    driver.assemble(sources, memory, list, error, false);
+    FALSE("not resolved", driver.resolveFixups(sources, memory, &list));
+
+    driver.clearSymbols();
+    ASM("mc6809",
+            R"(        org   $1000
+        jmp   label1
+label1: rts
+)",
+            R"(       1000 :                            org   $1000
+       1000 : 7E 10 03                   jmp   label1
+       1003 : 39                 label1: rts
+)");
+}
+
 void test_include() {
     PREP_ASM(mc6809::AsmMc6809, MotorolaDirective);
 
@@ -389,6 +476,204 @@ mc6809:5:18: error: Include file not found: "data/not-exist.inc""
 )");
 }
 
+static void assemble(AsmDriver &driver, TestSources &sources, const TestReader &source,
+        StoredPrinter &list) {
+    BinMemory memory, prev;
+    StoredPrinter error;
+    bool reportError = false;
+    driver.clearSymbols();
+    do {
+        sources.open(source.name().c_str());
+        prev.swap(memory);
+        driver.symbols().resetChanges();
+        memory.clear();
+        list.clear();
+        error.clear();
+        driver.reset();
+        driver.setCpu("mc6809");
+        driver.assemble(sources, memory, list, error, reportError);
+        if (!reportError && driver.resolveFixups(sources, memory, &list))
+            break;
+        reportError = true;
+    } while (error.size() == 0 && (driver.symbols().changed() || memory != prev));
+}
+
+static bool changedByPass(AsmDriver &driver, TestSources &sources, TestReader &source,
+        const char *text) {
+    BinMemory memory;
+    StoredPrinter list, error;
+    source.clear("mc6809").add(text);
+    sources.open(source.name().c_str());
+    driver.symbols().resetChanges();
+    driver.reset();
+    driver.setCpu("mc6809");
+    driver.assemble(sources, memory, list, error, true);
+    return driver.symbols().changed();
+}
+
+void test_function_changes() {
+    PREP_ASM(mc6809::AsmMc6809, MotorolaDirective);
+
+    TestReader source("mc6809");
+    sources.add(source);
+    driver.clearSymbols();
+
+    TRUE("define", changedByPass(driver, sources, source, "twice .function v, v*2\n"));
+    FALSE("same", changedByPass(driver, sources, source, "twice .function v, v*2\n"));
+    TRUE("body", changedByPass(driver, sources, source, "twice .function v, v+v\n"));
+    TRUE("params", changedByPass(driver, sources, source, "twice .function w, w+w\n"));
+    FALSE("same", changedByPass(driver, sources, source, "twice .function w, w+w\n"));
+    TRUE("undefine", changedByPass(driver, sources, source, "        nop\n"));
+}
+
+void test_incremental() {
+    PREP_ASM(mc6809::AsmMc6809, MotorolaDirective);
+
+    driver.setUpperHex(true);
+    driver.setIncremental(true);
+
+    TestReader source("mc6809");
+    sources.add(source);
+    StoredPrinter list;
+
+    const char *program = R"(        org   $1000
+start:  ldx   #data
+        bsr   sub
+        bra   start
+sub:    lda   #1
+        sta   ,x
+        rts
+data:   fdb   start
+)";
+    const char *listing = R"(       1000 :                            org   $1000
+       1000 : 8E 10 0C           start:  ldx   #data
+       1003 : 8D 02                      bsr   sub
+       1005 : 20 F9                      bra   start
+       1007 : 86 01              sub:    lda   #1
+       1009 : A7 84                      sta   ,x
+       100B : 39                         rts
+       100C : 10 00              data:   fdb   start
+)";
+    source.clear("mc6809").add(program);
+    assemble(driver, sources, source, list);
+    EQ("first", 0, driver.reusedLines());
+    TestReader expected("expected");
+    expected.add(listing);
+    for (size_t lineno = 1; lineno <= list.size(); lineno++)
+        EQ("first", expected.readLine(), list.line(lineno));
+    EQ("first eor", nullptr, expected.readLine());
+
+    // Lines which refer forward labels are encoded again.
+    source.clear("mc6809").add(program);
+    assemble(driver, sources, source, list);
+    EQ("same", 5, driver.reusedLines());
+    expected.clear("expected").add(listing);
+    for (size_t lineno = 1; lineno <= list.size(); lineno++)
+        EQ("same", expected.readLine(), list.line(lineno));
+    EQ("same eor", nullptr, expected.readLine());
+
+    source.clear("mc6809").add(R"(        org   $1000
+start:  ldx   #data
+        bsr   sub
+        bra   start
+sub:    lda   #2
+        sta   ,x
+        rts
+data:   fdb   start
+)");
+    assemble(driver, sources, source, list);
+    EQ("edit", 4, driver.reusedLines());
+    expected.clear("expected").add(R"(       1000 :                            org   $1000
+       1000 : 8E 10 0C           start:  ldx   #data
+       1003 : 8D 02                      bsr   sub
+       1005 : 20 F9                      bra   start
+       1007 : 86 02              sub:    lda   #2
+       1009 : A7 84                      sta   ,x
+       100B : 39                         rts
+       100C : 10 00              data:   fdb   start
+)");
+    for (size_t lineno = 1; lineno <= list.size(); lineno++)
+        EQ("edit", expected.readLine(), list.line(lineno));
+    EQ("edit eor", nullptr, expected.readLine());
+
+    // Inserted line moves following lines.
+    source.clear("mc6809").add(R"(        org   $1000
+start:  ldx   #data
+        bsr   sub
+        bra   start
+        nop
+sub:    lda   #2
+        sta   ,x
+        rts
+data:   fdb   start
+)");
+    assemble(driver, sources, source, list);
+    EQ("insert", 1, driver.reusedLines());
+    expected.clear("expected").add(R"(       1000 :                            org   $1000
+       1000 : 8E 10 0D           start:  ldx   #data
+       1003 : 8D 03                      bsr   sub
+       1005 : 20 F9                      bra   start
+       1007 : 12                         nop
+       1008 : 86 02              sub:    lda   #2
+       100A : A7 84                      sta   ,x
+       100C : 39                         rts
+       100D : 10 00              data:   fdb   start
+)");
+    for (size_t lineno = 1; lineno <= list.size(); lineno++)
+        EQ("insert", expected.readLine(), list.line(lineno));
+    EQ("insert eor", nullptr, expected.readLine());
+}
+
+void test_session() {
+    mc6809::AsmMc6809 asm6809;
+    MotorolaDirective dir6809(asm6809);
+    z80::AsmZ80 asmz80;
+    ZilogDirective dirz80(asmz80);
+    AsmDriver driver{&dir6809, &dirz80};
+    TestSources sources;
+
+    driver.setUpperHex(true);
+    driver.reset();
+    driver.setCpu("6309");
+    driver.setOption("list-radix", "8");
+    driver.save();
+
+    TestReader source("session");
+    sources.add(source);
+    BinMemory memory;
+    StoredPrinter list, error;
+    // Each restore brings back the CPU and options which changed in the previous one.
+    for (auto i = 0; i < 2; i++) {
+        source.clear("session").add(R"(        ldq   #$12345678
+        option "list-radix", 16
+        ldq   #$12345678
+        cpu   z80
+        ld    hl, 1234H
+        option "list-radix", 16
+        ld    hl, 1234H
+)");
+        sources.open(source.name().c_str());
+        memory.clear();
+        list.clear();
+        error.clear();
+        driver.restore();
+        driver.assemble(sources, memory, list, error);
+        TestReader expected("expected");
+        expected.add(R"(          0 : 315 022 064 126            ldq   #$12345678
+          4 : 170
+          5 :                            option "list-radix", 16
+          5 : CD 12 34 56 78             ldq   #$12345678
+          A :                            cpu   z80
+         12 : 041 064 022                ld    hl, 1234H
+          D :                            option "list-radix", 16
+          D : 21 34 12                   ld    hl, 1234H
+)");
+        for (size_t lineno = 1; lineno <= list.size(); lineno++)
+            EQ("session", expected.readLine(), list.line(lineno));
+        EQ("session eor", nullptr, expected.readLine());
+    }
+}
+
 void run_tests() {
     RUN_TEST(test_symbols_mc6809);
     RUN_TEST(test_symbols_ins8060);
@@ -397,8 +682,13 @@ void run_tests() {
     RUN_TEST(test_switch_cpu);
     RUN_TEST(test_list_radix);
     RUN_TEST(test_function);
+    RUN_TEST(test_function_program);
     RUN_TEST(test_forward_labels);
+    RUN_TEST(test_fixups);
     RUN_TEST(test_include);
+    RUN_TEST(test_function_changes);
+    RUN_TEST(test_incremental);
+    RUN_TEST(test_session);
 }
 
 }  // namespace test
@@ -85,6 +85,40 @@ void test_read_write() {
     ASSERT(memory, "clear", 0x000, 0x000, 0, 0);
 }
 
+void test_write() {
+    BinMemory memory;
+    uint8_t data[0x2100];
+    for (size_t i = 0; i < sizeof(data); i++)
+        data[i] = i;
+
+    memory.write(0x0F80, data, 0x100);
+    ASSERT(memory, "page boundary", 0x0F80, 0x107F, 0x100, 1);
+    READ(memory, 0x0FFF, 0x7F);
+    READ(memory, 0x1000, 0x80);
+    auto reader = memory.begin()->reader();
+    EQ("reader", 0x0F80, reader.address());
+    EQ("reader", 0x100, reader.size());
+    for (auto i = 0; i < 0x100; i++)
+        EQ("reader", data[i], reader.readByte());
+
+    memory.write(0x3000, data, 0x2100);
+    ASSERT(memory, "multiple pages", 0x0F80, 0x50FF, 0x2200, 2);
+    READ(memory, 0x3FFF, 0xFF);
+    READ(memory, 0x50FF, 0xFF);
+    FALSE("not exist", memory.hasByte(0x2FFF));
+
+    memory.write(0x1080, data, 0x1F80);
+    ASSERT(memory, "fill gap", 0x0F80, 0x50FF, 0x4180, 1);
+    READ(memory, 0x1080, 0x00);
+    READ(memory, 0x2FFF, 0x7F);
+    READ(memory, 0x3000, 0x00);
+
+    memory.setRange(0x1000, 0x3FFF);
+    ASSERT(memory, "range", 0x1000, 0x3FFF, 0x3000, 1);
+    FALSE("trimmed", memory.hasByte(0x0FFF));
+    FALSE("trimmed", memory.hasByte(0x4000));
+}
+
 void test_equal() {
     BinMemory mem1;
     BinMemory mem2;
@@ -225,6 +259,7 @@ void test_range() {
 
 void run_tests() {
     RUN_TEST(test_read_write);
+    RUN_TEST(test_write);
     RUN_TEST(test_equal);
     RUN_TEST(test_swap);
     RUN_TEST(test_reader);
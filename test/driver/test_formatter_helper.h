@@ -59,22 +59,25 @@ private:
         TestReader source(_cpu);                                                        \
         sources.add(source.add(_source));                                               \
         BinMemory memory, prev;                                                         \
-        SymbolStoreImpl symbols;                                                        \
         StoredPrinter list, error;                                                      \
         bool reportError = false;                                                       \
+        driver.reset();                                                                 \
+        options.set(driver);                                                            \
+        driver.setCpu(_cpu);                                                            \
+        driver.save();                                                                  \
         do {                                                                            \
             sources.open(source.name().c_str());                                        \
             prev.swap(memory);                                                          \
-            symbols.copy(driver.symbols());                                             \
+            driver.symbols().resetChanges();                                            \
             memory.clear();                                                             \
             list.clear();                                                               \
             error.clear();                                                              \
-            driver.reset();                                                             \
-            options.set(driver);                                                        \
-            driver.setCpu(_cpu);                                                        \
+            driver.restore();                                                           \
             driver.assemble(sources, memory, list, error, reportError);                 \
+            if (!reportError && driver.resolveFixups(sources, memory, &list))           \
+                break;                                                                  \
             reportError = true;                                                         \
-        } while (error.size() == 0 && (memory != prev || symbols != driver.symbols())); \
+        } while (error.size() == 0 && (driver.symbols().changed() || memory != prev));  \
         for (size_t lineno = 1; lineno <= list.size(); lineno++)                        \
             EQ("line", expected.readLine(), list.line(lineno));                         \
         EQ("line eor", nullptr, expected.readLine());                                   \
@@ -109,9 +109,41 @@ test.bin: error: Operand not aligned: "$9abd6b"
             0x00b9, 0xbdbe, 0xbfc0, 0x00c2, 0xc3c4, 0041774, 0060400 | 0x7F);
 }
 
+void test_dis_jobs() {
+    PREP_DIS(mc68000::DisMc68000);
+
+    // NOP; MOVEQ #1,D0; MOVE.L #$12345678,D0; JMP $1234.L; MOVE.W #1,D0
+    static constexpr uint8_t insns[] = {0x4E, 0x71, 0x70, 0x01, 0x20, 0x3C, 0x12, 0x34, 0x56,
+            0x78, 0x4E, 0xF9, 0x00, 0x00, 0x12, 0x34, 0x30, 0x3C, 0x00, 0x01};
+    BinMemory memory;
+    // Chunks for threads start in the middle of an instruction, and there are more chunks than
+    // threads may decode ahead of the merge.
+    for (uint32_t addr = 0x1000; addr < 0xA1000; addr += sizeof(insns))
+        memory.write(addr, insns, sizeof(insns));
+    memory.writeByte(0xC0000, 0x4E);
+
+    driver.setCpu("68000");
+    StoredPrinter out1, list1, err1;
+    driver.disassemble(memory, "test.bin", out1, list1, err1);
+    driver.setJobs(3);
+    StoredPrinter out3, list3, err3;
+    driver.disassemble(memory, "test.bin", out3, list3, err3);
+
+    EQ("content", out1.size(), out3.size());
+    for (size_t lineno = 1; lineno <= out1.size(); lineno++)
+        EQ("content", out1.line(lineno), out3.line(lineno));
+    EQ("line", list1.size(), list3.size());
+    for (size_t lineno = 1; lineno <= list1.size(); lineno++)
+        EQ("line", list1.line(lineno), list3.line(lineno));
+    EQ("error", err1.size(), err3.size());
+    for (size_t lineno = 1; lineno <= err1.size(); lineno++)
+        EQ("error", err1.line(lineno), err3.line(lineno));
+}
+
 void run_tests() {
     RUN_TEST(test_asm_mc68000);
     RUN_TEST(test_dis_mc68000);
+    RUN_TEST(test_dis_jobs);
 }
 
 }  // namespace test
@@ -99,9 +99,92 @@ test.bin: error: Unknown post-byte
             0x10, 0xA3, 0xB9, 0x12, 0x34, 0x01, 0xA6, 0x87);
 }
 
+void test_dis_trace() {
+    PREP_DIS(mc6809::DisMc6809);
+
+    driver.setUppercase(false);
+    driver.addEntry(0x1000);
+
+    DIS8("mc6809", 0x1000,
+            R"(      cpu   6809
+      org   $1000
+L1000:
+      lds   #$8000
+      ldx   #$1013
+L1007:
+      lda   ,x+
+      beq   L1010
+      jsr   >L101F
+      bra   L1007
+L1010:
+      jmp   >L1000
+      fcb   $48, $65, $6C, $6C, $6F, $00, $12, $34
+      fcb   $56, $78, $9A, $BC
+L101F:
+      sta   $E000
+      rts
+      fcb   $FF, $FF
+)",
+            R"(       0 :                            cpu   6809
+    1000 :                            org   $1000
+    1000 :                    L1000:
+    1000 : 10 CE 80 00                lds   #$8000
+    1004 : 8E 10 13                   ldx   #$1013
+    1007 :                    L1007:
+    1007 : A6 80                      lda   ,x+
+    1009 : 27 05                      beq   L1010
+    100B : BD 10 1F                   jsr   >L101F
+    100E : 20 F7                      bra   L1007
+    1010 :                    L1010:
+    1010 : 7E 10 00                   jmp   >L1000
+    1013 : 48 65 6C 6C 6F 00          fcb   $48, $65, $6C, $6C, $6F, $00, $12, $34
+    1019 : 12 34
+    101B : 56 78 9A BC                fcb   $56, $78, $9A, $BC
+    101F :                    L101F:
+    101F : B7 E0 00                   sta   $E000
+    1022 : 39                         rts
+    1023 : FF FF                      fcb   $FF, $FF
+)",
+            0x10, 0xCE, 0x80, 0x00, 0x8E, 0x10, 0x13, 0xA6, 0x80, 0x27, 0x05, 0xBD, 0x10, 0x1F,
+            0x20, 0xF7, 0x7E, 0x10, 0x00, 0x48, 0x65, 0x6C, 0x6C, 0x6F, 0x00, 0x12, 0x34, 0x56,
+            0x78, 0x9A, 0xBC, 0xB7, 0xE0, 0x00, 0x39, 0xFF, 0xFF);
+}
+
+void test_dis_trace_pull_pc() {
+    PREP_DIS(mc6809::DisMc6809);
+
+    driver.setUppercase(false);
+    driver.addEntry(0x2000);
+
+    DIS8("mc6809", 0x2000,
+            R"(      cpu   6809
+      org   $2000
+L2000:
+      bsr   L2006
+      bra   L2000
+      fcb   $12, $34
+L2006:
+      puls  d,pc
+      fcb   $FF, $FF
+)",
+            R"(       0 :                            cpu   6809
+    2000 :                            org   $2000
+    2000 :                    L2000:
+    2000 : 8D 04                      bsr   L2006
+    2002 : 20 FC                      bra   L2000
+    2004 : 12 34                      fcb   $12, $34
+    2006 :                    L2006:
+    2006 : 35 86                      puls  d,pc
+    2008 : FF FF                      fcb   $FF, $FF
+)",
+            0x8D, 0x04, 0x20, 0xFC, 0x12, 0x34, 0x35, 0x86, 0xFF, 0xFF);
+}
+
 void run_tests() {
     RUN_TEST(test_asm_mc6809);
     RUN_TEST(test_dis_mc6809);
+    RUN_TEST(test_dis_trace);
+    RUN_TEST(test_dis_trace_pull_pc);
 }
 
 }  // namespace test
@@ -89,6 +89,33 @@ t11:8:16: error: Operand too far: "20000"
         112 : 076234 003736)");
 }
 
+void test_function_radix() {
+    PREP_ASM(pdp11::AsmPdp11, DecDirective);
+
+    // A number in a function body is parsed with the radix in effect where it is called.
+    ASM("t11",
+            R"(        cpu     t11
+        .= 100
+plus10  .function v, v+10
+        .word   plus10(1)
+        .radix  10
+        .word   plus10(1)
+        .radix  2
+        .word   plus10(1)
+        .radix  10
+        .word   plus10(1))",
+            R"(          0 :                            cpu     t11
+        100 :                            .= 100
+        100 :                    plus10  .function v, v+10
+        100 : 000011                     .word   plus10(1)
+        102 :                            .radix  10
+        102 : 000013                     .word   plus10(1)
+        104 :                            .radix  2
+        104 : 000003                     .word   plus10(1)
+        106 :                            .radix  10
+        106 : 000013                     .word   plus10(1))");
+}
+
 void test_dis_j11() {
     PREP_DIS(pdp11::DisPdp11);
 
@@ -133,11 +160,43 @@ test.bin: error: Unknown instruction
             0014445, 0105465, 012345, 070201, 0004237, 012346);
 }
 
+void test_dis_trace() {
+    PREP_DIS(pdp11::DisPdp11);
+
+    driver.setUppercase(false);
+    driver.addEntry(010000);
+
+    DIS16("j11", 010000,
+            R"(      cpu    j11
+      org    010000
+L1000:
+      jsr    pc, @#L100A
+      br     L1000
+      .byte  345, 024, 346, 024
+L100A:
+      rts    pc
+      .byte  377, 377
+)",
+            R"(       0 :                            cpu    j11
+   10000 :                            org    010000
+   10000 :                    L1000:
+   10000 : 004737 010012              jsr    pc, @#L100A
+   10004 : 000775                     br     L1000
+   10006 : 012345 012346              .byte  345, 024, 346, 024
+   10012 :                    L100A:
+   10012 : 000207                     rts    pc
+   10014 : 177777                     .byte  377, 377
+)",
+            0004737, 010012, 0000775, 012345, 012346, 0000207, 0177777);
+}
+
 void run_tests() {
     RUN_TEST(test_asm_j11);
     RUN_TEST(test_asm_t11);
+    RUN_TEST(test_function_radix);
     RUN_TEST(test_dis_j11);
     RUN_TEST(test_dis_t11);
+    RUN_TEST(test_dis_trace);
 }
 
 }  // namespace test
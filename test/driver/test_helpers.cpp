@@ -48,6 +48,22 @@ void stored_printer() {
     EQ("line 3 and 4", 4, out.size());
     EQ("line 3 and 4", "line 3; append", out.line(3));
     EQ("line 4", "line 4", out.line(4));
+
+    out.replace(2, "line 2; replaced");
+    EQ("replace", 4, out.size());
+    EQ("replace", "line 2; replaced", out.line(2));
+    EQ("replace", "line 3; append", out.line(3));
+
+    const auto *line1 = out.line(1);
+    const std::string longLine(100 * 1024, 'x');
+    for (auto i = 0; i < 10; i++)
+        out.println(longLine.c_str());
+    EQ("stable", 14, out.size());
+    EQ("stable", "line 1", line1);
+    EQ("stable", longLine.c_str(), out.line(14));
+
+    out.clear();
+    EQ("clear", 0, out.size());
 }
 
 void test_reader() {
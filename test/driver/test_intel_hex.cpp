@@ -174,6 +174,19 @@ void test_decoder() {
     EQ("blank-lines", start_expected16, mem_blank.startAddress());
     EQ("blank-lines", end_expected16, mem_blank.endAddress());
 
+    hex.clear("lower-case").add(":12340000112233445566778899aabbccddeeff0012347c");
+    BinMemory mem_lower;
+    EQ("lower-case", 18, BinDecoder::decode(hex, mem_lower));
+    BLOCK_EQ("lower-case", expected16, mem_lower.begin(), start_expected16);
+
+    hex.clear("bad-digit").add(":12340000112233445566778899AABBCCDDEEFG0012347C");
+    BinMemory mem_bad;
+    EQ("bad-digit", -1, BinDecoder::decode(hex, mem_bad));
+    hex.clear("short").add(":12340000112233445566778899AABBCCDDEEFF0012");
+    EQ("short", -1, BinDecoder::decode(hex, mem_bad));
+    hex.clear("checksum").add(":12340000112233445566778899AABBCCDDEEFF0012347D");
+    EQ("checksum", -1, BinDecoder::decode(hex, mem_bad));
+
     hex.clear("16bit-8block1")
             .add(":10340000112233445566778899AABBCCDDEEFF00C4")
             .add(":02341000123474")
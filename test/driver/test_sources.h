@@ -52,7 +52,7 @@ struct TestSources final : driver::AsmSources {
     }
 
     TestSources &add(TestReader &reader) {
-        _files.emplace(reader.name(), &reader);
+        _files[reader.name()] = &reader;
         return *this;
     }
 
@@ -0,0 +1,891 @@
+/*
+ * Copyright 2026 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "asm_cdp1802.h"
+#include "asm_cp1600.h"
+#include "asm_f3850.h"
+#include "asm_h16.h"
+#include "asm_h8300.h"
+#include "asm_h8500.h"
+#include "asm_i8048.h"
+#include "asm_i8051.h"
+#include "asm_i8080.h"
+#include "asm_i8086.h"
+#include "asm_i8096.h"
+#include "asm_ins8060.h"
+#include "asm_ins8070.h"
+#include "asm_mc6800.h"
+#include "asm_mc68000.h"
+#include "asm_mc6805.h"
+#include "asm_mc6809.h"
+#include "asm_mc68hc12.h"
+#include "asm_mc68hc16.h"
+#include "asm_mn1610.h"
+#include "asm_mos6502.h"
+#include "asm_ns32000.h"
+#include "asm_pdp11.h"
+#include "asm_pdp8.h"
+#include "asm_scn2650.h"
+#include "asm_superh.h"
+#include "asm_tlcs90.h"
+#include "asm_tlcs900.h"
+#include "asm_tms320.h"
+#include "asm_tms320f.h"
+#include "asm_tms370.h"
+#include "asm_tms7000.h"
+#include "asm_tms9900.h"
+#include "asm_z280.h"
+#include "asm_z380.h"
+#include "asm_z8.h"
+#include "asm_z80.h"
+#include "asm_z8000.h"
+#include "dis_cdp1802.h"
+#include "dis_cp1600.h"
+#include "dis_f3850.h"
+#include "dis_h16.h"
+#include "dis_h8300.h"
+#include "dis_h8500.h"
+#include "dis_i8048.h"
+#include "dis_i8051.h"
+#include "dis_i8080.h"
+#include "dis_i8086.h"
+#include "dis_i8096.h"
+#include "dis_ins8060.h"
+#include "dis_ins8070.h"
+#include "dis_mc6800.h"
+#include "dis_mc68000.h"
+#include "dis_mc6805.h"
+#include "dis_mc6809.h"
+#include "dis_mc68hc12.h"
+#include "dis_mc68hc16.h"
+#include "dis_mn1610.h"
+#include "dis_mos6502.h"
+#include "dis_ns32000.h"
+#include "dis_pdp11.h"
+#include "dis_pdp8.h"
+#include "dis_scn2650.h"
+#include "dis_superh.h"
+#include "dis_tlcs90.h"
+#include "dis_tlcs900.h"
+#include "dis_tms320.h"
+#include "dis_tms320f.h"
+#include "dis_tms370.h"
+#include "dis_tms7000.h"
+#include "dis_tms9900.h"
+#include "dis_z280.h"
+#include "dis_z380.h"
+#include "dis_z8.h"
+#include "dis_z80.h"
+#include "dis_z8000.h"
+#include "dis_memory.h"
+#include "str_buffer.h"
+#include "version.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <libgen.h>
+#include <signal.h>
+#include <strings.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace libasm;
+
+namespace {
+
+cdp1802::AsmCdp1802 asm1802;
+cp1600::AsmCp1600 asm1600;
+f3850::AsmF3850 asm3850;
+h16::AsmH16 ash16;
+h8300::AsmH8300 asm8300;
+h8500::AsmH8500 ash8500;
+i8048::AsmI8048 asm8048;
+i8051::AsmI8051 asm8051;
+i8080::AsmI8080 asm8080;
+i8086::AsmI8086 asm8086;
+i8096::AsmI8096 asm8096;
+ins8060::AsmIns8060 asm8060;
+ins8070::AsmIns8070 asm8070;
+mc68000::AsmMc68000 asm68000;
+mc6800::AsmMc6800 asm6800;
+mc6805::AsmMc6805 asm6805;
+mc6809::AsmMc6809 asm6809;
+mc68hc12::AsmMc68HC12 asm6812;
+mc68hc16::AsmMc68HC16 asm6816;
+mn1610::AsmMn1610 asm1610;
+mos6502::AsmMos6502 asm6502;
+ns32000::AsmNs32000 asm32000;
+pdp11::AsmPdp11 asmpdp11;
+pdp8::AsmPdp8 asmpdp8;
+scn2650::AsmScn2650 asm2650;
+superh::AsmSuperH asmsuperh;
+tlcs90::AsmTlcs90 asm90;
+tlcs900::AsmTlcs900 asm900;
+tms320::AsmTms320 asm320;
+tms320f::AsmTms320f asm320f;
+tms370::AsmTms370 asm370;
+tms7000::AsmTms7000 asm7000;
+tms9900::AsmTms9900 asm9900;
+z280::AsmZ280 asmz280;
+z380::AsmZ380 asmz380;
+z8000::AsmZ8000 asmz8000;
+z80::AsmZ80 asmz80;
+z8::AsmZ8 asmz8;
+
+cdp1802::DisCdp1802 dis1802;
+cp1600::DisCp1600 dis1600;
+f3850::DisF3850 dis3850;
+h16::DisH16 dish16;
+h8300::DisH8300 dish8300;
+h8500::DisH8500 dish8500;
+i8048::DisI8048 dis8048;
+i8051::DisI8051 dis8051;
+i8080::DisI8080 dis8080;
+i8086::DisI8086 dis8086;
+i8096::DisI8096 dis8096;
+ins8060::DisIns8060 dis8060;
+ins8070::DisIns8070 dis8070;
+mc68000::DisMc68000 dis68000;
+mc6800::DisMc6800 dis6800;
+mc6805::DisMc6805 dis6805;
+mc6809::DisMc6809 dis6809;
+mc68hc12::DisMc68HC12 dis6812;
+mc68hc16::DisMc68HC16 dis6816;
+mn1610::DisMn1610 dis1610;
+mos6502::DisMos6502 dis6502;
+ns32000::DisNs32000 dis32000;
+pdp11::DisPdp11 dispdp11;
+pdp8::DisPdp8 dispdp8;
+scn2650::DisScn2650 dis2650;
+superh::DisSuperH dissuperh;
+tlcs90::DisTlcs90 dis90;
+tlcs900::DisTlcs900 dis900;
+tms320::DisTms320 dis320;
+tms320f::DisTms320f dis320f;
+tms370::DisTms370 dis370;
+tms7000::DisTms7000 dis7000;
+tms9900::DisTms9900 dis9900;
+z280::DisZ280 disz280;
+z380::DisZ380 disz380;
+z8000::DisZ8000 disz8000;
+z80::DisZ80 disz80;
+z8::DisZ8 disz8;
+
+/** Assembler and disassembler of an architecture */
+struct Target {
+    Assembler &assembler;
+    Disassembler &disassembler;
+};
+
+const Target TARGETS[] = {
+        {asm6800, dis6800},
+        {asm6805, dis6805},
+        {asm6809, dis6809},
+        {asm6812, dis6812},
+        {asm6816, dis6816},
+        {asm6502, dis6502},
+        {asm8048, dis8048},
+        {asm8051, dis8051},
+        {asm8080, dis8080},
+        {asmz80, disz80},
+        {asmz280, disz280},
+        {asmz380, disz380},
+        {asmz8, disz8},
+        {asm90, dis90},
+        {asm900, dis900},
+        {asm8060, dis8060},
+        {asm8070, dis8070},
+        {asm1600, dis1600},
+        {asm1802, dis1802},
+        {asm2650, dis2650},
+        {asm3850, dis3850},
+        {asmpdp8, dispdp8},
+        {asm7000, dis7000},
+        {asm370, dis370},
+        {asm320, dis320},
+        {asm320f, dis320f},
+        {asm8086, dis8086},
+        {asm8096, dis8096},
+        {asm68000, dis68000},
+        {ash16, dish16},
+        {asm8300, dish8300},
+        {ash8500, dish8500},
+        {asmsuperh, dissuperh},
+        {asm9900, dis9900},
+        {asmz8000, disz8000},
+        {asm32000, dis32000},
+        {asm1610, dis1610},
+        {asmpdp11, dispdp11},
+};
+
+/** Result of a round trip of an input */
+enum Outcome : uint8_t {
+    /** The input doesn't start with a valid instruction */
+    SKIPPED,
+    /** The text of the instruction is encoded to the same bytes */
+    SAME,
+    /** Encoded to other bytes, which are decoded to the same text */
+    ALIAS,
+    /** Encoded to other bytes, which are decoded to another text */
+    MISMATCH,
+    /** The text of the instruction can't be encoded */
+    ENCODE_ERROR,
+};
+
+const char *outcomeName(Outcome outcome) {
+    switch (outcome) {
+    case ALIAS:
+        return "alias";
+    case MISMATCH:
+        return "mismatch";
+    case ENCODE_ERROR:
+        return "error";
+    default:
+        return "ok";
+    }
+}
+
+/** Bytes of an input, which remembers an attempt to read beyond the end. */
+struct InputReader : DisMemory {
+    InputReader(uint32_t address, const uint8_t *data, size_t size)
+        : DisMemory(address), _data(data), _size(size), _overrun(false) {}
+
+    bool hasNext() const override {
+        if (_size == 0)
+            _overrun = true;
+        return _size != 0;
+    }
+    size_t size() const { return _size; }
+    bool overrun() const { return _overrun; }
+
+protected:
+    uint8_t nextByte() override {
+        --_size;
+        return *_data++;
+    }
+
+private:
+    const uint8_t *_data;
+    size_t _size;
+    mutable bool _overrun;
+};
+
+/**
+ * Decode the instruction at the top of an input and encode its text again. Instances and
+ * buffers are reused across inputs, and nothing is allocated per input.
+ */
+struct RoundTrip {
+    RoundTrip() : _assembler(nullptr), _disassembler(nullptr), _origin(0), _strict(false) {}
+
+    /** Select the target of |cpu|, and returns false if no target has it. */
+    bool setCpu(const char *cpu) {
+        for (const auto &target : TARGETS) {
+            auto &assembler = target.assembler;
+            auto &disassembler = target.disassembler;
+            assembler.reset();
+            disassembler.reset();
+            if (assembler.setCpu(cpu) && disassembler.setCpu(cpu)) {
+                // The assembler needs options which the disassembler output depends on.
+                const char *name, *value;
+                if (disassembler.currentOption(name, value))
+                    assembler.setOption(name, value);
+                _assembler = &assembler;
+                _disassembler = &disassembler;
+                setOrigin(0);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Set the address of inputs. Zero means a third of the address space, where branches to both
+     * directions are possible and don't cross boundaries of pages.
+     */
+    void setOrigin(uint32_t origin) {
+        const auto &config = _disassembler->config();
+        if (origin == 0)
+            origin = ((UINT64_C(1) << config.addressWidth()) / 3) & ~UINT32_C(0xF);
+        _origin = origin;
+    }
+
+    /**
+     * Set option |name| to |value| of the assembler and the disassembler which know it, and
+     * returns false if none knows it.
+     */
+    bool setOption(const char *name, const char *value) {
+        const auto asmOk = _assembler->setOption(name, value) == OK;
+        const auto disOk = _disassembler->setOption(name, value) == OK;
+        return asmOk || disOk;
+    }
+
+    /** Treat an alias as a failure. */
+    void setStrict(bool strict) { _strict = strict; }
+
+    const char *cpu() const { return _disassembler->config().cpu_P(); }
+    /** Maximum bytes of an instruction */
+    size_t codeMax() const {
+        const auto &config = _disassembler->config();
+        return config.codeMax() * config.addressUnit();
+    }
+    bool isFailure(Outcome outcome) const {
+        return outcome == MISMATCH || outcome == ENCODE_ERROR || (_strict && outcome == ALIAS);
+    }
+
+    Outcome run(const uint8_t *data, size_t size) {
+        _consumed = 0;
+        _encodedLength = 0;
+        _error.setOK();
+        if (!decode(data, size, _text, _consumed))
+            return SKIPPED;
+        if (!encode(_text)) {
+            _error.setError(_asmInsn);
+            return ENCODE_ERROR;
+        }
+        if (_encodedLength == _consumed && memcmp(_encoded, data, _consumed) == 0)
+            return SAME;
+        size_t length;
+        if (decode(_encoded, _encodedLength, _retext, length) && length == _encodedLength &&
+                sameText(_text, _retext)) {
+            return ALIAS;
+        }
+        return MISMATCH;
+    }
+
+    /** Number of bytes which the last |run| decoded */
+    size_t consumed() const { return _consumed; }
+
+    /** Print the last failure of |data| into |out|. */
+    void report(FILE *out, Outcome outcome, const uint8_t *data) const {
+        fprintf(out, "%s: %s: ", cpu(), outcomeName(outcome));
+        printBytes(out, data, _consumed);
+        fprintf(out, ": %s", _text[0].line);
+        if (_text[1].mark)
+            fprintf(out, " / %s", _text[1].line);
+        if (outcome == ENCODE_ERROR) {
+            fprintf(out, ": %s", _error.errorText_P());
+            if (*_error.errorAt())
+                fprintf(out, " at \"%s\"", _error.errorAt());
+        } else {
+            fprintf(out, " -> ");
+            printBytes(out, _encoded, _encodedLength);
+        }
+        fprintf(out, "\n");
+    }
+
+    static void printBytes(FILE *out, const uint8_t *data, size_t size) {
+        for (size_t i = 0; i < size; i++)
+            fprintf(out, "%s%02X", i ? " " : "", data[i]);
+    }
+
+private:
+    Assembler *_assembler;
+    Disassembler *_disassembler;
+    uint32_t _origin;
+    bool _strict;
+
+    /** Text of an instruction and its continuation */
+    struct Line {
+        /** Continuation mark, or nullptr for the first line */
+        const /*PROGMEM*/ char *mark;
+        /** Byte offset of the continuation from the instruction */
+        uint8_t offset;
+        char line[Insn::MAX_NAME + Disassembler::MAX_OPERANDS + 8];
+    };
+    Line _text[2];
+    Line _retext[2];
+    Insn _disInsn{0};
+    Insn _asmInsn{0};
+    char _operands[Disassembler::MAX_OPERANDS];
+    size_t _consumed;
+    /** Room of an instruction and its continuation */
+    uint8_t _encoded[128];
+    size_t _encodedLength;
+    ErrorAt _error;
+
+    bool decodeLine(InputReader &reader, Line &line) {
+        _disassembler->decode(reader, _disInsn, _operands, sizeof(_operands));
+        // An instruction truncated by the end of input may be decoded without error.
+        if (!_disInsn.isOK() || *_disInsn.name() == 0 || reader.overrun())
+            return false;
+        StrBuffer out{line.line, sizeof(line.line)};
+        if (line.mark && *line.mark)
+            out.rtext_P(line.mark).letter(' ');
+        out.rtext(_disInsn.name());
+        if (*_operands)
+            out.letter(' ').rtext(_operands);
+        return out.isOK();
+    }
+
+    /** Decode an instruction from |data| into |text|, and set the bytes it read to |length|. */
+    bool decode(const uint8_t *data, size_t size, Line *text, size_t &length) {
+        const auto unit = _disassembler->config().addressUnit();
+        InputReader reader{_origin * unit, data, size};
+        // A failed input may leave state and a continuation to the next input.
+        _disInsn.clearState();
+        _disInsn.setContinueMark_P(nullptr);
+        _disInsn.reset(_origin);
+        text[0].mark = nullptr;
+        text[1].mark = nullptr;
+        if (!decodeLine(reader, text[0]))
+            return false;
+        if (_disInsn.hasContinue()) {
+            text[1].mark = _disInsn.continueMark_P();
+            text[1].offset = _disInsn.continueOffset();
+            if (!decodeLine(reader, text[1]))
+                return false;
+        }
+        length = size - reader.size();
+        return length != 0;
+    }
+
+    /** Encode |text| into |_encoded|. A continuation shares the instruction at offset 0. */
+    bool encode(const Line *text) {
+        const auto unit = _assembler->config().addressUnit();
+        _asmInsn.clearState();
+        _asmInsn.setContinueMark_P(nullptr);
+        _asmInsn.reset(_origin);
+        if (_assembler->encode(text[0].line, _asmInsn) != OK)
+            return false;
+        append(0);
+        if (text[1].mark) {
+            const auto offset = text[1].offset;
+            _asmInsn.reset(_origin + offset / unit);
+            if (_assembler->encode(text[1].line, _asmInsn) != OK)
+                return false;
+            append(offset);
+        }
+        return true;
+    }
+
+    void append(size_t offset) {
+        const auto length = _asmInsn.length();
+        if (offset + length > sizeof(_encoded))
+            return;
+        memcpy(_encoded + offset, _asmInsn.bytes(), length);
+        _encodedLength = offset + length;
+    }
+
+    static bool sameText(const Line *a, const Line *b) {
+        if (strcasecmp(a[0].line, b[0].line))
+            return false;
+        if (a[1].mark == nullptr || b[1].mark == nullptr)
+            return a[1].mark == b[1].mark;
+        return strcasecmp(a[1].line, b[1].line) == 0;
+    }
+};
+
+RoundTrip roundTrip;
+/** Abort at the first failure, as libFuzzer expects */
+bool abortOnFailure = true;
+
+/** Failures of standalone runs */
+struct Failures {
+    const char *outDir = nullptr;
+    size_t maxReports = 10;
+    size_t reported = 0;
+    size_t counts[ENCODE_ERROR + 1];
+    /** Minimized inputs which have failed */
+    std::set<std::string> inputs;
+
+    void clear() {
+        reported = 0;
+        memset(counts, 0, sizeof(counts));
+        inputs.clear();
+    }
+};
+Failures failures;
+
+std::string hexName(const uint8_t *data, size_t size) {
+    std::string name;
+    char hex[3];
+    for (size_t i = 0; i < size; i++) {
+        snprintf(hex, sizeof(hex), "%02x", data[i]);
+        name += hex;
+    }
+    return name;
+}
+
+bool writeFile(const std::string &name, const uint8_t *data, size_t size) {
+    auto *out = fopen(name.c_str(), "wb");
+    if (out == nullptr) {
+        fprintf(stderr, "Can't open output file %s\n", name.c_str());
+        return false;
+    }
+    fwrite(data, 1, size, out);
+    fclose(out);
+    return true;
+}
+
+/**
+ * Record a failure of |data|. An input is minimized to the bytes of the instruction, since the
+ * rest of it is never read.
+ */
+void recordFailure(Outcome outcome, const uint8_t *data) {
+    const auto size = roundTrip.consumed();
+    const auto name = std::string(outcomeName(outcome)) + "-" + hexName(data, size);
+    if (!failures.inputs.insert(name).second)
+        return;
+    if (failures.reported++ < failures.maxReports)
+        roundTrip.report(stderr, outcome, data);
+    if (failures.outDir)
+        writeFile(std::string(failures.outDir) + "/" + name, data, size);
+}
+
+/** Set |option| as "name=value" to the target. */
+bool setOption(const std::string &option) {
+    const auto eq = option.find('=');
+    if (eq == std::string::npos)
+        return false;
+    return roundTrip.setOption(option.substr(0, eq).c_str(), option.c_str() + eq + 1);
+}
+
+}  // namespace
+
+extern "C" int LLVMFuzzerInitialize(int *argc, char ***argv) {
+    // Options of the harness are removed, so that libFuzzer doesn't see them.
+    const char *cpu = nullptr;
+    uint32_t origin = 0;
+    auto strict = false;
+    std::vector<std::string> options;
+    auto &args = *argv;
+    auto n = 1;
+    for (auto i = 1; i < *argc; i++) {
+        const auto *arg = args[i];
+        if (strncmp(arg, "-cpu=", 5) == 0) {
+            cpu = arg + 5;
+        } else if (strncmp(arg, "-origin=", 8) == 0) {
+            origin = strtoul(arg + 8, nullptr, 0);
+        } else if (strncmp(arg, "-option=", 8) == 0) {
+            options.emplace_back(arg + 8);
+        } else if (strcmp(arg, "-strict=1") == 0) {
+            strict = true;
+        } else {
+            args[n++] = args[i];
+        }
+    }
+    *argc = n;
+    args[n] = nullptr;
+    if (cpu == nullptr || !roundTrip.setCpu(cpu)) {
+        fprintf(stderr, "libFuzzer needs a valid -cpu=<cpu>\n");
+        exit(2);
+    }
+    roundTrip.setOrigin(origin);
+    roundTrip.setStrict(strict);
+    for (const auto &option : options) {
+        if (!setOption(option)) {
+            fprintf(stderr, "unknown option %s\n", option.c_str());
+            exit(2);
+        }
+    }
+    return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    const auto outcome = roundTrip.run(data, size);
+    failures.counts[outcome]++;
+    if (roundTrip.isFailure(outcome)) {
+        if (abortOnFailure) {
+            roundTrip.report(stderr, outcome, data);
+            abort();
+        }
+        recordFailure(outcome, data);
+    }
+    return 0;
+}
+
+#if !defined(LIBASM_LIBFUZZER)
+
+namespace {
+
+/** Input which is running, to be reported when it crashes */
+const uint8_t *currentData;
+size_t currentSize;
+
+void writeHex(int fd, const uint8_t *data, size_t size) {
+    static const char HEX[] = "0123456789ABCDEF";
+    for (size_t i = 0; i < size; i++) {
+        const char hex[3] = {HEX[data[i] >> 4], HEX[data[i] & 0xF], ' '};
+        write(fd, hex, sizeof(hex));
+    }
+}
+
+/** Print the input which crashed, then crash again with the default handler. */
+void crashHandler(int sig) {
+    static const char MESSAGE[] = ": crash on input: ";
+    const auto *cpu = roundTrip.cpu();
+    write(STDERR_FILENO, cpu, strlen(cpu));
+    write(STDERR_FILENO, MESSAGE, sizeof(MESSAGE) - 1);
+    writeHex(STDERR_FILENO, currentData, currentSize);
+    write(STDERR_FILENO, "\n", 1);
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+
+void runOne(const uint8_t *data, size_t size) {
+    currentData = data;
+    currentSize = size;
+    LLVMFuzzerTestOneInput(data, size);
+}
+
+bool readFile(const std::string &name, std::vector<uint8_t> &data) {
+    auto *in = fopen(name.c_str(), "rb");
+    if (in == nullptr)
+        return false;
+    data.clear();
+    uint8_t buffer[256];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), in)) > 0)
+        data.insert(data.end(), buffer, buffer + n);
+    fclose(in);
+    return true;
+}
+
+/** Append files of |input| to |files|. A directory is expanded to files in it. */
+void listFiles(const char *input, std::vector<std::string> &files) {
+    struct stat st;
+    if (stat(input, &st) == 0 && S_ISDIR(st.st_mode)) {
+        auto *dir = opendir(input);
+        if (dir == nullptr)
+            return;
+        std::vector<std::string> names;
+        while (const auto *entry = readdir(dir)) {
+            if (entry->d_name[0] != '.')
+                names.emplace_back(std::string(input) + "/" + entry->d_name);
+        }
+        closedir(dir);
+        std::sort(names.begin(), names.end());
+        files.insert(files.end(), names.begin(), names.end());
+    } else {
+        files.emplace_back(input);
+    }
+}
+
+/** xorshift64 pseudo random generator */
+struct Random {
+    Random(uint64_t seed) : _state(seed ? seed : 1) {}
+    uint64_t next() {
+        _state ^= _state << 13;
+        _state ^= _state >> 7;
+        _state ^= _state << 17;
+        return _state;
+    }
+
+private:
+    uint64_t _state;
+};
+
+/** Options of a standalone run */
+struct RunOptions {
+    uint64_t runs = 1000000;
+    uint64_t seed = 1;
+    uint32_t origin = 0;
+    /** Options as "name=value" */
+    std::vector<std::string> options;
+    const char *minimizeDir = nullptr;
+    std::vector<std::string> corpus;
+};
+
+/**
+ * Minimize |corpus| into |dir|. Each input is truncated to the bytes of its instruction, and
+ * inputs which have the same instruction are merged into one.
+ */
+size_t minimize(const std::vector<std::string> &corpus, const char *dir) {
+    std::set<std::string> names;
+    std::vector<uint8_t> data;
+    for (const auto &file : corpus) {
+        if (!readFile(file, data))
+            continue;
+        if (roundTrip.run(data.data(), data.size()) == SKIPPED)
+            continue;
+        const auto size = roundTrip.consumed();
+        const auto name = hexName(data.data(), size);
+        if (names.insert(name).second)
+            writeFile(std::string(dir) + "/" + name, data.data(), size);
+    }
+    return names.size();
+}
+
+/** Run |cpu| with random inputs or |opts.corpus|, and returns the number of failures. */
+size_t fuzz(const char *cpu, const RunOptions &opts) {
+    if (!roundTrip.setCpu(cpu)) {
+        fprintf(stderr, "Unknown CPU %s\n", cpu);
+        return 1;
+    }
+    roundTrip.setOrigin(opts.origin);
+    for (const auto &option : opts.options) {
+        if (!setOption(option))
+            fprintf(stderr, "%s: unknown option %s\n", roundTrip.cpu(), option.c_str());
+    }
+    failures.clear();
+    if (opts.minimizeDir) {
+        const auto n = minimize(opts.corpus, opts.minimizeDir);
+        printf("%s: %zu inputs are minimized to %zu\n", roundTrip.cpu(), opts.corpus.size(), n);
+        return 0;
+    }
+
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+    uint64_t runs = 0;
+    if (opts.corpus.empty()) {
+        Random random(opts.seed);
+        const auto size = roundTrip.codeMax();
+        uint8_t data[64];
+        for (; runs < opts.runs; runs++) {
+            for (size_t i = 0; i < size; i += 8) {
+                const auto r = random.next();
+                memcpy(data + i, &r, 8);
+            }
+            runOne(data, size);
+        }
+    } else {
+        std::vector<uint8_t> data;
+        for (const auto &file : opts.corpus) {
+            if (!readFile(file, data)) {
+                fprintf(stderr, "Can't open input file %s\n", file.c_str());
+                continue;
+            }
+            runOne(data.data(), data.size());
+            runs++;
+        }
+    }
+    const std::chrono::duration<double> elapsed = clock::now() - start;
+
+    const auto &counts = failures.counts;
+    const auto failed = failures.inputs.size();
+    printf("%s: %llu runs, %llu decoded, %llu alias, %llu mismatch, %llu error, %zu failures, "
+           "%.1fM execs/min\n",
+            roundTrip.cpu(), static_cast<unsigned long long>(runs),
+            static_cast<unsigned long long>(runs - counts[SKIPPED]),
+            static_cast<unsigned long long>(counts[ALIAS]),
+            static_cast<unsigned long long>(counts[MISMATCH]),
+            static_cast<unsigned long long>(counts[ENCODE_ERROR]), failed,
+            elapsed.count() > 0 ? runs / elapsed.count() * 60 / 1e6 : 0.0);
+    return failed;
+}
+
+int usage(const char *prog) {
+    fprintf(stderr,
+            R"(libasm round trip fuzzer (version %s)
+usage: %s [-C <cpu>] [-O <name>=<value>] [-n <runs>] [-s <seed>] [-a <origin>]
+          [-S] [-r <reports>] [-o <dir>] [-m <dir>] [<input>...]
+  -C <cpu>          : target CPU; every architecture with its default CPU
+                      unless specified
+  -O <name>=<value> : set option of the assembler and the disassembler
+  -n <runs>         : number of random inputs (default 1000000)
+  -s <seed>         : seed of random inputs (default 1)
+  -a <origin>       : address of inputs (default middle of address space)
+  -S                : strict; an instruction encoded to other bytes fails
+                      even if the bytes are decoded to the same text
+  -r <reports>      : number of failures to print per CPU (default 10)
+  -o <dir>          : write minimized failing inputs to <dir>
+  -m <dir>          : minimize corpus <input>... into <dir>
+  <input>           : file or directory of corpus to run instead of random
+                      inputs
+An input is decoded by the disassembler, and its text is encoded by the
+assembler again. A failure is an instruction which the assembler can't encode,
+or encodes to bytes which are decoded to another text. With libFuzzer, build
+with LIBFUZZER=1 and pass -cpu=<cpu>, -option=<name>=<value>, -origin=<origin>
+and -strict=1 instead.
+)",
+            LIBASM_VERSION_STRING, prog);
+    return 2;
+}
+
+}  // namespace
+
+int main(int argc, const char **argv) {
+    const auto prog = basename(const_cast<char *>(argv[0]));
+    abortOnFailure = false;
+    RunOptions opts;
+    std::vector<const char *> cpus;
+    for (auto i = 1; i < argc; i++) {
+        const auto *opt = argv[i];
+        if (*opt == '-') {
+            const auto c = *++opt;
+            if (c == 'S') {
+                roundTrip.setStrict(true);
+                continue;
+            }
+            if (++i >= argc || strchr("COnsarom", c) == nullptr || c == 0) {
+                fprintf(stderr, "unknown option: %s\n", argv[i - 1]);
+                return usage(prog);
+            }
+            const auto *arg = argv[i];
+            switch (c) {
+            case 'C':
+                cpus.push_back(arg);
+                break;
+            case 'O':
+                opts.options.emplace_back(arg);
+                break;
+            case 'n':
+                opts.runs = strtoull(arg, nullptr, 0);
+                break;
+            case 's':
+                opts.seed = strtoull(arg, nullptr, 0);
+                break;
+            case 'a':
+                opts.origin = strtoul(arg, nullptr, 0);
+                break;
+            case 'r':
+                failures.maxReports = strtoul(arg, nullptr, 0);
+                break;
+            case 'o':
+                failures.outDir = arg;
+                break;
+            case 'm':
+                opts.minimizeDir = arg;
+                break;
+            }
+        } else {
+            listFiles(opt, opts.corpus);
+        }
+    }
+    if (opts.minimizeDir && opts.corpus.empty())
+        return usage(prog);
+    if (cpus.empty()) {
+        for (const auto &target : TARGETS) {
+            target.assembler.reset();
+            cpus.push_back(target.assembler.config().cpu_P());
+        }
+    }
+
+    for (const auto sig : {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT})
+        signal(sig, crashHandler);
+    size_t failed = 0;
+    for (const auto *cpu : cpus)
+        failed += fuzz(cpu, opts);
+    return failed ? 1 : 0;
+}
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -3066,6 +3066,22 @@ void test_float_nowait() {
 
 #endif
 
+void test_clone() {
+    assembler.setOption("optimize-segment", "on");
+    auto *clone = assembler.clone();
+    assembler.setOption("optimize-segment", "off");
+
+    TEST("MOV DS:[SI],AH", SEGDS, 0x88, 0044);
+
+    EQUALS_P("cpu", assembler.config().cpu_P(), clone->config().cpu_P());
+    Insn insn(0);
+    EQUALS("clone", OK, clone->encode("MOV DS:[SI],AH", insn));
+    EQUALS("clone", 2, insn.length());
+    EQUALS("clone", 0x88, insn.bytes()[0]);
+    EQUALS("clone", 0044, insn.bytes()[1]);
+    delete clone;
+}
+
 void test_undef() {
     ERUS("MOV [UNDEF],BH",       "UNDEF],BH", 0x88, 0076, 0x00, 0x00);
     ERUS("MOV [DI+UNDEF],AL",    "UNDEF],AL", 0x88, 0205, 0x00, 0x00);
@@ -3824,6 +3840,7 @@ void run_tests(const char *cpu) {
     RUN_TEST(test_control_transfer);
     RUN_TEST(test_processor_control);
     RUN_TEST(test_segment_override);
+    RUN_TEST(test_clone);
 #if !defined(LIBASM_I8086_NOFPU)
     RUN_TEST(test_float);
     RUN_TEST(test_float_nowait);
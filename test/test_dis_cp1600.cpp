@@ -245,6 +245,48 @@ void test_sdbd() {
     DERRT("SDBD", "PULR", "R0", 0x0001, 0x02B0);
 }
 
+void test_batch() {
+    const Config::opcode_t codes[] = {0x0002, 0x0001, 0x02B8, 0x0034, 0x0012, 0x0003};
+    const auto endian = disassembler.config().endian();
+    const auto unit = disassembler.config().addressUnit();
+    const ArrayMemory memory(0x0100, codes, sizeof(codes), endian, unit);
+    auto reader = memory.iterator();
+    Insn insn(memory.origin());
+    DecodedInsn insns[4];
+    char text[Disassembler::MAX_OPERANDS * 4];
+
+    EQUALS("batch", 2, disassembler.decodeBatch(reader, insn, insns, 2, text, sizeof(text)));
+    EQUALS("EIS", 0x0100, insns[0].address);
+    EQUALS("EIS", 2, insns[0].length);
+    EQUALS("EIS", OK, insns[0].error);
+    EQUALS("EIS", "EIS", insns[0].name);
+    EQUALS("EIS", 0, insns[0].operandsLength);
+    EQUALS("SDBD", 0x0101, insns[1].address);
+    EQUALS("SDBD", 8, insns[1].length);
+    EQUALS("SDBD", "SDBD", insns[1].name);
+
+    // The continuation of SDBD is pending in |insn|.
+    EQUALS("batch", 2, disassembler.decodeBatch(reader, insn, insns, 4, text, sizeof(text)));
+    EQUALS("MVII", 0x0101, insns[0].address);
+    EQUALS("MVII", 0, insns[0].length);
+    EQUALS("MVII", "MVII", insns[0].name);
+    EQUALS("MVII", 11, insns[0].operandsLength);
+    EQUALS("MVII", "X'1234', R0", text + insns[0].operands);
+    EQUALS("DIS", 0x0105, insns[1].address);
+    EQUALS("DIS", 2, insns[1].length);
+    EQUALS("DIS", "DIS", insns[1].name);
+    EQUALS("end", 0, disassembler.decodeBatch(reader, insn, insns, 4, text, sizeof(text)));
+
+    // Operands are discarded without text buffer.
+    reader.rewind();
+    EQUALS("discard", 4, disassembler.decodeBatch(reader, insn, insns, 4));
+    EQUALS("discard", 8, insns[1].length);
+    EQUALS("discard", "MVII", insns[2].name);
+    EQUALS("discard", 0, insns[2].length);
+    EQUALS("discard", 0, insns[2].operandsLength);
+    EQUALS("discard", "DIS", insns[3].name);
+}
+
 // CP1600 uses only the low 10 bits of each opcode word; non-zero upper bits
 // are flagged INVALID_INSTRUCTION.  Jump word2 ctrl=11 is reserved (UNKNOWN).
 void test_illegal_cp1600() {
@@ -270,6 +312,7 @@ void run_tests(const char *cpu) {
     RUN_TEST(test_branch);
     RUN_TEST(test_jump);
     RUN_TEST(test_sdbd);
+    RUN_TEST(test_batch);
     RUN_TEST(test_illegal_cp1600);
 }
 
@@ -43,6 +43,11 @@ void dis_assert(const char *file, int line, const ErrorAt &error, const ArrayMem
     asserter.equals(file, line, expected_name, expected_opr, actual_opr);
     asserter.equals(file, line, expected_name, memory, insn.bytes(), insn.length(),
             disassembler.listRadix());
+
+    auto lengthMem = memory.iterator();
+    Insn lengthInsn(insn.address());
+    disassembler.instructionLength(lengthMem, lengthInsn);
+    asserter.equals(file, line, "instruction length", insn.length(), lengthInsn.length());
 }
 
 bool test_failed;
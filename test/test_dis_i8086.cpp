@@ -4382,6 +4382,24 @@ void test_processor_control() {
     }
 }
 
+void test_clone() {
+    disassembler.setOption("segment-insn", "enable");
+    auto *clone = disassembler.clone();
+    disassembler.setOption("segment-insn", "disable");
+
+    NMEM("", "", "", SEGES);
+
+    EQUALS_P("cpu", disassembler.config().cpu_P(), clone->config().cpu_P());
+    const Config::opcode_t codes[] = {SEGES};
+    const ArrayMemory memory(0, codes, sizeof(codes));
+    Insn insn(memory.origin());
+    char operands[40];
+    auto mem = memory.iterator();
+    EQUALS("clone", OK, clone->decode(mem, insn, operands, sizeof(operands)));
+    EQUALS("clone", "SEGES", insn);
+    delete clone;
+}
+
 void test_bit_manipulation() {
     // BT r/m16,r16
     TEST("BT",  "AX, CX",            0x0F, 0xA3, 0310);
@@ -6069,6 +6087,7 @@ void run_tests(const char *cpu) {
     RUN_TEST(test_control_transfer);
     RUN_TEST(test_processor_control);
     RUN_TEST(test_segment_override);
+    RUN_TEST(test_clone);
     if (is80386() || is80486()) {
         RUN_TEST(test_bit_manipulation);
         RUN_TEST(test_size_prefix);